@@ -132,9 +132,10 @@ static bool adaptive_set_gain(int step, const char *why)
             sdrGetGainDb(current_gain), current_gain, sdrGetGainDb(step), step, why);
 
     int new_gain = sdrSetGain(step);
+    atomic_store_explicit(&Modes.sdr_gain, new_gain, memory_order_relaxed);
     bool changed = (current_gain != new_gain);
     if (changed)
-        ++Modes.stats_current.adaptive_gain_changes;
+        ++Modes.demod_stats->adaptive_gain_changes;
     return changed;
 }
 
@@ -413,9 +414,9 @@ static void adaptive_range_end_of_block()
     adaptive_range_smoothed = adaptive_range_smoothed * (1 - Modes.adaptive_range_alpha) + percentile_n * Modes.adaptive_range_alpha;
     // .. report to stats in dBFS
     if (adaptive_range_smoothed > 0) {
-        Modes.stats_current.adaptive_noise_dbfs = 20 * log10(adaptive_range_smoothed / 65536.0);
+        Modes.demod_stats->adaptive_noise_dbfs = 20 * log10(adaptive_range_smoothed / 65536.0);
     } else {
-        Modes.stats_current.adaptive_noise_dbfs = 0;
+        Modes.demod_stats->adaptive_noise_dbfs = 0;
     }
 
     // reset radix sort for the next block
@@ -434,12 +435,12 @@ static void adaptive_burst_end_of_block()
     double scale = (double)adaptive_subblock_dutycycle_D / adaptive_subblock_dutycycle_N;
 
     // maintain an EMA of the number of undecoded loud bursts seen per block
-    Modes.stats_current.adaptive_loud_undecoded += adaptive_burst_block_loud_undecoded;
+    Modes.demod_stats->adaptive_loud_undecoded += adaptive_burst_block_loud_undecoded;
     adaptive_burst_loud_undecoded_smoothed = adaptive_burst_loud_undecoded_smoothed * (1 - Modes.adaptive_burst_alpha) + scale * adaptive_burst_block_loud_undecoded * Modes.adaptive_burst_alpha;
     adaptive_burst_block_loud_undecoded = 0;
 
     // maintain an EMA of the number of decoded, but loud, messages seen per block
-    Modes.stats_current.adaptive_loud_decoded += adaptive_burst_block_loud_decoded;
+    Modes.demod_stats->adaptive_loud_decoded += adaptive_burst_block_loud_decoded;
     adaptive_burst_loud_decoded_smoothed = adaptive_burst_loud_decoded_smoothed * (1 - Modes.adaptive_burst_alpha) + scale * adaptive_burst_block_loud_decoded * Modes.adaptive_burst_alpha;
     adaptive_burst_block_loud_decoded = 0;
 }
@@ -467,12 +468,12 @@ static void adaptive_end_of_block()
 
     adaptive_control_update();
 
-    Modes.stats_current.adaptive_valid = true;
-    Modes.stats_current.adaptive_range_gain_limit = adaptive_range_gain_limit;
+    Modes.demod_stats->adaptive_valid = true;
+    Modes.demod_stats->adaptive_range_gain_limit = adaptive_range_gain_limit;
 
     int current = sdrGetGain();
     if (current >= 0)
-        ++Modes.stats_current.adaptive_gain_seconds[current < STATS_GAIN_COUNT ? current : STATS_GAIN_COUNT-1];
+        ++Modes.demod_stats->adaptive_gain_seconds[current < STATS_GAIN_COUNT ? current : STATS_GAIN_COUNT-1];
 }
 
 static void adaptive_control_update()
@@ -21,71 +21,226 @@
 #include "dump1090.h"
 #include "ais_charset.h"
 
-typedef int (*CommBDecoderFn)(struct modesMessage *,bool);
-
-static int decodeEmptyResponse(struct modesMessage *mm, bool store);
-static int decodeBDS10(struct modesMessage *mm, bool store);
-static int decodeBDS17(struct modesMessage *mm, bool store);
-static int decodeBDS20(struct modesMessage *mm, bool store);
-static int decodeBDS30(struct modesMessage *mm, bool store);
-static int decodeBDS40(struct modesMessage *mm, bool store);
-static int decodeBDS44(struct modesMessage *mm, bool store);
-static int decodeBDS50(struct modesMessage *mm, bool store);
-static int decodeBDS60(struct modesMessage *mm, bool store);
-static int decodeBDS05(struct modesMessage *mm, bool store);
-
-static CommBDecoderFn comm_b_decoders[] = {
-    &decodeEmptyResponse,
-    &decodeBDS10,
-    &decodeBDS20,
-    &decodeBDS30,
-    &decodeBDS17,
-    &decodeBDS40,
-    &decodeBDS50,
-    &decodeBDS60,
-    &decodeBDS44,
-    &decodeBDS05
+// The MB field, loaded once as a 56-bit integer. MB bit n (numbered
+// 1..56 from the MSB, as in the specs) is bit 56-n of "mb".
+struct commb_fields {
+    uint64_t mb;
 };
 
-void decodeCommB(struct modesMessage *mm)
+static inline unsigned mbBit(const struct commb_fields *f, unsigned bitnum)
 {
-    // If DR or UM are set, this message is _probably_ noise
+    return (unsigned) (f->mb >> (56 - bitnum)) & 1;
+}
+
+static inline unsigned mbBits(const struct commb_fields *f, unsigned firstbit, unsigned lastbit)
+{
+    return (unsigned) (f->mb >> (56 - lastbit)) & ((1U << (lastbit - firstbit + 1)) - 1);
+}
+
+// masks for MB bits first..last inclusive, and for a single MB bit
+#define MB_MASK(first, last) ((((uint64_t)1 << ((last) - (first) + 1)) - 1) << (56 - (last)))
+#define MB_BIT(n) MB_MASK(n, n)
+#define MB_BDS_ZERO(bds) (MB_MASK(1, 8) & ~((uint64_t)(bds) << 48))
+#define MB_BDS_ONE(bds) ((uint64_t)(bds) << 48)
+
+typedef int (*CommBDecoderFn)(const struct commb_fields *, struct modesMessage *, bool);
+typedef bool (*CommBConsistentFn)(const struct commb_fields *, const struct commb_history *, uint64_t);
+
+static int decodeEmptyResponse(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS10(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS17(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS20(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS30(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS40(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS44(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS50(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS60(const struct commb_fields *f, struct modesMessage *mm, bool store);
+static int decodeBDS05(const struct commb_fields *f, struct modesMessage *mm, bool store);
+
+static bool consistentBDS40(const struct commb_fields *f, const struct commb_history *history, uint64_t now);
+static bool consistentBDS50(const struct commb_fields *f, const struct commb_history *history, uint64_t now);
+static bool consistentBDS60(const struct commb_fields *f, const struct commb_history *history, uint64_t now);
+
+// Each candidate register, with the MB bits that must be zero (reserved
+// bits, BDS identifiers) and that must be one (status bits that the
+// decoder insists on) for it to score above zero at all. Messages that
+// fail the masks are rejected without calling the decoder.
+//
+// Registers that carry no identifier of their own, and so are easily
+// confused with each other, also have a check of whether a message
+// carries on from the values the aircraft last sent in that register.
+static const struct {
+    uint64_t must_be_zero;
+    uint64_t must_be_one;
+    CommBDecoderFn decode;
+    commb_format_t format;
+    CommBConsistentFn consistent;
+} comm_b_decoders[] = {
+    { MB_BIT(1) | MB_MASK(5, 56),           0,                                                  &decodeEmptyResponse,   COMMB_EMPTY_RESPONSE,       NULL },
+    { MB_BDS_ZERO(0x10) | MB_MASK(10, 14),  MB_BDS_ONE(0x10),                                   &decodeBDS10,           COMMB_DATALINK_CAPS,        NULL },
+    { MB_BDS_ZERO(0x20),                    MB_BDS_ONE(0x20),                                   &decodeBDS20,           COMMB_AIRCRAFT_IDENT,       NULL },
+    { MB_BDS_ZERO(0x30),                    MB_BDS_ONE(0x30),                                   &decodeBDS30,           COMMB_ACAS_RA,              NULL },
+    { MB_MASK(25, 56),                      0,                                                  &decodeBDS17,           COMMB_GICB_CAPS,            NULL },
+    { MB_MASK(40, 47) | MB_MASK(52, 53),    0,                                                  &decodeBDS40,           COMMB_VERTICAL_INTENT,      &consistentBDS40 },
+    { 0,                                    MB_BIT(1) | MB_BIT(12) | MB_BIT(24) | MB_BIT(46),   &decodeBDS50,           COMMB_TRACK_TURN,           &consistentBDS50 },
+    { 0,                                    MB_BIT(1) | MB_BIT(13) | MB_BIT(24),                &decodeBDS60,           COMMB_HEADING_SPEED,        &consistentBDS60 },
+    { 0,                                    MB_BIT(5) | MB_BIT(24),                             &decodeBDS44,           COMMB_MRAR,                 NULL },
+    { MB_BIT(21),                           0,                                                  &decodeBDS05,           COMMB_AIRBORNE_POSITION,    NULL }
+};
+
+#define COMMB_DECODER_COUNT (sizeof(comm_b_decoders) / sizeof(comm_b_decoders[0]))
+
+static inline bool passesMasks(const struct commb_fields *f, unsigned i)
+{
+    return !(f->mb & comm_b_decoders[i].must_be_zero) && !(~f->mb & comm_b_decoders[i].must_be_one);
+}
+
+// Was 'when' (0 = never) within ttl millis before now?
+static inline bool historyRecent(uint64_t when, uint64_t now, uint64_t ttl)
+{
+    return when != 0 && when <= now && now - when <= ttl;
+}
+
+// Does decoder i fit this message and either carry on from the aircraft's
+// recent values (2), or at least match a register it recently replied with (1)?
+static int historySupport(const struct commb_fields *f, const struct commb_history *history, uint64_t now, unsigned i)
+{
+    if (comm_b_decoders[i].consistent && comm_b_decoders[i].consistent(f, history, now))
+        return 2;
+    if (historyRecent(history->confirmed[comm_b_decoders[i].format], now, COMMB_HISTORY_REGISTER_TTL))
+        return 1;
+    return 0;
+}
+
+// Remember what a successfully decoded message turned out to be
+static void updateHistory(struct commb_history *history, const struct modesMessage *mm, uint64_t now)
+{
+    history->confirmed[mm->commb_format] = now;
+
+    switch (mm->commb_format) {
+    case COMMB_VERTICAL_INTENT:
+        history->intent_updated = now;
+        history->mcp_altitude = mm->nav.mcp_altitude_valid ? mm->nav.mcp_altitude : 0;
+        history->fms_altitude = mm->nav.fms_altitude_valid ? mm->nav.fms_altitude : 0;
+        break;
+
+    case COMMB_TRACK_TURN:
+        history->track_updated = now;
+        history->track = mm->heading;
+        history->gs = mm->gs.v0;
+        break;
+
+    case COMMB_HEADING_SPEED:
+        history->heading_updated = now;
+        history->heading = mm->heading;
+        history->ias = mm->ias;
+        break;
+
+    default:
+        break;
+    }
+}
+
+void decodeCommB(struct modesMessage *mm, struct commb_history *history)
+{
+    // If DR is set, this message is _probably_ noise
     // as nothing really seems to use the multisite broadcast stuff?
     // Also skip anything that had errors corrected
-    if (mm->DR != 0 || mm->UM != 0 || mm->correctedbits > 0) {
+    // (UM is not checked: it was never set yet when this ran from
+    // decodeModesMessage, and real replies often carry a non-zero IIS)
+    if (mm->DR != 0 || mm->correctedbits > 0) {
         mm->commb_format = COMMB_NOT_DECODED;
         return;
     }
 
+    struct commb_fields f = { 0 };
+    for (unsigned i = 0; i < 7; ++i)
+        f.mb = (f.mb << 8) | mm->MB[i];
+
+    uint64_t now = mm->sysTimestampMsg;
+
+    if (history) {
+        // Try the registers this aircraft has recently replied with first.
+        // If one fits and carries on from the values it last held, take it
+        // without scoring all the others.
+        int likely = -1;
+        uint64_t likelyConfirmed = 0;
+        for (unsigned i = 0; i < COMMB_DECODER_COUNT; ++i) {
+            uint64_t confirmed = history->confirmed[comm_b_decoders[i].format];
+            if (!comm_b_decoders[i].consistent || confirmed <= likelyConfirmed || !historyRecent(confirmed, now, COMMB_HISTORY_REGISTER_TTL))
+                continue;
+            if (passesMasks(&f, i) && comm_b_decoders[i].consistent(&f, history, now)) {
+                likely = i;
+                likelyConfirmed = confirmed;
+            }
+        }
+
+        // (the registers with a consistency check only store anything
+        // when they score above zero, so this can decode in one go)
+        if (likely >= 0 && comm_b_decoders[likely].decode(&f, mm, true) > 0) {
+            updateHistory(history, mm, now);
+            return;
+        }
+    }
+
     // This is a bit hairy as we don't know what the requested register was
     int bestScore = 0;
-    CommBDecoderFn bestDecoder = NULL;
-    int ambiguous = 0;
+    int best = -1;
+    unsigned tied = 0;  // bitmask of the decoders that share bestScore
+
+    for (unsigned i = 0; i < COMMB_DECODER_COUNT; ++i) {
+        int score;
+        if (!passesMasks(&f, i))
+            score = 0;
+        else
+            score = comm_b_decoders[i].decode(&f, mm, false);
 
-    for (unsigned i = 0; i < (sizeof(comm_b_decoders) / sizeof(comm_b_decoders[0])); ++i) {
-        int score = comm_b_decoders[i](mm, false);
         if (score > bestScore) {
             bestScore = score;
-            bestDecoder = comm_b_decoders[i];
-            ambiguous = 0;
+            best = i;
+            tied = 1U << i;
         } else if (score == bestScore) {
-            ambiguous = 1;
+            tied |= 1U << i;
         }
     }
 
-    if (bestDecoder) {
-        if (ambiguous) {
+    if (best < 0) {
+        mm->commb_format = COMMB_UNKNOWN;
+        return;
+    }
+
+    if (tied & (tied - 1)) {
+        // Ambiguous; settle it if exactly one of the tied registers is
+        // better supported by the aircraft's history than all the others
+        int bestSupport = 0;
+        best = -1;
+        if (history) {
+            for (unsigned i = 0; i < COMMB_DECODER_COUNT; ++i) {
+                if (!(tied & (1U << i)))
+                    continue;
+                int support = historySupport(&f, history, now, i);
+                if (support > bestSupport) {
+                    bestSupport = support;
+                    best = i;
+                } else if (support == bestSupport) {
+                    best = -1;
+                }
+            }
+        }
+
+        if (best < 0) {
             mm->commb_format = COMMB_AMBIGUOUS;
-        } else {
-            // decode it
-            bestDecoder(mm, true);
+            return;
         }
-    } else {
-        mm->commb_format = COMMB_UNKNOWN;
     }
+
+    // decode it
+    comm_b_decoders[best].decode(&f, mm, true);
+    if (history)
+        updateHistory(history, mm, now);
 }
 
-static int decodeEmptyResponse(struct modesMessage *mm, bool store)
+static int decodeEmptyResponse(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
     // 00000000000000 is a common response. Ignore it.
     //
@@ -101,23 +256,19 @@ static int decodeEmptyResponse(struct modesMessage *mm, bool store)
     // doesn't support the register or has no data loaded for it.
     // Treat them like empty responses.
 
-    switch (mm->MB[0]) {
-    case 0x00:
-    case 0x40:
-    case 0x50:
-    case 0x60:
+    // MB bit 1 and bits 5..56 are zero (see comm_b_decoders), leaving
+    // the first byte as one of 0x00, 0x40, 0x50, 0x60
+    switch (mbBits(f, 2, 4)) {
+    case 0:
+    case 4:
+    case 5:
+    case 6:
         break;
 
     default:
         return 0;
     }
 
-    for (unsigned i = 1; i < 7; ++i) {
-        if (mm->MB[i] != 0) {
-            return 0;
-        }
-    }
-
     if (store) {
         mm->commb_format = COMMB_EMPTY_RESPONSE;
     }
@@ -126,21 +277,11 @@ static int decodeEmptyResponse(struct modesMessage *mm, bool store)
 }
 
 // BDS1,0 Datalink capabilities
-static int decodeBDS10(struct modesMessage *mm, bool store)
+static int decodeBDS10(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
-
-    // BDS identifier
-    if (msg[0] != 0x10) {
-        return 0;
-    }
-
-    // Reserved bits
-    if (getbits(msg, 10, 14) != 0) {
-        return 0;
-    }
-
-    // Looks plausible.
+    // BDS identifier and reserved bits are checked by comm_b_decoders,
+    // so this looks plausible.
+    MODES_NOTUSED(f);
 
     if (store) {
         mm->commb_format = COMMB_DATALINK_CAPS;
@@ -150,17 +291,12 @@ static int decodeBDS10(struct modesMessage *mm, bool store)
 }
 
 // BDS1,7 Common usage GICB capability report
-static int decodeBDS17(struct modesMessage *mm, bool store)
+static int decodeBDS17(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
-
-    // reserved bits
-    if (getbits(msg, 25, 56) != 0) {
-        return 0;
-    }
+    // reserved bits 25..56 are checked by comm_b_decoders
 
     int score = 0;
-    if (getbit(msg, 7)) {
+    if (mbBit(f, 7)) {
         score += 1;  // 2,0 aircraft identification
     } else {
         // BDS2,0 is on almost everything
@@ -168,42 +304,42 @@ static int decodeBDS17(struct modesMessage *mm, bool store)
     }
 
     // unlikely bits
-    if (getbit(msg, 10)) { // 4,1 next waypoint identifier
+    if (mbBit(f, 10)) { // 4,1 next waypoint identifier
         score -= 2;
     }
-    if (getbit(msg, 11)) { // 4,2 next waypoint position
+    if (mbBit(f, 11)) { // 4,2 next waypoint position
         score -= 2;
     }
-    if (getbit(msg, 12)) { // 4,3 next waypoint information
+    if (mbBit(f, 12)) { // 4,3 next waypoint information
         score -= 2;
     }
-    if (getbit(msg, 13)) { // 4,4 meterological routine report
+    if (mbBit(f, 13)) { // 4,4 meterological routine report
         score -= 1;
     }
-    if (getbit(msg, 14)) { // 4,4 meterological hazard report
+    if (mbBit(f, 14)) { // 4,4 meterological hazard report
         score -= 1;
     }
-    if (getbit(msg, 20)) { // 5,4 waypoint 1
+    if (mbBit(f, 20)) { // 5,4 waypoint 1
         score -= 2;
     }
-    if (getbit(msg, 21)) { // 5,5 waypoint 2
+    if (mbBit(f, 21)) { // 5,5 waypoint 2
         score -= 2;
     }
-    if (getbit(msg, 22)) { // 5,6 waypoint 3
+    if (mbBit(f, 22)) { // 5,6 waypoint 3
         score -= 2;
     }
 
-    if (getbit(msg, 1) && getbit(msg, 2) && getbit(msg, 3) && getbit(msg, 4) && getbit(msg, 5)) {
+    if (mbBit(f, 1) && mbBit(f, 2) && mbBit(f, 3) && mbBit(f, 4) && mbBit(f, 5)) {
         // looks like ES capable
         score += 5;
-        if (getbit(msg, 6)) {
+        if (mbBit(f, 6)) {
             // ES EDI
             score += 1;
         }
-    } else if (!getbit(msg, 1) && !getbit(msg, 2) && !getbit(msg, 3) && !getbit(msg, 4) && !getbit(msg, 5) && !getbit(msg, 6)) {
+    } else if (!mbBit(f, 1) && !mbBit(f, 2) && !mbBit(f, 3) && !mbBit(f, 4) && !mbBit(f, 5) && !mbBit(f, 6)) {
         // not ES capable
         score += 1;
-    } else if (!getbit(msg, 1) && !getbit(msg, 2) && getbit(msg, 3) && getbit(msg, 4) && getbit(msg, 5)) {
+    } else if (!mbBit(f, 1) && !mbBit(f, 2) && mbBit(f, 3) && mbBit(f, 4) && mbBit(f, 5)) {
         // ES with no position data
         score += 3;
     } else {
@@ -211,14 +347,14 @@ static int decodeBDS17(struct modesMessage *mm, bool store)
         score -= 12;
     }
 
-    if (getbit(msg, 16) && getbit(msg, 24)) {
+    if (mbBit(f, 16) && mbBit(f, 24)) {
         // track/turn, heading/speed
         score += 2;
-        if (getbit(msg, 9)) {
+        if (mbBit(f, 9)) {
             // vertical intent
             score += 1;
         }
-    } else if (!getbit(msg, 16) && !getbit(msg, 24) && !getbit(msg, 9)) {
+    } else if (!mbBit(f, 16) && !mbBit(f, 24) && !mbBit(f, 9)) {
         // neither
         score += 1;
     } else {
@@ -234,24 +370,20 @@ static int decodeBDS17(struct modesMessage *mm, bool store)
 }
 
 // BDS2,0 Aircraft identification
-static int decodeBDS20(struct modesMessage *mm, bool store)
+static int decodeBDS20(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
     char callsign[9];
-    unsigned char *msg = mm->MB;
 
-    // BDS identifier
-    if (msg[0] != 0x20) {
-        return 0;
-    }
+    // BDS identifier checked by comm_b_decoders
 
-    callsign[0] = ais_charset[getbits(msg, 9, 14)];
-    callsign[1] = ais_charset[getbits(msg, 15, 20)];
-    callsign[2] = ais_charset[getbits(msg, 21, 26)];
-    callsign[3] = ais_charset[getbits(msg, 27, 32)];
-    callsign[4] = ais_charset[getbits(msg, 33, 38)];
-    callsign[5] = ais_charset[getbits(msg, 39, 44)];
-    callsign[6] = ais_charset[getbits(msg, 45, 50)];
-    callsign[7] = ais_charset[getbits(msg, 51, 56)];
+    callsign[0] = ais_charset[mbBits(f, 9, 14)];
+    callsign[1] = ais_charset[mbBits(f, 15, 20)];
+    callsign[2] = ais_charset[mbBits(f, 21, 26)];
+    callsign[3] = ais_charset[mbBits(f, 27, 32)];
+    callsign[4] = ais_charset[mbBits(f, 33, 38)];
+    callsign[5] = ais_charset[mbBits(f, 39, 44)];
+    callsign[6] = ais_charset[mbBits(f, 45, 50)];
+    callsign[7] = ais_charset[mbBits(f, 51, 56)];
     callsign[8] = 0;
 
     // score based on number of valid characters
@@ -281,14 +413,10 @@ static int decodeBDS20(struct modesMessage *mm, bool store)
 }
 
 // BDS3,0 ACAS RA
-static int decodeBDS30(struct modesMessage *mm, bool store)
+static int decodeBDS30(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
-
-    // BDS identifier
-    if (msg[0] != 0x30) {
-        return 0;
-    }
+    // BDS identifier checked by comm_b_decoders
+    MODES_NOTUSED(f);
 
     if (store) {
         mm->commb_format = COMMB_ACAS_RA;
@@ -299,22 +427,18 @@ static int decodeBDS30(struct modesMessage *mm, bool store)
 }
 
 // BDS4,0 Selected vertical intention
-static int decodeBDS40(struct modesMessage *mm, bool store)
+static int decodeBDS40(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
-
-    unsigned mcp_valid = getbit(msg, 1);
-    unsigned mcp_raw = getbits(msg, 2, 13);
-    unsigned fms_valid = getbit(msg, 14);
-    unsigned fms_raw = getbits(msg, 15, 26);
-    unsigned baro_valid = getbit(msg, 27);
-    unsigned baro_raw = getbits(msg, 28, 39);
-    unsigned reserved_1 = getbits(msg, 40, 47);
-    unsigned mode_valid = getbit(msg, 48);
-    unsigned mode_raw = getbits(msg, 49, 51);
-    unsigned reserved_2 = getbits(msg, 52, 53);
-    unsigned source_valid = getbit(msg, 54);
-    unsigned source_raw = getbits(msg, 55, 56);
+    unsigned mcp_valid = mbBit(f, 1);
+    unsigned mcp_raw = mbBits(f, 2, 13);
+    unsigned fms_valid = mbBit(f, 14);
+    unsigned fms_raw = mbBits(f, 15, 26);
+    unsigned baro_valid = mbBit(f, 27);
+    unsigned baro_raw = mbBits(f, 28, 39);
+    unsigned mode_valid = mbBit(f, 48);
+    unsigned mode_raw = mbBits(f, 49, 51);
+    unsigned source_valid = mbBit(f, 54);
+    unsigned source_raw = mbBits(f, 55, 56);
 
     if (!mcp_valid && !fms_valid && !baro_valid && !mode_valid && !source_valid) {
         return 0;
@@ -367,10 +491,6 @@ static int decodeBDS40(struct modesMessage *mm, bool store)
         return 0;
     }
 
-    if (reserved_1 != 0) {
-        return 0;
-    }
-
     if (mode_valid) {
         score += 4;
     } else if (!mode_valid && mode_raw == 0) {
@@ -379,10 +499,6 @@ static int decodeBDS40(struct modesMessage *mm, bool store)
         return 0;
     }
 
-    if (reserved_2 != 0) {
-        return 0;
-    }
-
     if (source_valid) {
         score += 3;
     } else if (!source_valid && source_raw == 0) {
@@ -465,31 +581,27 @@ static int decodeBDS40(struct modesMessage *mm, bool store)
 }
 
 // BDS5,0 Track and turn report
-static int decodeBDS50(struct modesMessage *mm, bool store)
+static int decodeBDS50(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
+    unsigned roll_valid = mbBit(f, 1);
+    unsigned roll_sign = mbBit(f, 2);
+    unsigned roll_raw = mbBits(f, 3, 11);
 
-    unsigned roll_valid = getbit(msg, 1);
-    unsigned roll_sign = getbit(msg, 2);
-    unsigned roll_raw = getbits(msg, 3, 11);
+    unsigned track_valid = mbBit(f, 12);
+    unsigned track_sign = mbBit(f, 13);
+    unsigned track_raw = mbBits(f, 14, 23);
 
-    unsigned track_valid = getbit(msg, 12);
-    unsigned track_sign = getbit(msg, 13);
-    unsigned track_raw = getbits(msg, 14, 23);
+    unsigned gs_valid = mbBit(f, 24);
+    unsigned gs_raw = mbBits(f, 25, 34);
 
-    unsigned gs_valid = getbit(msg, 24);
-    unsigned gs_raw = getbits(msg, 25, 34);
+    unsigned track_rate_valid = mbBit(f, 35);
+    unsigned track_rate_sign = mbBit(f, 36);
+    unsigned track_rate_raw = mbBits(f, 37, 45);
 
-    unsigned track_rate_valid = getbit(msg, 35);
-    unsigned track_rate_sign = getbit(msg, 36);
-    unsigned track_rate_raw = getbits(msg, 37, 45);
+    unsigned tas_valid = mbBit(f, 46);
+    unsigned tas_raw = mbBits(f, 47, 56);
 
-    unsigned tas_valid = getbit(msg, 46);
-    unsigned tas_raw = getbits(msg, 47, 56);
-
-    if (!roll_valid || !track_valid || !gs_valid || !tas_valid) {
-        return 0;
-    }
+    // roll_valid, track_valid, gs_valid, tas_valid are all set (checked by comm_b_decoders)
 
     int score = 0;
 
@@ -623,29 +735,28 @@ static int decodeBDS50(struct modesMessage *mm, bool store)
 }
 
 // BDS6,0 Heading and speed report
-static int decodeBDS60(struct modesMessage *mm, bool store)
+static int decodeBDS60(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
-
-    unsigned heading_valid = getbit(msg, 1);
-    unsigned heading_sign = getbit(msg, 2);
-    unsigned heading_raw = getbits(msg, 3, 12);
+    unsigned heading_valid = mbBit(f, 1);
+    unsigned heading_sign = mbBit(f, 2);
+    unsigned heading_raw = mbBits(f, 3, 12);
 
-    unsigned ias_valid = getbit(msg, 13);
-    unsigned ias_raw = getbits(msg, 14, 23);
+    unsigned ias_valid = mbBit(f, 13);
+    unsigned ias_raw = mbBits(f, 14, 23);
 
-    unsigned mach_valid = getbit(msg, 24);
-    unsigned mach_raw = getbits(msg, 25, 34);
+    unsigned mach_valid = mbBit(f, 24);
+    unsigned mach_raw = mbBits(f, 25, 34);
 
-    unsigned baro_rate_valid = getbit(msg, 35);
-    unsigned baro_rate_sign = getbit(msg, 36);
-    unsigned baro_rate_raw = getbits(msg, 37, 45);
+    unsigned baro_rate_valid = mbBit(f, 35);
+    unsigned baro_rate_sign = mbBit(f, 36);
+    unsigned baro_rate_raw = mbBits(f, 37, 45);
 
-    unsigned inertial_rate_valid = getbit(msg, 46);
-    unsigned inertial_rate_sign = getbit(msg, 47);
-    unsigned inertial_rate_raw = getbits(msg, 48, 56);
+    unsigned inertial_rate_valid = mbBit(f, 46);
+    unsigned inertial_rate_sign = mbBit(f, 47);
+    unsigned inertial_rate_raw = mbBits(f, 48, 56);
 
-    if (!heading_valid || !ias_valid || !mach_valid || (!baro_rate_valid && !inertial_rate_valid)) {
+    // heading_valid, ias_valid, mach_valid are all set (checked by comm_b_decoders)
+    if (!baro_rate_valid && !inertial_rate_valid) {
         return 0;
     }
 
@@ -775,15 +886,13 @@ static int decodeBDS60(struct modesMessage *mm, bool store)
 }
 
 // BDS4,4 Meterological routine air report
-static int decodeBDS44(struct modesMessage *mm, bool store)
+static int decodeBDS44(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
-    unsigned char *msg = mm->MB;
+    unsigned source = mbBits(f, 1, 4);
 
-    unsigned source = getbits(msg, 1, 4);
-
-    unsigned wind_valid = getbit(msg, 5);
-    unsigned windspeed_raw = getbits(msg, 6, 14);
-    unsigned winddir_raw = getbits(msg, 15, 23);
+    unsigned wind_valid = mbBit(f, 5);
+    unsigned windspeed_raw = mbBits(f, 6, 14);
+    unsigned winddir_raw = mbBits(f, 15, 23);
 
     // ICAO 9871 is inconsistent, it claims:
     //  bit 24       sign
@@ -798,24 +907,24 @@ static int decodeBDS44(struct modesMessage *mm, bool store)
     //   bit 25       sign
     //   bits 26..34  static air temperature, MSB=64C, LSB=0.25C, range -128C..+128C
 
-    unsigned sat_valid = getbit(msg, 24);
-    unsigned sat_sign = getbit(msg, 25);
-    unsigned sat_raw = getbits(msg, 26, 34);
+    unsigned sat_valid = mbBit(f, 24);
+    unsigned sat_sign = mbBit(f, 25);
+    unsigned sat_raw = mbBits(f, 26, 34);
 
-    unsigned asp_valid = getbit(msg, 35);
-    unsigned asp_raw = getbits(msg, 36, 46);
+    unsigned asp_valid = mbBit(f, 35);
+    unsigned asp_raw = mbBits(f, 36, 46);
 
-    unsigned turbulence_valid = getbit(msg, 47);
-    unsigned turbulence_raw = getbits(msg, 48, 49);
+    unsigned turbulence_valid = mbBit(f, 47);
+    unsigned turbulence_raw = mbBits(f, 48, 49);
 
-    unsigned humidity_valid = getbit(msg, 50);
-    unsigned humidity_raw = getbits(msg, 51, 56);
+    unsigned humidity_valid = mbBit(f, 50);
+    unsigned humidity_raw = mbBits(f, 51, 56);
 
     if (source == MRAR_SOURCE_INVALID || source >= MRAR_SOURCE_RESERVED)
         return 0; // invalid or reserved source
 
-    if (!wind_valid || !sat_valid)
-        return 0; // all valid messages seen in the wild have at least temp + wind
+    // all valid messages seen in the wild have at least temp + wind;
+    // wind_valid and sat_valid are checked by comm_b_decoders
 
     if (!asp_valid && asp_raw != 0)
         return 0; // ASP not valid, but non-zero values in the ASP field
@@ -941,7 +1050,7 @@ static int decodeBDS44(struct modesMessage *mm, bool store)
 // We don't try to _use_ this as a position, but we can
 // at least try to recognize it, to exclude other
 // comm-b types (in particular they can be mistaken for MRAR)
-static int decodeBDS05(struct modesMessage *mm, bool store)
+static int decodeBDS05(const struct commb_fields *f, struct modesMessage *mm, bool store)
 {
     // We recognize these by matching the position altitude against
     // the altitude in the surrounding message, so we need a
@@ -949,17 +1058,13 @@ static int decodeBDS05(struct modesMessage *mm, bool store)
     if (mm->msgtype != 20)
         return 0;
 
-    unsigned char *msg = mm->MB;
-
-    unsigned typecode = getbits(msg, 1, 5);
+    unsigned typecode = mbBits(f, 1, 5);
     if (typecode < 9 || typecode > 18)
         return 0; // only consider typecodes that could be an airborne position with baro altitude
 
-    unsigned t_bit = getbit(msg, 21);
-    if (t_bit)  // unlikely
-        return 0;
+    // T bit (unlikely) is checked by comm_b_decoders
 
-    unsigned ac12 = getbits(msg, 9, 20);
+    unsigned ac12 = mbBits(f, 9, 20);
     if (!ac12)
         return 0;
 
@@ -969,8 +1074,8 @@ static int decodeBDS05(struct modesMessage *mm, bool store)
     if (mm->AC != ac13)
         return 0; // no altitude match
 
-    unsigned lat = getbits(msg, 23, 39);
-    unsigned lon = getbits(msg, 40, 56);
+    unsigned lat = mbBits(f, 23, 39);
+    unsigned lon = mbBits(f, 40, 56);
     if (lat == 0 || lon == 0) // unlikely position
         return 0;
 
@@ -983,3 +1088,48 @@ static int decodeBDS05(struct modesMessage *mm, bool store)
     // Score this high enough to override everything else
     return 100;
 }
+
+// Absolute difference between two angles, in degrees (0..180)
+static float angleDifference(float a, float b)
+{
+    float d = fabsf(a - b);
+    return (d > 180) ? 360 - d : d;
+}
+
+// BDS4,0: a selected altitude that matches the last one
+static bool consistentBDS40(const struct commb_fields *f, const struct commb_history *history, uint64_t now)
+{
+    if (!historyRecent(history->intent_updated, now, COMMB_HISTORY_VALUE_TTL))
+        return false;
+
+    unsigned mcp_alt = mbBit(f, 1) ? mbBits(f, 2, 13) * 16 : 0;
+    unsigned fms_alt = mbBit(f, 14) ? mbBits(f, 15, 26) * 16 : 0;
+
+    return (mcp_alt && mcp_alt == history->mcp_altitude) || (fms_alt && fms_alt == history->fms_altitude);
+}
+
+// BDS5,0: track and groundspeed close to the last ones
+static bool consistentBDS50(const struct commb_fields *f, const struct commb_history *history, uint64_t now)
+{
+    if (!historyRecent(history->track_updated, now, COMMB_HISTORY_VALUE_TTL))
+        return false;
+
+    // track and groundspeed status bits are checked by comm_b_decoders
+    float track = mbBits(f, 14, 23) * 90.0 / 512.0 + (mbBit(f, 13) ? 180.0 : 0.0);
+    unsigned gs = mbBits(f, 25, 34) * 2;
+
+    return angleDifference(track, history->track) <= 45 && abs((int)gs - (int)history->gs) <= 50;
+}
+
+// BDS6,0: magnetic heading and IAS close to the last ones
+static bool consistentBDS60(const struct commb_fields *f, const struct commb_history *history, uint64_t now)
+{
+    if (!historyRecent(history->heading_updated, now, COMMB_HISTORY_VALUE_TTL))
+        return false;
+
+    // heading and IAS status bits are checked by comm_b_decoders
+    float heading = mbBits(f, 3, 12) * 90.0 / 512.0 + (mbBit(f, 2) ? 180.0 : 0.0);
+    unsigned ias = mbBits(f, 14, 23);
+
+    return angleDifference(heading, history->heading) <= 45 && abs((int)ias - (int)history->ias) <= 50;
+}
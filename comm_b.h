@@ -21,6 +21,34 @@
 #ifndef COMM_B_H
 #define COMM_B_H
 
-void decodeCommB(struct modesMessage *mm);
+// How long a confirmed register is treated as one the transponder is
+// currently being asked for, and how long a confirmed track, heading, speed
+// or selected altitude is used to check the next reply against (ms)
+#define COMMB_HISTORY_REGISTER_TTL 60000
+#define COMMB_HISTORY_VALUE_TTL 10000
+
+// What an aircraft's recent Comm-B replies turned out to be. decodeCommB()
+// tries the registers seen recently first, and uses the last confirmed
+// values to choose between registers that score equally well.
+struct commb_history {
+    uint64_t confirmed[COMMB_AIRBORNE_POSITION + 1]; // time (millis) each format was last decoded, 0 if never
+
+    uint64_t track_updated;       // time (millis) of the last BDS5,0 track/speed
+    float track;
+    unsigned gs;
+
+    uint64_t heading_updated;     // time (millis) of the last BDS6,0 heading/speed
+    float heading;
+    unsigned ias;
+
+    uint64_t intent_updated;      // time (millis) of the last BDS4,0 selected altitudes
+    unsigned mcp_altitude;        // 0 if not valid
+    unsigned fms_altitude;        // 0 if not valid
+};
+
+// Classify and decode the MB field of a DF20/21 message. history is the
+// sending aircraft's history, which is consulted and then updated, or NULL
+// if nothing is known about the aircraft.
+void decodeCommB(struct modesMessage *mm, struct commb_history *history);
 
 #endif
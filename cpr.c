@@ -72,77 +72,61 @@ static double cprModDouble(double a, double b) {
 //
 //=========================================================================
 //
-// The NL function uses the precomputed table from 1090-WP-9-14
+// The NL function uses the precomputed table from 1090-WP-9-14:
+// NL is 59 below the first transition latitude, and drops by one at each
+// transition.
 //
-static int cprNLFunction(double lat) {
+static const double cprNLTransitions[58] = {
+    10.47047130, 14.82817437, 18.18626357, 21.02939493,
+    23.54504487, 25.82924707, 27.93898710, 29.91135686,
+    31.77209708, 33.53993436, 35.22899598, 36.85025108,
+    38.41241892, 39.92256684, 41.38651832, 42.80914012,
+    44.19454951, 45.54626723, 46.86733252, 48.16039128,
+    49.42776439, 50.67150166, 51.89342469, 53.09516153,
+    54.27817472, 55.44378444, 56.59318756, 57.72747354,
+    58.84763776, 59.95459277, 61.04917774, 62.13216659,
+    63.20427479, 64.26616523, 65.31845310, 66.36171008,
+    67.39646774, 68.42322022, 69.44242631, 70.45451075,
+    71.45986473, 72.45884545, 73.45177442, 74.43893416,
+    75.42056257, 76.39684391, 77.36789461, 78.33374083,
+    79.29428225, 80.24923213, 81.19801349, 82.13956981,
+    83.07199445, 83.99173563, 84.89166191, 85.75541621,
+    86.53536998, 87.00000000,
+};
+
+// The number of transitions at or below each whole degree of latitude
+// 0..86. There are never more than two transitions within one degree.
+static const unsigned char cprNLTransitionsBelow[87] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,
+     2,  2,  2,  2,  3,  3,  3,  4,  4,  5,  5,  6,  6,  7,  7,
+     8,  8,  9,  9, 10, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16,
+    17, 18, 19, 19, 20, 21, 22, 23, 23, 24, 25, 26, 27, 28, 29,
+    30, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56,
+};
+
+int cprNLFunction(double lat) {
     if (lat < 0) lat = -lat; // Table is simmetric about the equator
-    if (lat < 10.47047130) return 59;
-    if (lat < 14.82817437) return 58;
-    if (lat < 18.18626357) return 57;
-    if (lat < 21.02939493) return 56;
-    if (lat < 23.54504487) return 55;
-    if (lat < 25.82924707) return 54;
-    if (lat < 27.93898710) return 53;
-    if (lat < 29.91135686) return 52;
-    if (lat < 31.77209708) return 51;
-    if (lat < 33.53993436) return 50;
-    if (lat < 35.22899598) return 49;
-    if (lat < 36.85025108) return 48;
-    if (lat < 38.41241892) return 47;
-    if (lat < 39.92256684) return 46;
-    if (lat < 41.38651832) return 45;
-    if (lat < 42.80914012) return 44;
-    if (lat < 44.19454951) return 43;
-    if (lat < 45.54626723) return 42;
-    if (lat < 46.86733252) return 41;
-    if (lat < 48.16039128) return 40;
-    if (lat < 49.42776439) return 39;
-    if (lat < 50.67150166) return 38;
-    if (lat < 51.89342469) return 37;
-    if (lat < 53.09516153) return 36;
-    if (lat < 54.27817472) return 35;
-    if (lat < 55.44378444) return 34;
-    if (lat < 56.59318756) return 33;
-    if (lat < 57.72747354) return 32;
-    if (lat < 58.84763776) return 31;
-    if (lat < 59.95459277) return 30;
-    if (lat < 61.04917774) return 29;
-    if (lat < 62.13216659) return 28;
-    if (lat < 63.20427479) return 27;
-    if (lat < 64.26616523) return 26;
-    if (lat < 65.31845310) return 25;
-    if (lat < 66.36171008) return 24;
-    if (lat < 67.39646774) return 23;
-    if (lat < 68.42322022) return 22;
-    if (lat < 69.44242631) return 21;
-    if (lat < 70.45451075) return 20;
-    if (lat < 71.45986473) return 19;
-    if (lat < 72.45884545) return 18;
-    if (lat < 73.45177442) return 17;
-    if (lat < 74.43893416) return 16;
-    if (lat < 75.42056257) return 15;
-    if (lat < 76.39684391) return 14;
-    if (lat < 77.36789461) return 13;
-    if (lat < 78.33374083) return 12;
-    if (lat < 79.29428225) return 11;
-    if (lat < 80.24923213) return 10;
-    if (lat < 81.19801349) return 9;
-    if (lat < 82.13956981) return 8;
-    if (lat < 83.07199445) return 7;
-    if (lat < 83.99173563) return 6;
-    if (lat < 84.89166191) return 5;
-    if (lat < 85.75541621) return 4;
-    if (lat < 86.53536998) return 3;
-    if (lat < 87.00000000) return 2;
-    else return 1;
+    if (!(lat < 87.0))
+        return 1; // (also catches NaN)
+
+    // start from the whole degree, then step over up to two more transitions
+    unsigned n = cprNLTransitionsBelow[(unsigned) lat];
+    n += (lat >= cprNLTransitions[n]);
+    n += (lat >= cprNLTransitions[n]);
+    return 59 - (int) n;
 }
 //
 //=========================================================================
 //
+static int cprNFromNL(int nl, int fflag) {
+    int n = nl - (fflag ? 1 : 0);
+    if (n < 1) n = 1;
+    return n;
+}
+
 static int cprNFunction(double lat, int fflag) {
-    int nl = cprNLFunction(lat) - (fflag ? 1 : 0);
-    if (nl < 1) nl = 1;
-    return nl;
+    return cprNFromNL(cprNLFunction(lat), fflag);
 }
 //
 //=========================================================================
@@ -159,10 +143,10 @@ static double cprDlonFunction(double lat, int fflag, int surface) {
 // A few remarks:
 // 1) 131072 is 2^17 since CPR latitude and longitude are encoded in 17 bits.
 //
-int decodeCPRairborne(int even_cprlat, int even_cprlon,
-                      int odd_cprlat, int odd_cprlon,
-                      int fflag,
-                      double *out_lat, double *out_lon)
+int decodeCPRairborneDouble(int even_cprlat, int even_cprlon,
+                            int odd_cprlat, int odd_cprlon,
+                            int fflag,
+                            double *out_lat, double *out_lon)
 {
     double AirDlat0 = 360.0 / 60.0;
     double AirDlat1 = 360.0 / 59.0;
@@ -186,21 +170,22 @@ int decodeCPRairborne(int even_cprlat, int even_cprlon,
         return (-2); // bad data
 
     // Check that both are in the same latitude zone, or abort.
-    if (cprNLFunction(rlat0) != cprNLFunction(rlat1))
+    int nl = cprNLFunction(rlat0);
+    if (nl != cprNLFunction(rlat1))
         return (-1); // positions crossed a latitude zone, try again later
 
     // Compute ni and the Longitude Index "m"
     if (fflag) { // Use odd packet.
-        int ni = cprNFunction(rlat1,1);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat1)-1)) -
-                              (lon1 * cprNLFunction(rlat1))) / 131072.0) + 0.5);
-        rlon = cprDlonFunction(rlat1, 1, 0) * (cprModInt(m, ni)+lon1/131072);
+        int ni = cprNFromNL(nl, 1);
+        int m = (int) floor((((lon0 * (nl-1)) -
+                              (lon1 * nl)) / 131072.0) + 0.5);
+        rlon = (360.0 / ni) * (cprModInt(m, ni)+lon1/131072);
         rlat = rlat1;
     } else {     // Use even packet.
-        int ni = cprNFunction(rlat0,0);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat0)-1)) -
-                              (lon1 * cprNLFunction(rlat0))) / 131072) + 0.5);
-        rlon = cprDlonFunction(rlat0, 0, 0) * (cprModInt(m, ni)+lon0/131072);
+        int ni = cprNFromNL(nl, 0);
+        int m = (int) floor((((lon0 * (nl-1)) -
+                              (lon1 * nl)) / 131072) + 0.5);
+        rlon = (360.0 / ni) * (cprModInt(m, ni)+lon0/131072);
         rlat = rlat0;
     }
 
@@ -213,11 +198,11 @@ int decodeCPRairborne(int even_cprlat, int even_cprlon,
     return 0;
 }
 
-int decodeCPRsurface(double reflat, double reflon,
-                     int even_cprlat, int even_cprlon,
-                     int odd_cprlat, int odd_cprlon,
-                     int fflag,
-                     double *out_lat, double *out_lon)
+int decodeCPRsurfaceDouble(double reflat, double reflon,
+                           int even_cprlat, int even_cprlon,
+                           int odd_cprlat, int odd_cprlon,
+                           int fflag,
+                           double *out_lat, double *out_lon)
 {
     double AirDlat0 = 90.0 / 60.0;
     double AirDlat1 = 90.0 / 59.0;
@@ -278,21 +263,22 @@ int decodeCPRsurface(double reflat, double reflon,
         return (-2); // bad data
 
     // Check that both are in the same latitude zone, or abort.
-    if (cprNLFunction(rlat0) != cprNLFunction(rlat1))
+    int nl = cprNLFunction(rlat0);
+    if (nl != cprNLFunction(rlat1))
         return (-1); // positions crossed a latitude zone, try again later
 
     // Compute ni and the Longitude Index "m"
     if (fflag) { // Use odd packet.
-        int ni = cprNFunction(rlat1,1);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat1)-1)) -
-                              (lon1 * cprNLFunction(rlat1))) / 131072.0) + 0.5);
-        rlon = cprDlonFunction(rlat1, 1, 1) * (cprModInt(m, ni)+lon1/131072);
+        int ni = cprNFromNL(nl, 1);
+        int m = (int) floor((((lon0 * (nl-1)) -
+                              (lon1 * nl)) / 131072.0) + 0.5);
+        rlon = (90.0 / ni) * (cprModInt(m, ni)+lon1/131072);
         rlat = rlat1;
     } else {     // Use even packet.
-        int ni = cprNFunction(rlat0,0);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat0)-1)) -
-                              (lon1 * cprNLFunction(rlat0))) / 131072) + 0.5);
-        rlon = cprDlonFunction(rlat0, 0, 1) * (cprModInt(m, ni)+lon0/131072);
+        int ni = cprNFromNL(nl, 0);
+        int m = (int) floor((((lon0 * (nl-1)) -
+                              (lon1 * nl)) / 131072) + 0.5);
+        rlon = (90.0 / ni) * (cprModInt(m, ni)+lon0/131072);
         rlat = rlat0;
     }
 
@@ -322,10 +308,10 @@ int decodeCPRsurface(double reflat, double reflon,
 // See Figure 5-5 / 5-6 and note that floor is applied to (0.5 + fRP - fEP), not
 // directly to (fRP - fEP). Eq 38 is correct.
 //
-int decodeCPRrelative(double reflat, double reflon,
-                      int cprlat, int cprlon,
-                      int fflag, int surface,
-                      double *out_lat, double *out_lon)
+int decodeCPRrelativeDouble(double reflat, double reflon,
+                            int cprlat, int cprlon,
+                            int fflag, int surface,
+                            double *out_lat, double *out_lon)
 {
     double AirDlat;
     double AirDlon;
@@ -367,3 +353,307 @@ int decodeCPRrelative(double reflat, double reflon,
     *out_lon = rlon;
     return (0);
 }
+
+//
+//=========================================================================
+//
+// Fixed-point decoders.
+//
+// These give the same results as the double-precision decoders above, but
+// do the zone arithmetic in integers, which is much cheaper on CPUs without
+// a fast FPU. Only the reference position (for surface / relative decoding)
+// and the final result are converted to / from degrees.
+//
+// Positions are held in one of two fixed-point forms:
+//
+//  * CPR units: 2^17 per latitude or longitude zone, i.e. the units of the
+//    raw CPR values. Longitude is kept in CPR units throughout, as the
+//    zone size depends on the latitude.
+//
+//  * Angle units: 4*60*59*2^17 per full circle, so that a CPR unit of
+//    latitude is an exact number of angle units for all of the zone sizes
+//    (airborne even 236, airborne odd 240, surface even 59, surface odd 60).
+//    Latitude is converted to angle units to compare it with fixed limits
+//    and to find NL.
+//
+
+#define CPR_ANGLE_360 1855979520
+#define CPR_ANGLE_270 (CPR_ANGLE_360 / 4 * 3)
+#define CPR_ANGLE_90  (CPR_ANGLE_360 / 4)
+#define CPR_ANGLE_45  (CPR_ANGLE_360 / 8)
+#define CPR_ANGLE_TO_DEGREES (360.0 / CPR_ANGLE_360)
+
+// floor(x / 2^17) without relying on the behaviour of >> on negative values
+static inline int32_t cprFloorDiv17(int32_t x) {
+    return (x >= 0) ? (x >> 17) : ~(~x >> 17);
+}
+
+// floor(a / b) for b > 0
+static inline int32_t cprFloorDivInt(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if (q * b > a) --q;
+    return q;
+}
+
+// floor(x) for a double that fits in an int32_t
+static inline int32_t cprFloorToInt(double x) {
+    int32_t i = (int32_t) x;
+    if (i > x) --i;
+    return i;
+}
+
+// cprNLTransitions[], in angle units, rounded up so that a latitude is
+// below a transition exactly when its angle value is less than the table entry
+static const int32_t cprNLTransitionsFixed[58] = {
+    53980501, 76446634, 93759258, 108417018,
+    121386448, 133162649, 144039411, 154207961,
+    163801005, 172915087, 181623042, 189981421,
+    198035175, 205820741, 213368141, 220702465,
+    227844942, 234813720, 241624471, 248290834,
+    254824774, 261236860, 267536482, 273732035,
+    279831058, 285840357, 291766104, 297613913,
+    303388919, 309095824, 314738955, 320322303,
+    325849555, 331324130, 336749198, 342127708,
+    347462400, 352755821, 358010337, 363228137,
+    368411238, 373561482, 378680526, 383769826,
+    388830610, 393863827, 398870078, 403849497,
+    408801567, 413724810, 418616251, 423470443,
+    428277557, 433019282, 437658850, 442111934,
+    446132985, 448528384,
+};
+
+// The number of transitions at or below the start of each 2^22 angle unit
+// (about 0.81 degree) bucket, up to 87 degrees. As with the per-degree table,
+// there are never more than two transitions within one bucket.
+static const unsigned char cprNLTransitionsFixedBelow[107] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,
+     1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  4,  4,  4,  5,
+     5,  5,  6,  6,  6,  7,  7,  8,  8,  8,  9,  9, 10, 10, 11,
+    11, 12, 12, 13, 13, 14, 15, 15, 16, 16, 17, 18, 18, 19, 19,
+    20, 21, 21, 22, 23, 23, 24, 25, 25, 26, 27, 28, 28, 29, 30,
+    30, 31, 32, 33, 34, 34, 35, 36, 37, 37, 38, 39, 40, 41, 41,
+    42, 43, 44, 45, 46, 46, 47, 48, 49, 50, 51, 52, 52, 53, 54,
+    55, 56,
+};
+
+int cprNLFunctionFixed(int32_t lat) {
+    if (lat < 0) lat = -lat;
+    if (lat >= cprNLTransitionsFixed[57])
+        return 1;
+
+    unsigned n = cprNLTransitionsFixedBelow[lat >> 22];
+    n += (lat >= cprNLTransitionsFixed[n]);
+    n += (lat >= cprNLTransitionsFixed[n]);
+    return 59 - (int) n;
+}
+
+// Degrees per airborne CPR unit of longitude, by number of longitude zones
+#define S(ni) (360.0 / ((ni) * 131072.0))
+static const double cprLonUnitDegrees[60] = {
+    0,
+    S(1), S(2), S(3), S(4),
+    S(5), S(6), S(7), S(8),
+    S(9), S(10), S(11), S(12),
+    S(13), S(14), S(15), S(16),
+    S(17), S(18), S(19), S(20),
+    S(21), S(22), S(23), S(24),
+    S(25), S(26), S(27), S(28),
+    S(29), S(30), S(31), S(32),
+    S(33), S(34), S(35), S(36),
+    S(37), S(38), S(39), S(40),
+    S(41), S(42), S(43), S(44),
+    S(45), S(46), S(47), S(48),
+    S(49), S(50), S(51), S(52),
+    S(53), S(54), S(55), S(56),
+    S(57), S(58), S(59),
+};
+#undef S
+
+int decodeCPRairborneFixed(int even_cprlat, int even_cprlon,
+                           int odd_cprlat, int odd_cprlon,
+                           int fflag,
+                           double *out_lat, double *out_lon)
+{
+    // Compute the Latitude Index "j"
+    int32_t j = cprFloorDiv17(59 * even_cprlat - 60 * odd_cprlat + 65536);
+    int32_t rlat0 = 236 * (cprModInt(j, 60) * 131072 + even_cprlat);
+    int32_t rlat1 = 240 * (cprModInt(j, 59) * 131072 + odd_cprlat);
+
+    if (rlat0 >= CPR_ANGLE_270) rlat0 -= CPR_ANGLE_360;
+    if (rlat1 >= CPR_ANGLE_270) rlat1 -= CPR_ANGLE_360;
+
+    // Check to see that the latitude is in range: -90 .. +90
+    if (rlat0 < -CPR_ANGLE_90 || rlat0 > CPR_ANGLE_90 || rlat1 < -CPR_ANGLE_90 || rlat1 > CPR_ANGLE_90)
+        return (-2); // bad data
+
+    // Check that both are in the same latitude zone, or abort.
+    int nl = cprNLFunctionFixed(rlat0);
+    if (nl != cprNLFunctionFixed(rlat1))
+        return (-1); // positions crossed a latitude zone, try again later
+
+    // Compute ni and the Longitude Index "m"
+    int ni = cprNFromNL(nl, fflag);
+    int32_t m = cprFloorDiv17(even_cprlon * (nl - 1) - odd_cprlon * nl + 65536);
+    int32_t rlon = cprModInt(m, ni) * 131072 + (fflag ? odd_cprlon : even_cprlon);
+
+    // Renormalize to -180 .. +180
+    if (rlon >= ni * 65536)
+        rlon -= ni * 131072;
+
+    *out_lat = (fflag ? rlat1 : rlat0) * CPR_ANGLE_TO_DEGREES;
+    *out_lon = rlon * cprLonUnitDegrees[ni];
+    return 0;
+}
+
+int decodeCPRsurfaceFixed(double reflat, double reflon,
+                          int even_cprlat, int even_cprlon,
+                          int odd_cprlat, int odd_cprlon,
+                          int fflag,
+                          double *out_lat, double *out_lon)
+{
+    // Compute the Latitude Index "j"
+    int32_t j = cprFloorDiv17(59 * even_cprlat - 60 * odd_cprlat + 65536);
+    int32_t rlat0 = 59 * (cprModInt(j, 60) * 131072 + even_cprlat);
+    int32_t rlat1 = 60 * (cprModInt(j, 59) * 131072 + odd_cprlat);
+    int32_t ref = cprFloorToInt(reflat * (CPR_ANGLE_360 / 360.0));
+
+    // Pick the latitude quadrant that's closest to the reference location,
+    // as in decodeCPRsurfaceDouble
+    if (rlat0 == 0) {
+        if (reflat < -45)
+            rlat0 = -CPR_ANGLE_90;
+        else if (reflat > 45)
+            rlat0 = CPR_ANGLE_90;
+    } else if ((rlat0 - ref) > CPR_ANGLE_45) {
+        rlat0 -= CPR_ANGLE_90;
+    }
+
+    if (rlat1 == 0) {
+        if (reflat < -45)
+            rlat1 = -CPR_ANGLE_90;
+        else if (reflat > 45)
+            rlat1 = CPR_ANGLE_90;
+    } else if ((rlat1 - ref) > CPR_ANGLE_45) {
+        rlat1 -= CPR_ANGLE_90;
+    }
+
+    // Check to see that the latitude is in range: -90 .. +90
+    if (rlat0 < -CPR_ANGLE_90 || rlat0 > CPR_ANGLE_90 || rlat1 < -CPR_ANGLE_90 || rlat1 > CPR_ANGLE_90)
+        return (-2); // bad data
+
+    // Check that both are in the same latitude zone, or abort.
+    int nl = cprNLFunctionFixed(rlat0);
+    if (nl != cprNLFunctionFixed(rlat1))
+        return (-1); // positions crossed a latitude zone, try again later
+
+    // Compute ni and the Longitude Index "m"
+    int ni = cprNFromNL(nl, fflag);
+    int32_t m = cprFloorDiv17(even_cprlon * (nl - 1) - odd_cprlon * nl + 65536);
+    int32_t rlon = cprModInt(m, ni) * 131072 + (fflag ? odd_cprlon : even_cprlon);
+
+    // Move towards the reference longitude in steps of 90 degrees (ni zones),
+    // then renormalize to -180 .. +180
+    int32_t quadrant = ni * 131072;
+    int32_t reflon_cpr = cprFloorToInt(reflon * (ni * (131072.0 / 90.0)));
+    rlon += cprFloorDivInt(reflon_cpr - rlon + quadrant / 2, quadrant) * quadrant;
+    rlon -= cprFloorDivInt(rlon + 2 * quadrant, 4 * quadrant) * 4 * quadrant;
+
+    *out_lat = (fflag ? rlat1 : rlat0) * CPR_ANGLE_TO_DEGREES;
+    *out_lon = rlon * cprLonUnitDegrees[ni] * 0.25;
+    return 0;
+}
+
+int decodeCPRrelativeFixed(double reflat, double reflon,
+                           int cprlat, int cprlon,
+                           int fflag, int surface,
+                           double *out_lat, double *out_lon)
+{
+    // zones per 360 degrees, and angle units per CPR unit, of latitude
+    int32_t zones = (surface ? 4 : 1) * (fflag ? 59 : 60);
+    int32_t unit = (surface ? 1 : 4) * (fflag ? 60 : 59);
+
+    // Compute the Latitude Index "j": the zone that puts the position
+    // closest to the reference latitude. The reference is rounded both down
+    // and up so that the range checks below are exact.
+    double reflat_exact = reflat * (zones * (131072.0 / 360.0));
+    int32_t reflat_cpr = cprFloorToInt(reflat_exact);
+    int32_t reflat_cpr_up = reflat_cpr + (reflat_cpr < reflat_exact);
+    int32_t j = cprFloorDiv17(reflat_cpr - cprlat + 65536);
+    int32_t rlat_cpr = j * 131072 + cprlat;
+    int32_t rlat = rlat_cpr * unit;
+    if (rlat >= CPR_ANGLE_270) {
+        rlat -= CPR_ANGLE_360;
+        rlat_cpr -= zones * 131072;
+    }
+
+    // Check to see that the latitude is in range: -90 .. +90
+    if (rlat < -CPR_ANGLE_90 || rlat > CPR_ANGLE_90) {
+        return (-1);                               // Time to give up - Latitude error
+    }
+
+    // Check to see that answer is reasonable - ie no more than 1/2 cell away
+    if (rlat_cpr - reflat_cpr > 65536 || rlat_cpr - reflat_cpr_up < -65536) {
+        return (-1);                               // Time to give up - Latitude error
+    }
+
+    // Compute the Longitude Index "m", likewise
+    int ni = cprNFromNL(cprNLFunctionFixed(rlat), fflag);
+    int32_t circle = (surface ? 4 : 1) * ni * 131072;
+    double reflon_exact = reflon * (circle / 360.0);
+    int32_t reflon_cpr = cprFloorToInt(reflon_exact);
+    int32_t reflon_cpr_up = reflon_cpr + (reflon_cpr < reflon_exact);
+    int32_t m = cprFloorDiv17(reflon_cpr - cprlon + 65536);
+    int32_t rlon_cpr = m * 131072 + cprlon;
+    if (rlon_cpr * 2 > circle) rlon_cpr -= circle;
+
+    // Check to see that answer is reasonable - ie no more than 1/2 cell away
+    if (rlon_cpr - reflon_cpr > 65536 || rlon_cpr - reflon_cpr_up < -65536)
+        return (-1);                               // Time to give up - Longitude error
+
+    *out_lat = rlat * CPR_ANGLE_TO_DEGREES;
+    *out_lon = rlon_cpr * cprLonUnitDegrees[ni] * (surface ? 0.25 : 1.0);
+    return (0);
+}
+
+//
+//=========================================================================
+//
+// The decoders used by the rest of dump1090: fixed-point when built with
+// CPR_FIXED_POINT, double-precision otherwise.
+//
+int decodeCPRairborne(int even_cprlat, int even_cprlon,
+                      int odd_cprlat, int odd_cprlon,
+                      int fflag,
+                      double *out_lat, double *out_lon)
+{
+#ifdef CPR_FIXED_POINT
+    return decodeCPRairborneFixed(even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, out_lat, out_lon);
+#else
+    return decodeCPRairborneDouble(even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, out_lat, out_lon);
+#endif
+}
+
+int decodeCPRsurface(double reflat, double reflon,
+                     int even_cprlat, int even_cprlon,
+                     int odd_cprlat, int odd_cprlon,
+                     int fflag,
+                     double *out_lat, double *out_lon)
+{
+#ifdef CPR_FIXED_POINT
+    return decodeCPRsurfaceFixed(reflat, reflon, even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, out_lat, out_lon);
+#else
+    return decodeCPRsurfaceDouble(reflat, reflon, even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, out_lat, out_lon);
+#endif
+}
+
+int decodeCPRrelative(double reflat, double reflon,
+                      int cprlat, int cprlon,
+                      int fflag, int surface,
+                      double *out_lat, double *out_lon)
+{
+#ifdef CPR_FIXED_POINT
+    return decodeCPRrelativeFixed(reflat, reflon, cprlat, cprlon, fflag, surface, out_lat, out_lon);
+#else
+    return decodeCPRrelativeDouble(reflat, reflon, cprlat, cprlon, fflag, surface, out_lat, out_lon);
+#endif
+}
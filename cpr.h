@@ -20,6 +20,20 @@
 #ifndef DUMP1090_CPR_H
 #define DUMP1090_CPR_H
 
+#include <stdint.h>
+
+// Number of longitude zones at a given latitude (1..59)
+int cprNLFunction(double lat);
+
+// As cprNLFunction, for a latitude in the fixed-point decoders' angle units
+// (4*60*59*2^17 per 360 degrees)
+int cprNLFunctionFixed(int32_t lat);
+
+// The CPR decoders. These use the fixed-point implementations when built
+// with CPR_FIXED_POINT (make CPR_FIXED_POINT=yes), and the double-precision
+// implementations otherwise. Both give the same positions to well within
+// 1e-6 degrees; cprtests checks this.
+
 int decodeCPRairborne(int even_cprlat, int even_cprlon,
                       int odd_cprlat, int odd_cprlon,
                       int fflag,
@@ -36,4 +50,34 @@ int decodeCPRrelative(double reflat, double reflon,
                       int fflag, int surface,
                       double *out_lat, double *out_lon);
 
+// The individual implementations, for testing and benchmarking
+
+int decodeCPRairborneDouble(int even_cprlat, int even_cprlon,
+                            int odd_cprlat, int odd_cprlon,
+                            int fflag,
+                            double *out_lat, double *out_lon);
+int decodeCPRsurfaceDouble(double reflat, double reflon,
+                           int even_cprlat, int even_cprlon,
+                           int odd_cprlat, int odd_cprlon,
+                           int fflag,
+                           double *out_lat, double *out_lon);
+int decodeCPRrelativeDouble(double reflat, double reflon,
+                            int cprlat, int cprlon,
+                            int fflag, int surface,
+                            double *out_lat, double *out_lon);
+
+int decodeCPRairborneFixed(int even_cprlat, int even_cprlon,
+                           int odd_cprlat, int odd_cprlon,
+                           int fflag,
+                           double *out_lat, double *out_lon);
+int decodeCPRsurfaceFixed(double reflat, double reflon,
+                          int even_cprlat, int even_cprlon,
+                          int odd_cprlat, int odd_cprlon,
+                          int fflag,
+                          double *out_lat, double *out_lon);
+int decodeCPRrelativeFixed(double reflat, double reflon,
+                           int cprlat, int cprlon,
+                           int fflag, int surface,
+                           double *out_lat, double *out_lon);
+
 #endif
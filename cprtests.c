@@ -20,6 +20,9 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #include "cpr.h"
 
@@ -147,85 +150,96 @@ static const struct {
     { 52.00,   -1.05,  29693, 8997, 1, 1, 0, 52.209976, 0.176507 },   // odd, surface
 };
 
-static int testCPRGlobalAirborne() {
+// The implementations under test
+static const struct cprImplementation {
+    const char *name;
+    int (*airborne)(int, int, int, int, int, double *, double *);
+    int (*surface)(double, double, int, int, int, int, int, double *, double *);
+    int (*relative)(double, double, int, int, int, int, double *, double *);
+} cprImplementations[] = {
+    { "double", decodeCPRairborneDouble, decodeCPRsurfaceDouble, decodeCPRrelativeDouble },
+    { "fixed",  decodeCPRairborneFixed,  decodeCPRsurfaceFixed,  decodeCPRrelativeFixed },
+};
+
+static int testCPRGlobalAirborne(const struct cprImplementation *impl) {
     int ok = 1;
     unsigned i;
     for (i = 0; i < sizeof(cprGlobalAirborneTests)/sizeof(cprGlobalAirborneTests[0]); ++i) {
         double rlat = 0, rlon = 0;
         int res;
 
-        res = decodeCPRairborne(cprGlobalAirborneTests[i].even_cprlat, cprGlobalAirborneTests[i].even_cprlon,
-                                cprGlobalAirborneTests[i].odd_cprlat, cprGlobalAirborneTests[i].odd_cprlon,
-                                0,
-                                &rlat, &rlon);
+        res = impl->airborne(cprGlobalAirborneTests[i].even_cprlat, cprGlobalAirborneTests[i].even_cprlon,
+                             cprGlobalAirborneTests[i].odd_cprlat, cprGlobalAirborneTests[i].odd_cprlon,
+                             0,
+                             &rlat, &rlon);
         if (res != cprGlobalAirborneTests[i].even_result
             || fabs(rlat - cprGlobalAirborneTests[i].even_rlat) > 1e-6
             || fabs(rlon - cprGlobalAirborneTests[i].even_rlon) > 1e-6) {
             ok = 0;
             fprintf(stderr,
-                    "testCPRGlobalAirborne[%u,EVEN]: FAIL: decodeCPRairborne(%d,%d,%d,%d,EVEN) failed:\n"
+                    "testCPRGlobalAirborne[%s,%u,EVEN]: FAIL: decodeCPRairborne(%d,%d,%d,%d,EVEN) failed:\n"
                     " result %d  (expected %d)\n"
                     " lat %.6f   (expected %.6f)\n"
                     " lon %.6f   (expected %.6f)\n",
-                    i,
+                    impl->name, i,
                     cprGlobalAirborneTests[i].even_cprlat, cprGlobalAirborneTests[i].even_cprlon,
                     cprGlobalAirborneTests[i].odd_cprlat, cprGlobalAirborneTests[i].odd_cprlon,
                     res, cprGlobalAirborneTests[i].even_result,
                     rlat, cprGlobalAirborneTests[i].even_rlat,
                     rlon, cprGlobalAirborneTests[i].even_rlon);
         } else {
-            fprintf(stderr, "testCPRGlobalAirborne[%u,EVEN]: PASS\n", i);
+            fprintf(stderr, "testCPRGlobalAirborne[%s,%u,EVEN]: PASS\n", impl->name, i);
         }
 
-        res = decodeCPRairborne(cprGlobalAirborneTests[i].even_cprlat, cprGlobalAirborneTests[i].even_cprlon,
-                                cprGlobalAirborneTests[i].odd_cprlat, cprGlobalAirborneTests[i].odd_cprlon,
-                                1,
-                                &rlat, &rlon);
+        res = impl->airborne(cprGlobalAirborneTests[i].even_cprlat, cprGlobalAirborneTests[i].even_cprlon,
+                             cprGlobalAirborneTests[i].odd_cprlat, cprGlobalAirborneTests[i].odd_cprlon,
+                             1,
+                             &rlat, &rlon);
         if (res != cprGlobalAirborneTests[i].odd_result
             || fabs(rlat - cprGlobalAirborneTests[i].odd_rlat) > 1e-6
             || fabs(rlon - cprGlobalAirborneTests[i].odd_rlon) > 1e-6) {
             ok = 0;
             fprintf(stderr,
-                    "testCPRGlobalAirborne[%u,ODD]:  FAIL: decodeCPRairborne(%d,%d,%d,%d,ODD) failed:\n"
+                    "testCPRGlobalAirborne[%s,%u,ODD]:  FAIL: decodeCPRairborne(%d,%d,%d,%d,ODD) failed:\n"
                     " result %d  (expected %d)\n"
                     " lat %.6f   (expected %.6f)\n"
                     " lon %.6f   (expected %.6f)\n",
-                    i,
+                    impl->name, i,
                     cprGlobalAirborneTests[i].even_cprlat, cprGlobalAirborneTests[i].even_cprlon,
                     cprGlobalAirborneTests[i].odd_cprlat, cprGlobalAirborneTests[i].odd_cprlon,
                     res, cprGlobalAirborneTests[i].odd_result,
                     rlat, cprGlobalAirborneTests[i].odd_rlat,
                     rlon, cprGlobalAirborneTests[i].odd_rlon);
         } else {
-            fprintf(stderr, "testCPRGlobalAirborne[%u,ODD]:  PASS\n", i);
+            fprintf(stderr, "testCPRGlobalAirborne[%s,%u,ODD]:  PASS\n", impl->name, i);
         }
     }
 
     return ok;
 }
 
-static int testCPRGlobalSurface() {
+static int testCPRGlobalSurface(const struct cprImplementation *impl) {
     int ok = 1;
     unsigned i;
     for (i = 0; i < sizeof(cprGlobalSurfaceTests)/sizeof(cprGlobalSurfaceTests[0]); ++i) {
         double rlat = 0, rlon = 0;
         int res;
 
-        res = decodeCPRsurface(cprGlobalSurfaceTests[i].reflat, cprGlobalSurfaceTests[i].reflon,
-                               cprGlobalSurfaceTests[i].even_cprlat, cprGlobalSurfaceTests[i].even_cprlon,
-                               cprGlobalSurfaceTests[i].odd_cprlat, cprGlobalSurfaceTests[i].odd_cprlon,
-                               0,
-                               &rlat, &rlon);
+        res = impl->surface(cprGlobalSurfaceTests[i].reflat, cprGlobalSurfaceTests[i].reflon,
+                            cprGlobalSurfaceTests[i].even_cprlat, cprGlobalSurfaceTests[i].even_cprlon,
+                            cprGlobalSurfaceTests[i].odd_cprlat, cprGlobalSurfaceTests[i].odd_cprlon,
+                            0,
+                            &rlat, &rlon);
         if (res != cprGlobalSurfaceTests[i].even_result
             || fabs(rlat - cprGlobalSurfaceTests[i].even_rlat) > 1e-6
             || fabs(rlon - cprGlobalSurfaceTests[i].even_rlon) > 1e-6) {
             ok = 0;
             fprintf(stderr,
-                    "testCPRGlobalSurface[%u,EVEN]:  FAIL: decodeCPRsurface(%.6f,%.6f,%d,%d,%d,%d,EVEN) failed:\n"
+                    "testCPRGlobalSurface[%s,%u,EVEN]:  FAIL: decodeCPRsurface(%.6f,%.6f,%d,%d,%d,%d,EVEN) failed:\n"
                     " result %d  (expected %d)\n"
                     " lat %.6f   (expected %.6f)\n"
                     " lon %.6f   (expected %.6f)\n",
-                    i,
+                    impl->name, i,
                     cprGlobalSurfaceTests[i].reflat, cprGlobalSurfaceTests[i].reflon,
                     cprGlobalSurfaceTests[i].even_cprlat, cprGlobalSurfaceTests[i].even_cprlon,
                     cprGlobalSurfaceTests[i].odd_cprlat, cprGlobalSurfaceTests[i].odd_cprlon,
@@ -233,24 +247,24 @@ static int testCPRGlobalSurface() {
                     rlat, cprGlobalSurfaceTests[i].even_rlat,
                     rlon, cprGlobalSurfaceTests[i].even_rlon);
         } else {
-            fprintf(stderr, "testCPRGlobalSurface[%u,EVEN]:  PASS\n", i);
+            fprintf(stderr, "testCPRGlobalSurface[%s,%u,EVEN]:  PASS\n", impl->name, i);
         }
 
-        res = decodeCPRsurface(cprGlobalSurfaceTests[i].reflat, cprGlobalSurfaceTests[i].reflon,
-                               cprGlobalSurfaceTests[i].even_cprlat, cprGlobalSurfaceTests[i].even_cprlon,
-                               cprGlobalSurfaceTests[i].odd_cprlat, cprGlobalSurfaceTests[i].odd_cprlon,
-                               1,
-                               &rlat, &rlon);
+        res = impl->surface(cprGlobalSurfaceTests[i].reflat, cprGlobalSurfaceTests[i].reflon,
+                            cprGlobalSurfaceTests[i].even_cprlat, cprGlobalSurfaceTests[i].even_cprlon,
+                            cprGlobalSurfaceTests[i].odd_cprlat, cprGlobalSurfaceTests[i].odd_cprlon,
+                            1,
+                            &rlat, &rlon);
         if (res != cprGlobalSurfaceTests[i].odd_result
             || fabs(rlat - cprGlobalSurfaceTests[i].odd_rlat) > 1e-6
             || fabs(rlon - cprGlobalSurfaceTests[i].odd_rlon) > 1e-6) {
             ok = 0;
             fprintf(stderr,
-                    "testCPRGlobalSurface[%u,ODD]:   FAIL: decodeCPRsurface(%.6f,%.6f,%d,%d,%d,%d,ODD) failed:\n"
+                    "testCPRGlobalSurface[%s,%u,ODD]:   FAIL: decodeCPRsurface(%.6f,%.6f,%d,%d,%d,%d,ODD) failed:\n"
                     " result %d  (expected %d)\n"
                     " lat %.6f   (expected %.6f)\n"
                     " lon %.6f   (expected %.6f)\n",
-                    i,
+                    impl->name, i,
                     cprGlobalSurfaceTests[i].reflat, cprGlobalSurfaceTests[i].reflon,
                     cprGlobalSurfaceTests[i].even_cprlat, cprGlobalSurfaceTests[i].even_cprlon,
                     cprGlobalSurfaceTests[i].odd_cprlat, cprGlobalSurfaceTests[i].odd_cprlon,
@@ -258,34 +272,34 @@ static int testCPRGlobalSurface() {
                     rlat, cprGlobalSurfaceTests[i].odd_rlat,
                     rlon, cprGlobalSurfaceTests[i].odd_rlon);
         } else {
-            fprintf(stderr, "testCPRGlobalSurface[%u,ODD]:   PASS\n", i);
+            fprintf(stderr, "testCPRGlobalSurface[%s,%u,ODD]:   PASS\n", impl->name, i);
         }
     }
 
     return ok;
 }
 
-static int testCPRRelative() {
+static int testCPRRelative(const struct cprImplementation *impl) {
     int ok = 1;
     unsigned i;
     for (i = 0; i < sizeof(cprRelativeTests)/sizeof(cprRelativeTests[0]); ++i) {
         double rlat = 0, rlon = 0;
         int res;
 
-        res = decodeCPRrelative(cprRelativeTests[i].reflat, cprRelativeTests[i].reflon,
-                                cprRelativeTests[i].cprlat, cprRelativeTests[i].cprlon,
-                                cprRelativeTests[i].fflag, cprRelativeTests[i].surface,
-                                &rlat, &rlon);
+        res = impl->relative(cprRelativeTests[i].reflat, cprRelativeTests[i].reflon,
+                             cprRelativeTests[i].cprlat, cprRelativeTests[i].cprlon,
+                             cprRelativeTests[i].fflag, cprRelativeTests[i].surface,
+                             &rlat, &rlon);
         if (res != cprRelativeTests[i].result
             || fabs(rlat - cprRelativeTests[i].rlat) > 1e-6
             || fabs(rlon - cprRelativeTests[i].rlon) > 1e-6) {
             ok = 0;
             fprintf(stderr,
-                    "testCPRRelative[%u]:  FAIL: decodeCPRrelative(%.6f,%.6f,%d,%d,%d,%d) failed:\n"
+                    "testCPRRelative[%s,%u]:  FAIL: decodeCPRrelative(%.6f,%.6f,%d,%d,%d,%d) failed:\n"
                     " result %d  (expected %d)\n"
                     " lat %.6f   (expected %.6f)\n"
                     " lon %.6f   (expected %.6f)\n",
-                    i,
+                    impl->name, i,
                     cprRelativeTests[i].reflat, cprRelativeTests[i].reflon,
                     cprRelativeTests[i].cprlat, cprRelativeTests[i].cprlon,
                     cprRelativeTests[i].fflag, cprRelativeTests[i].surface,
@@ -293,17 +307,359 @@ static int testCPRRelative() {
                     rlat, cprRelativeTests[i].rlat,
                     rlon, cprRelativeTests[i].rlon);
         } else {
-            fprintf(stderr, "testCPRRelative[%u]:  PASS\n", i);
+            fprintf(stderr, "testCPRRelative[%s,%u]:  PASS\n", impl->name, i);
+        }
+    }
+
+    return ok;
+}
+
+// NL transition latitudes (from 1090-WP-9-14) and the NL value just below each
+static const struct {
+    double lat;
+    int nl_below;
+} cprNLTransitionTests[] = {
+    { 10.47047130, 59 },
+    { 14.82817437, 58 },
+    { 18.18626357, 57 },
+    { 21.02939493, 56 },
+    { 23.54504487, 55 },
+    { 25.82924707, 54 },
+    { 27.93898710, 53 },
+    { 29.91135686, 52 },
+    { 31.77209708, 51 },
+    { 33.53993436, 50 },
+    { 35.22899598, 49 },
+    { 36.85025108, 48 },
+    { 38.41241892, 47 },
+    { 39.92256684, 46 },
+    { 41.38651832, 45 },
+    { 42.80914012, 44 },
+    { 44.19454951, 43 },
+    { 45.54626723, 42 },
+    { 46.86733252, 41 },
+    { 48.16039128, 40 },
+    { 49.42776439, 39 },
+    { 50.67150166, 38 },
+    { 51.89342469, 37 },
+    { 53.09516153, 36 },
+    { 54.27817472, 35 },
+    { 55.44378444, 34 },
+    { 56.59318756, 33 },
+    { 57.72747354, 32 },
+    { 58.84763776, 31 },
+    { 59.95459277, 30 },
+    { 61.04917774, 29 },
+    { 62.13216659, 28 },
+    { 63.20427479, 27 },
+    { 64.26616523, 26 },
+    { 65.31845310, 25 },
+    { 66.36171008, 24 },
+    { 67.39646774, 23 },
+    { 68.42322022, 22 },
+    { 69.44242631, 21 },
+    { 70.45451075, 20 },
+    { 71.45986473, 19 },
+    { 72.45884545, 18 },
+    { 73.45177442, 17 },
+    { 74.43893416, 16 },
+    { 75.42056257, 15 },
+    { 76.39684391, 14 },
+    { 77.36789461, 13 },
+    { 78.33374083, 12 },
+    { 79.29428225, 11 },
+    { 80.24923213, 10 },
+    { 81.19801349, 9 },
+    { 82.13956981, 8 },
+    { 83.07199445, 7 },
+    { 83.99173563, 6 },
+    { 84.89166191, 5 },
+    { 85.75541621, 4 },
+    { 86.53536998, 3 },
+    { 87.00000000, 2 },
+};
+
+// expected NL for a latitude, by linear scan of cprNLTransitionTests
+static int expectedNL(double lat) {
+    unsigned i;
+    lat = fabs(lat);
+    for (i = 0; i < sizeof(cprNLTransitionTests)/sizeof(cprNLTransitionTests[0]); ++i) {
+        if (lat < cprNLTransitionTests[i].lat)
+            return cprNLTransitionTests[i].nl_below;
+    }
+    return 1;
+}
+
+static int testCPRNL() {
+    int ok = 1;
+    unsigned i;
+
+    // each side of every transition, in both hemispheres
+    for (i = 0; i < sizeof(cprNLTransitionTests)/sizeof(cprNLTransitionTests[0]); ++i) {
+        double t = cprNLTransitionTests[i].lat;
+        int below = cprNLTransitionTests[i].nl_below;
+        double lats[4] = { nextafter(t, 0), t, -nextafter(t, 0), -t };
+        int expected[4] = { below, below - 1, below, below - 1 };
+        unsigned k;
+
+        for (k = 0; k < 4; ++k) {
+            int nl = cprNLFunction(lats[k]);
+            if (nl != expected[k]) {
+                ok = 0;
+                fprintf(stderr, "testCPRNL[%u]: FAIL: cprNLFunction(%.17g) = %d (expected %d)\n", i, lats[k], nl, expected[k]);
+            }
+        }
+    }
+
+    // and a sweep over the whole range, including the poles
+    for (i = 0; i <= 1800000; ++i) {
+        double lat = -90.0 + i * 0.0001;
+        if (cprNLFunction(lat) != expectedNL(lat)) {
+            ok = 0;
+            fprintf(stderr, "testCPRNL: FAIL: cprNLFunction(%.6f) = %d (expected %d)\n", lat, cprNLFunction(lat), expectedNL(lat));
+            break;
+        }
+    }
+
+    if (ok)
+        fprintf(stderr, "testCPRNL:  PASS (%u transitions)\n", (unsigned) (sizeof(cprNLTransitionTests)/sizeof(cprNLTransitionTests[0])));
+    return ok;
+}
+
+// cprNLFunctionFixed() takes latitudes in angle units, 4*60*59*2^17 per 360 degrees
+#define CPR_ANGLE_360 1855979520.0
+
+static int testCPRNLFixed() {
+    int ok = 1;
+    unsigned i;
+
+    // each side of every transition, in both hemispheres
+    for (i = 0; i < sizeof(cprNLTransitionTests)/sizeof(cprNLTransitionTests[0]); ++i) {
+        int32_t t = (int32_t) ceil(cprNLTransitionTests[i].lat * CPR_ANGLE_360 / 360.0);
+        int below = cprNLTransitionTests[i].nl_below;
+        int32_t lats[4] = { t - 1, t, -(t - 1), -t };
+        int expected[4] = { below, below - 1, below, below - 1 };
+        unsigned k;
+
+        for (k = 0; k < 4; ++k) {
+            int nl = cprNLFunctionFixed(lats[k]);
+            if (nl != expected[k]) {
+                ok = 0;
+                fprintf(stderr, "testCPRNLFixed[%u]: FAIL: cprNLFunctionFixed(%d) = %d (expected %d)\n", i, (int) lats[k], nl, expected[k]);
+            }
+        }
+    }
+
+    // and a sweep over the whole range, including the poles
+    for (int32_t lat = -463994880; lat <= 463994880; lat += 257) {
+        if (cprNLFunctionFixed(lat) != expectedNL(lat * 360.0 / CPR_ANGLE_360)) {
+            ok = 0;
+            fprintf(stderr, "testCPRNLFixed: FAIL: cprNLFunctionFixed(%d) = %d (expected %d)\n", (int) lat, cprNLFunctionFixed(lat), expectedNL(lat * 360.0 / CPR_ANGLE_360));
+            break;
         }
     }
 
+    if (ok)
+        fprintf(stderr, "testCPRNLFixed:  PASS (%u transitions)\n", (unsigned) (sizeof(cprNLTransitionTests)/sizeof(cprNLTransitionTests[0])));
     return ok;
 }
 
-int main(int __attribute__ ((unused)) argc, char __attribute__ ((unused)) **argv) {
+// Encode a position as airborne / surface CPR, for the sweep and benchmark
+static void encodeCPR(double lat, double lon, int fflag, int surface, int *cprlat, int *cprlon) {
+    double scale = surface ? 90.0 : 360.0;
+    double dlat = scale / (fflag ? 59.0 : 60.0);
+    double yz = floor(131072.0 * fmod(lat + 360.0, dlat) / dlat + 0.5);
+    double rlat = dlat * (yz / 131072.0 + floor(lat / dlat));
+    int ni = cprNLFunction(rlat) - fflag;
+    double dlon = scale / (ni > 0 ? ni : 1);
+    double xz = floor(131072.0 * fmod(lon + 360.0, dlon) / dlon + 0.5);
+
+    *cprlat = (int) yz & 131071;
+    *cprlon = (int) xz & 131071;
+}
+
+// Simple repeatable PRNG (xorshift32) for the randomized sweep
+static uint32_t sweepState = 2463534242U;
+
+static double sweepRandom(double low, double high) {
+    sweepState ^= sweepState << 13;
+    sweepState ^= sweepState >> 17;
+    sweepState ^= sweepState << 5;
+    return low + (high - low) * (sweepState / 4294967296.0);
+}
+
+static unsigned sweepMismatches;
+static double sweepMaxError;
+
+// Check that the fixed-point decode agreed with the double-precision one
+static int sweepCompare(const char *what, int fflag, int res_d, double lat_d, double lon_d, int res_f, double lat_f, double lon_f) {
+    if (res_d == res_f && res_d != 0)
+        return 1;
+
+    double error = fmax(fabs(lat_d - lat_f), fabs(lon_d - lon_f));
+    if (res_d == res_f && error <= 1e-6) {
+        sweepMaxError = fmax(sweepMaxError, error);
+        return 1;
+    }
+
+    if (++sweepMismatches <= 10) {
+        fprintf(stderr, "testCPRFixedSweep: FAIL: %s fflag=%d: double %d %.9f,%.9f; fixed %d %.9f,%.9f\n",
+                what, fflag, res_d, lat_d, lon_d, res_f, lat_f, lon_f);
+    }
+    return 0;
+}
+
+// Compare the fixed-point and double-precision decoders over random
+// positions and random CPR values
+static int testCPRFixedSweep() {
+    const unsigned count = 500000;
+    unsigned i, positions = 0;
+
+    sweepMismatches = 0;
+    sweepMaxError = 0;
+
+    for (i = 0; i < count; ++i) {
+        int surface = i & 1;
+        int even_cprlat, even_cprlon, odd_cprlat, odd_cprlon;
+        double lat = sweepRandom(-90.0, 90.0);
+        double lon = sweepRandom(-180.0, 180.0);
+
+        if (i % 4 < 2) {
+            // arbitrary values, mostly not a valid pair
+            even_cprlat = (int) sweepRandom(0, 131072);
+            even_cprlon = (int) sweepRandom(0, 131072);
+            odd_cprlat = (int) sweepRandom(0, 131072);
+            odd_cprlon = (int) sweepRandom(0, 131072);
+        } else {
+            encodeCPR(lat, lon, 0, surface, &even_cprlat, &even_cprlon);
+            encodeCPR(lat, lon, 1, surface, &odd_cprlat, &odd_cprlon);
+        }
+
+        // a reference position somewhere near the real position. Not exactly
+        // at a pole: that is a multiple of the zone size, where the double-
+        // precision decoder can land in the wrong zone through rounding.
+        double reflat = lat + sweepRandom(-4.0, 4.0) / (surface ? 4 : 1);
+        if (reflat < -90.0 || reflat > 90.0) reflat = lat;
+        double reflon = lon + sweepRandom(-6.0, 6.0) / (surface ? 4 : 1);
+        if (reflon > 180.0) reflon -= 360.0;
+        if (reflon < -180.0) reflon += 360.0;
+
+        for (int fflag = 0; fflag <= 1; ++fflag) {
+            double lat_d = 0, lon_d = 0, lat_f = 0, lon_f = 0;
+            int res_d, res_f;
+
+            if (surface) {
+                // also try a reference in a different quadrant
+                double qlat = (i & 2) ? reflat : sweepRandom(-90.0, 90.0);
+                double qlon = (i & 2) ? reflon : sweepRandom(-180.0, 180.0);
+                res_d = decodeCPRsurfaceDouble(qlat, qlon, even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, &lat_d, &lon_d);
+                res_f = decodeCPRsurfaceFixed(qlat, qlon, even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, &lat_f, &lon_f);
+                sweepCompare("decodeCPRsurface", fflag, res_d, lat_d, lon_d, res_f, lat_f, lon_f);
+            } else {
+                res_d = decodeCPRairborneDouble(even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, &lat_d, &lon_d);
+                res_f = decodeCPRairborneFixed(even_cprlat, even_cprlon, odd_cprlat, odd_cprlon, fflag, &lat_f, &lon_f);
+                sweepCompare("decodeCPRairborne", fflag, res_d, lat_d, lon_d, res_f, lat_f, lon_f);
+            }
+            positions += (res_d == 0);
+
+            int cprlat = fflag ? odd_cprlat : even_cprlat;
+            int cprlon = fflag ? odd_cprlon : even_cprlon;
+            res_d = decodeCPRrelativeDouble(reflat, reflon, cprlat, cprlon, fflag, surface, &lat_d, &lon_d);
+            res_f = decodeCPRrelativeFixed(reflat, reflon, cprlat, cprlon, fflag, surface, &lat_f, &lon_f);
+            sweepCompare("decodeCPRrelative", fflag, res_d, lat_d, lon_d, res_f, lat_f, lon_f);
+            positions += (res_d == 0);
+        }
+    }
+
+    if (sweepMismatches) {
+        fprintf(stderr, "testCPRFixedSweep: FAIL (%u of %u decodes differ)\n", sweepMismatches, count * 4);
+        return 0;
+    }
+
+    fprintf(stderr, "testCPRFixedSweep: PASS (%u decodes, %u positions, max difference %.2g degrees)\n", count * 4, positions, sweepMaxError);
+    return 1;
+}
+
+// Decode positions spread over the globe with each implementation for
+// (at least) the given number of seconds, and report the rates
+static void benchmarkCPR(double seconds) {
+    enum { COUNT = 4096 };
+    static struct {
+        double lat, lon;
+        int even_cprlat, even_cprlon, odd_cprlat, odd_cprlon;
+        int even_surface_cprlat, even_surface_cprlon, odd_surface_cprlat, odd_surface_cprlon;
+    } positions[COUNT];
+    unsigned i, n;
+
+    for (i = 0; i < COUNT; ++i) {
+        // scattered, so that successive decodes are in unrelated latitude zones
+        double lat = -85.0 + 170.0 * fmod(i * 0.6180339887, 1.0);
+        double lon = fmod(i * 137.508, 360.0) - 180.0;
+        positions[i].lat = lat;
+        positions[i].lon = lon;
+        encodeCPR(lat, lon, 0, 0, &positions[i].even_cprlat, &positions[i].even_cprlon);
+        encodeCPR(lat, lon, 1, 0, &positions[i].odd_cprlat, &positions[i].odd_cprlon);
+        encodeCPR(lat, lon, 0, 1, &positions[i].even_surface_cprlat, &positions[i].even_surface_cprlon);
+        encodeCPR(lat, lon, 1, 1, &positions[i].odd_surface_cprlat, &positions[i].odd_surface_cprlon);
+    }
+
+    for (n = 0; n < sizeof(cprImplementations)/sizeof(cprImplementations[0]); ++n) {
+        const struct cprImplementation *impl = &cprImplementations[n];
+        struct timespec start, end;
+        double elapsed;
+        unsigned long long decodes = 0, ok = 0;
+        volatile double sink = 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        do {
+            for (i = 0; i < COUNT; ++i) {
+                double rlat, rlon;
+                if (impl->airborne(positions[i].even_cprlat, positions[i].even_cprlon,
+                                   positions[i].odd_cprlat, positions[i].odd_cprlon,
+                                   i & 1, &rlat, &rlon) == 0) {
+                    ++ok;
+                    sink += rlat;
+                }
+                if (impl->surface(positions[i].lat, positions[i].lon,
+                                  positions[i].even_surface_cprlat, positions[i].even_surface_cprlon,
+                                  positions[i].odd_surface_cprlat, positions[i].odd_surface_cprlon,
+                                  i & 1, &rlat, &rlon) == 0) {
+                    ++ok;
+                    sink += rlat;
+                }
+                if (impl->relative(positions[i].lat, positions[i].lon,
+                                   positions[i].even_cprlat, positions[i].even_cprlon,
+                                   0, 0, &rlat, &rlon) == 0) {
+                    ++ok;
+                    sink += rlon;
+                }
+            }
+            decodes += 3 * COUNT;
+
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        } while (elapsed < seconds);
+
+        fprintf(stderr, "benchmarkCPR[%s]: %llu decodes (%llu successful) in %.2fs: %.0f decodes/second\n",
+                impl->name, decodes, ok, elapsed, decodes / elapsed);
+    }
+}
+
+// Usage: cprtests [--benchmark [seconds]]
+int main(int argc, char **argv) {
+    if (argc > 1 && !strcmp(argv[1], "--benchmark")) {
+        benchmarkCPR(argc > 2 ? atof(argv[2]) : 5.0);
+        return 0;
+    }
+
     int ok = 1;
-    ok = testCPRGlobalAirborne() && ok;
-    ok = testCPRGlobalSurface() && ok;
-    ok = testCPRRelative() && ok;
+    for (unsigned n = 0; n < sizeof(cprImplementations)/sizeof(cprImplementations[0]); ++n) {
+        ok = testCPRGlobalAirborne(&cprImplementations[n]) && ok;
+        ok = testCPRGlobalSurface(&cprImplementations[n]) && ok;
+        ok = testCPRRelative(&cprImplementations[n]) && ok;
+    }
+    ok = testCPRNL() && ok;
+    ok = testCPRNLFixed() && ok;
+    ok = testCPRFixedSweep() && ok;
     return ok ? 0 : 1;
 }
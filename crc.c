@@ -20,6 +20,9 @@
 #include "dump1090.h"
 
 #include <assert.h>
+#include <sys/mman.h>
+
+#include "dsp/helpers/tables.h"
 
 // Errorinfo for "no errors"
 static struct errorinfo NO_ERRORS;
@@ -27,32 +30,22 @@ static struct errorinfo NO_ERRORS;
 // Generator polynomial for the Mode S CRC:
 #define MODES_GENERATOR_POLY 0xfff409U
 
-// CRC values for all single-byte messages;
-// used to speed up CRC calculation.
-static uint32_t crc_table[256];
-
 // Syndrome values for all single-bit errors;
 // used to speed up construction of error-
 // correction tables.
 static uint32_t single_bit_syndrome[112];
 
+// Slicing tables from get_crc_modes_table(), used by modesChecksumBoth()
+static const uint32_t *crc_slice_table;
+
 static void initLookupTables()
 {
     int i;
     uint8_t msg[112/8];
 
-    for (i = 0; i < 256; ++i) {
-        uint32_t c = i << 16;
-        int j;
-        for (j = 0; j < 8; ++j) {
-            if (c & 0x800000)
-                c = (c<<1) ^ MODES_GENERATOR_POLY;
-            else
-                c = (c<<1);
-        }
-
-        crc_table[i] = c & 0x00ffffff;
-    }
+    // Build the CRC tables and select the CRC implementation now,
+    // before any other threads start calling modesChecksum.
+    crc_slice_table = get_crc_modes_table();
 
     memset(msg, 0, sizeof(msg));
     for (i = 0; i < 112; ++i) {
@@ -64,22 +57,44 @@ static void initLookupTables()
 
 uint32_t modesChecksum(const uint8_t *message, int bits)
 {
-    uint32_t rem = 0;
-    int i;
-    int n = bits/8;
+    uint32_t rem;
 
     assert(bits % 8 == 0);
-    assert(n >= 3);
-
-    for (i = 0; i < n-3; ++i) {
-        rem = (rem << 8) ^ crc_table[message[i] ^ ((rem & 0xff0000) >> 16)];
-        rem = rem & 0xffffff;
-    }
+    assert(bits >= 24);
 
-    rem = rem ^ (message[n-3] << 16) ^ (message[n-2] << 8) ^ (message[n-1]);
+    starch_crc_modes_u8(message, bits / 8, &rem);
     return rem;
 }
 
+// One step of slicing-by-4 over the CRC register, which holds the 24-bit
+// CRC shifted left by 8 (see get_crc_modes_table)
+static inline uint32_t crcSlice4(uint32_t c, const uint8_t *p)
+{
+    const uint32_t *t = crc_slice_table;
+    c ^= ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+    return t[768 + (c >> 24)] ^ t[512 + ((c >> 16) & 255)] ^ t[256 + ((c >> 8) & 255)] ^ t[c & 255];
+}
+
+static inline uint32_t crcParity(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 16) | ((uint32_t) p[1] << 8) | p[2];
+}
+
+void modesChecksumBoth(const uint8_t *msg, uint32_t *short_syndrome, uint32_t *long_syndrome)
+{
+    const uint32_t *t = crc_slice_table;
+
+    // the 56-bit message shares its 32 data bits with the start of the 112-bit message
+    uint32_t c = crcSlice4(0, msg);
+    *short_syndrome = (c >> 8) ^ crcParity(msg + 4);
+
+    c = crcSlice4(c, msg + 4);
+    c = (c << 8) ^ t[(c >> 24) ^ msg[8]];
+    c = (c << 8) ^ t[(c >> 24) ^ msg[9]];
+    c = (c << 8) ^ t[(c >> 24) ^ msg[10]];
+    *long_syndrome = (c >> 8) ^ crcParity(msg + 11);
+}
+
 static struct errorinfo *bitErrorTable_short;
 static int bitErrorTableSize_short;
 
@@ -131,7 +146,7 @@ static int prepareSubtable(struct errorinfo *table, int n, int maxsize, int offs
 {
     int i = 0;
 
-    if (error_bit >= max_errors)
+    if (error_bit >= max_errors || error_bit >= MODES_MAX_BITERRORS)
         return n;
 
     for (i = startbit; i < endbit; ++i) {
@@ -351,11 +366,147 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
     return table;
 }
 
-// Precompute syndrome tables for 56- and 112-bit messages.
-void modesChecksumInit(int fixBits)
+// Syndrome index: a bucketized cuckoo hash over an error table, so that
+// modesChecksumDiagnose() can find a syndrome by examining at most two
+// cache-line-sized buckets, instead of a bsearch over the whole table.
+//
+// Each syndrome lives in one of two buckets chosen by two multiplicative
+// hashes. A zero syndrome marks an empty slot (a zero syndrome means "no
+// errors" and never needs to be looked up).
+
+#define SYNDROME_BUCKET_SLOTS 8
+#define SYNDROME_MAX_KICKS 500
+
+struct syndrome_bucket {
+    uint32_t syndrome[SYNDROME_BUCKET_SLOTS];  // syndromes in this bucket, 0 = empty
+    uint32_t entry[SYNDROME_BUCKET_SLOTS];     // corresponding index into the error table
+} __attribute__ ((aligned (64)));
+
+struct syndrome_index {
+    struct syndrome_bucket *buckets;
+    unsigned shift;                            // 32 - log2(number of buckets)
+    struct errorinfo *table;                   // the indexed error table
+};
+
+static struct syndrome_index syndromeIndex_short;
+static struct syndrome_index syndromeIndex_long;
+
+static inline uint32_t syndromeHash1(const struct syndrome_index *index, uint32_t syndrome)
 {
-    initLookupTables();
+    return (syndrome * 0x9E3779B1U) >> index->shift;
+}
+
+static inline uint32_t syndromeHash2(const struct syndrome_index *index, uint32_t syndrome)
+{
+    return ((syndrome ^ (syndrome >> 13)) * 0x85EBCA77U) >> index->shift;
+}
+
+// Try to put a syndrome into an empty slot of a bucket
+static bool bucketInsert(struct syndrome_bucket *bucket, uint32_t syndrome, uint32_t entry)
+{
+    for (unsigned i = 0; i < SYNDROME_BUCKET_SLOTS; ++i) {
+        if (!bucket->syndrome[i]) {
+            bucket->syndrome[i] = syndrome;
+            bucket->entry[i] = entry;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Insert a syndrome, displacing existing entries to their alternate
+// bucket as needed. Returns false if the index is too full.
+static bool indexInsert(struct syndrome_index *index, uint32_t syndrome, uint32_t entry)
+{
+    uint32_t from = UINT32_MAX;
+
+    for (unsigned kick = 0; kick < SYNDROME_MAX_KICKS; ++kick) {
+        uint32_t b1 = syndromeHash1(index, syndrome);
+        uint32_t b2 = syndromeHash2(index, syndrome);
+
+        if (bucketInsert(&index->buckets[b1], syndrome, entry) || bucketInsert(&index->buckets[b2], syndrome, entry))
+            return true;
+
+        // Both buckets full; evict something from the bucket we didn't just come from
+        uint32_t victim_bucket = (b1 == from ? b2 : b1);
+        struct syndrome_bucket *bucket = &index->buckets[victim_bucket];
+        unsigned slot = (syndrome + kick) % SYNDROME_BUCKET_SLOTS;
+
+        uint32_t evicted_syndrome = bucket->syndrome[slot];
+        uint32_t evicted_entry = bucket->entry[slot];
+        bucket->syndrome[slot] = syndrome;
+        bucket->entry[slot] = entry;
+
+        syndrome = evicted_syndrome;
+        entry = evicted_entry;
+        from = victim_bucket;
+    }
+
+    return false;
+}
+
+// Build an index over a sorted, collision-free error table
+static void prepareSyndromeIndex(struct syndrome_index *index, struct errorinfo *table, int tablesize)
+{
+    free(index->buckets);
+    index->buckets = NULL;
+    index->table = table;
+
+    if (!table || !tablesize)
+        return;
+
+    // start at a load factor of at most 7/8, grow if insertion fails
+    unsigned log2_buckets = 1;
+    while ((unsigned) (SYNDROME_BUCKET_SLOTS * 7 / 8) << log2_buckets < (unsigned) tablesize)
+        ++log2_buckets;
+
+    for (;; ++log2_buckets) {
+        size_t nbuckets = (size_t)1 << log2_buckets;
+
+        if (!(index->buckets = aligned_alloc(64, nbuckets * sizeof(struct syndrome_bucket)))) {
+            fprintf(stderr, "prepareSyndromeIndex: out of memory\n");
+            abort();
+        }
+        memset(index->buckets, 0, nbuckets * sizeof(struct syndrome_bucket));
+        index->shift = 32 - log2_buckets;
+
+        bool ok = true;
+        for (int i = 0; i < tablesize && ok; ++i) {
+            if (table[i].syndrome)
+                ok = indexInsert(index, table[i].syndrome, i);
+        }
+
+        if (ok)
+            return;
+
+        free(index->buckets);
+        index->buckets = NULL;
+    }
+}
+
+static inline struct errorinfo *indexLookup(const struct syndrome_index *index, uint32_t syndrome)
+{
+    if (!index->buckets)
+        return NULL;
+
+    const struct syndrome_bucket *bucket = &index->buckets[syndromeHash1(index, syndrome)];
+    for (unsigned i = 0; i < SYNDROME_BUCKET_SLOTS; ++i) {
+        if (bucket->syndrome[i] == syndrome)
+            return &index->table[bucket->entry[i]];
+    }
+
+    bucket = &index->buckets[syndromeHash2(index, syndrome)];
+    for (unsigned i = 0; i < SYNDROME_BUCKET_SLOTS; ++i) {
+        if (bucket->syndrome[i] == syndrome)
+            return &index->table[bucket->entry[i]];
+    }
+
+    return NULL;
+}
 
+// Generate the error tables for the given correction level
+static void prepareErrorTables(int fixBits)
+{
     switch (fixBits) {
     case 0:
         bitErrorTable_short = bitErrorTable_long = NULL;
@@ -380,20 +531,351 @@ void modesChecksumInit(int fixBits)
     }
 }
 
+// On-disk cache of the error tables, so that startup does not need to
+// regenerate them every time (this takes a while with 2-bit correction on
+// slow CPUs). The file is a header followed by the short and long tables,
+// and is mapped read-only and used in place.
+
+#define ERROR_CACHE_MAGIC "dump1090 crc\n\0\0\0"
+#define ERROR_CACHE_VERSION 1        // bump whenever prepareErrorTable's output changes
+#define ERROR_CACHE_BYTE_ORDER 0x01020304U
+
+struct error_cache_header {
+    char magic[16];                  // ERROR_CACHE_MAGIC
+    uint32_t version;                // ERROR_CACHE_VERSION
+    uint32_t byte_order;             // ERROR_CACHE_BYTE_ORDER, in native byte order
+    uint32_t entry_size;             // sizeof(struct errorinfo)
+    uint32_t max_biterrors;          // MODES_MAX_BITERRORS
+    uint32_t fix_bits;               // the fixBits value the tables were built for
+    uint32_t short_count;            // number of entries in the short table
+    uint32_t long_count;             // number of entries in the long table
+    uint32_t reserved;               // zero
+    uint64_t checksum;               // FNV-1a hash of both tables
+};
+
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= p[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static uint64_t errorCacheChecksum(const struct errorinfo *short_table, uint32_t short_count, const struct errorinfo *long_table, uint32_t long_count)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    hash = fnv1a(hash, short_table, short_count * sizeof(struct errorinfo));
+    hash = fnv1a(hash, long_table, long_count * sizeof(struct errorinfo));
+    return hash;
+}
+
+// Check that every entry of a loaded error table could have come from
+// prepareErrorTable for a "bits"-bit message, so that modesChecksumFix
+// never touches a bit outside the message.
+static bool validErrorTable(const struct errorinfo *table, uint32_t count, int bits, int fixBits)
+{
+    for (uint32_t i = 0; i < count; ++i) {
+        const struct errorinfo *ei = &table[i];
+        if (ei->errors < 1 || ei->errors > fixBits || ei->errors > MODES_MAX_BITERRORS)
+            return false;
+        for (int j = 0; j < ei->errors; ++j) {
+            if (ei->bit[j] < 0 || ei->bit[j] >= bits)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Try to map the error tables from a cache file. Returns true and sets up
+// bitErrorTable_short / bitErrorTable_long on success.
+static bool loadErrorCache(const char *path, int fixBits)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT)
+            fprintf(stderr, "%s: can't open CRC table cache: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        fprintf(stderr, "%s: can't stat CRC table cache: %s\n", path, strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    size_t size = st.st_size;
+    if (size < sizeof(struct error_cache_header)) {
+        fprintf(stderr, "%s: CRC table cache is truncated, ignoring it\n", path);
+        close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "%s: can't map CRC table cache: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    const struct error_cache_header *header = mapping;
+
+    if (memcmp(header->magic, ERROR_CACHE_MAGIC, sizeof(header->magic)) ||
+        header->version != ERROR_CACHE_VERSION ||
+        header->byte_order != ERROR_CACHE_BYTE_ORDER ||
+        header->entry_size != sizeof(struct errorinfo) ||
+        header->max_biterrors != MODES_MAX_BITERRORS ||
+        header->fix_bits != (uint32_t) fixBits) {
+        // not an error; e.g. the correction level changed, just regenerate
+        munmap(mapping, size);
+        return false;
+    }
+
+    // Check the counts against the file size before using them for any
+    // pointer arithmetic; written this way, nothing can overflow even with
+    // a 32-bit size_t
+    size_t max_entries = (size - sizeof(*header)) / sizeof(struct errorinfo);
+    if (header->short_count > max_entries ||
+        header->long_count > max_entries - header->short_count ||
+        size != sizeof(*header) + ((size_t)header->short_count + header->long_count) * sizeof(struct errorinfo)) {
+        fprintf(stderr, "%s: CRC table cache is corrupt, ignoring it\n", path);
+        munmap(mapping, size);
+        return false;
+    }
+
+    struct errorinfo *short_table = (struct errorinfo *) (header + 1);
+    struct errorinfo *long_table = short_table + header->short_count;
+
+    if (header->checksum != errorCacheChecksum(short_table, header->short_count, long_table, header->long_count) ||
+        !validErrorTable(short_table, header->short_count, MODES_SHORT_MSG_BITS, fixBits) ||
+        !validErrorTable(long_table, header->long_count, MODES_LONG_MSG_BITS, fixBits)) {
+        fprintf(stderr, "%s: CRC table cache is corrupt, ignoring it\n", path);
+        munmap(mapping, size);
+        return false;
+    }
+
+    // The mapping stays in place for the life of the process, like the
+    // generated tables would.
+    bitErrorTable_short = header->short_count ? short_table : NULL;
+    bitErrorTableSize_short = header->short_count;
+    bitErrorTable_long = header->long_count ? long_table : NULL;
+    bitErrorTableSize_long = header->long_count;
+    return true;
+}
+
+// Write the current error tables to a cache file, atomically replacing
+// any existing file. Failure is not fatal.
+static void writeErrorCache(const char *path, int fixBits)
+{
+    char temp_path[PATH_MAX];
+    if (snprintf(temp_path, sizeof(temp_path), "%s.tmp%d", path, (int) getpid()) >= (int) sizeof(temp_path)) {
+        fprintf(stderr, "%s: CRC table cache path is too long\n", path);
+        return;
+    }
+
+    struct error_cache_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ERROR_CACHE_MAGIC, sizeof(header.magic));
+    header.version = ERROR_CACHE_VERSION;
+    header.byte_order = ERROR_CACHE_BYTE_ORDER;
+    header.entry_size = sizeof(struct errorinfo);
+    header.max_biterrors = MODES_MAX_BITERRORS;
+    header.fix_bits = fixBits;
+    header.short_count = bitErrorTableSize_short;
+    header.long_count = bitErrorTableSize_long;
+    header.checksum = errorCacheChecksum(bitErrorTable_short, header.short_count, bitErrorTable_long, header.long_count);
+
+    FILE *f = fopen(temp_path, "wb");
+    if (!f)
+        goto fail;
+
+    bool ok = (fwrite(&header, sizeof(header), 1, f) == 1);
+    if (ok && header.short_count)
+        ok = (fwrite(bitErrorTable_short, sizeof(struct errorinfo), header.short_count, f) == header.short_count);
+    if (ok && header.long_count)
+        ok = (fwrite(bitErrorTable_long, sizeof(struct errorinfo), header.long_count, f) == header.long_count);
+    if (fclose(f) != 0)
+        ok = false;
+
+    if (ok && rename(temp_path, path) == 0)
+        return;
+
+ fail:
+    fprintf(stderr, "%s: can't write CRC table cache: %s\n", path, strerror(errno));
+    unlink(temp_path);
+}
+
+// Precompute syndrome tables for 56- and 112-bit messages.
+// If cachePath is not NULL, try to load them from that file first, and
+// write them to it if they had to be generated.
+void modesChecksumInit(int fixBits, const char *cachePath)
+{
+    initLookupTables();
+
+    if (fixBits <= 0 || !cachePath || !loadErrorCache(cachePath, fixBits)) {
+        prepareErrorTables(fixBits);
+        if (fixBits > 0 && cachePath)
+            writeErrorCache(cachePath, fixBits);
+    }
+
+    prepareSyndromeIndex(&syndromeIndex_short, bitErrorTable_short, bitErrorTableSize_short);
+    prepareSyndromeIndex(&syndromeIndex_long, bitErrorTable_long, bitErrorTableSize_long);
+}
+
 // Given an error syndrome and message length, return
 // an error-correction descriptor, or NULL if the
 // syndrome is uncorrectable
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
+{
+    if (syndrome == 0)
+        return &NO_ERRORS;
+
+    assert (bitlen == 56 || bitlen == 112);
+    return indexLookup(bitlen == 56 ? &syndromeIndex_short : &syndromeIndex_long, syndrome);
+}
+
+// Given a message and an error-correction descriptor,
+// apply the error correction to the given message.
+void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
+{
+    int i;
+
+    if (!info)
+        return;
+
+    for (i = 0; i < info->errors; ++i)
+        msg[info->bit[i] >> 3] ^= 1 << (7 - (info->bit[i] & 7));
+}
+
+#ifdef CRCDEBUG
+// bit-at-a-time reference CRC
+static uint32_t referenceChecksum(const uint8_t *msg, int bits)
+{
+    uint32_t rem = 0;
+    int n = bits/8;
+    int i, j;
+
+    for (i = 0; i < n-3; ++i) {
+        rem ^= msg[i] << 16;
+        for (j = 0; j < 8; ++j) {
+            if (rem & 0x800000)
+                rem = (rem<<1) ^ MODES_GENERATOR_POLY;
+            else
+                rem = (rem<<1);
+        }
+        rem = rem & 0xffffff;
+    }
+
+    return rem ^ (msg[n-3] << 16) ^ (msg[n-2] << 8) ^ (msg[n-1]);
+}
+
+// Check every supported CRC implementation against the reference,
+// then measure the throughput of each on random short and long messages
+static int benchmarkChecksum()
+{
+    const unsigned count = 65536;
+    uint8_t *messages = malloc(count * MODES_LONG_MSG_BYTES);
+    int failed = 0;
+    unsigned i;
+
+    srand(1);
+    for (i = 0; i < count * MODES_LONG_MSG_BYTES; ++i)
+        messages[i] = rand();
+
+    initLookupTables();
+
+    for (starch_crc_modes_u8_regentry *entry = starch_crc_modes_u8_registry; entry->name; ++entry) {
+        if (entry->flavor_supported && !entry->flavor_supported()) {
+            fprintf(stderr, "%-24s unsupported\n", entry->name);
+            continue;
+        }
+
+        bool okay = true;
+        for (i = 0; i < count && okay; ++i) {
+            const uint8_t *msg = messages + i * MODES_LONG_MSG_BYTES;
+            int bits = (i & 1) ? MODES_LONG_MSG_BITS : MODES_SHORT_MSG_BITS;
+            uint32_t rem;
+
+            entry->callable(msg, bits / 8, &rem);
+            if (rem != referenceChecksum(msg, bits)) {
+                fprintf(stderr, "%-24s FAILED: %d-bit message %u: got %06X expected %06X\n", entry->name, bits, i, rem, referenceChecksum(msg, bits));
+                okay = false;
+            }
+        }
+
+        if (!okay) {
+            failed = 1;
+            continue;
+        }
+
+        fprintf(stderr, "%-24s", entry->name);
+        for (int bits = MODES_SHORT_MSG_BITS; bits <= MODES_LONG_MSG_BITS; bits += MODES_LONG_MSG_BITS - MODES_SHORT_MSG_BITS) {
+            struct timespec start, end;
+            unsigned passes = 0;
+            double elapsed;
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            do {
+                for (i = 0; i < count; ++i) {
+                    uint32_t rem;
+                    entry->callable(messages + i * MODES_LONG_MSG_BYTES, bits / 8, &rem);
+                }
+                ++passes;
+                clock_gettime(CLOCK_MONOTONIC, &end);
+                elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+            } while (elapsed < 0.5);
+
+            fprintf(stderr, "  %3d-bit: %7.2f Mmsg/s %7.1f MB/s",
+                    bits, passes * count / elapsed / 1e6, passes * count * (bits / 8) / elapsed / 1e6);
+        }
+        fprintf(stderr, "\n");
+    }
+
+    // Both syndromes at once, versus two separate modesChecksum() calls
+    static volatile uint32_t sink;
+    for (int both = 0; both < 2; ++both) {
+        struct timespec start, end;
+        unsigned passes = 0;
+        double elapsed;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        do {
+            for (i = 0; i < count; ++i) {
+                const uint8_t *msg = messages + i * MODES_LONG_MSG_BYTES;
+                uint32_t short_syndrome, long_syndrome;
+                if (both) {
+                    modesChecksumBoth(msg, &short_syndrome, &long_syndrome);
+                } else {
+                    short_syndrome = modesChecksum(msg, MODES_SHORT_MSG_BITS);
+                    long_syndrome = modesChecksum(msg, MODES_LONG_MSG_BITS);
+                }
+                sink ^= short_syndrome ^ long_syndrome;
+            }
+            ++passes;
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        } while (elapsed < 0.5);
+
+        fprintf(stderr, "%-24s   both syndromes: %7.2f Mmsg/s\n",
+                both ? "modesChecksumBoth" : "modesChecksum x2", passes * count / elapsed / 1e6);
+    }
+
+    free(messages);
+    return failed;
+}
+
+// The previous modesChecksumDiagnose() implementation, for comparison
+static struct errorinfo *diagnoseBsearch(uint32_t syndrome, int bitlen)
 {
     struct errorinfo *table;
     int tablesize;
-
     struct errorinfo ei;
 
     if (syndrome == 0)
         return &NO_ERRORS;
 
-    assert (bitlen == 56 || bitlen == 112);
     if (bitlen == 56) { table = bitErrorTable_short; tablesize = bitErrorTableSize_short; }
     else { table = bitErrorTable_long; tablesize = bitErrorTableSize_long; }
 
@@ -404,28 +886,156 @@ struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
     return bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
 }
 
-// Given a message and an error-correction descriptor,
-// apply the error correction to the given message.
-void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
+static double timeDiagnose(struct errorinfo *(*diagnose)(uint32_t, int), const uint32_t *syndromes, const int *bitlens, unsigned count, unsigned *found)
 {
-    int i;
+    struct timespec start, end;
+    unsigned passes = 0;
+    double elapsed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        *found = 0;
+        for (unsigned i = 0; i < count; ++i) {
+            if (diagnose(syndromes[i], bitlens[i]))
+                ++*found;
+        }
+        ++passes;
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    } while (elapsed < 1.0);
 
-    if (!info)
-        return;
+    return elapsed * 1e9 / passes / count;
+}
 
-    for (i = 0; i < info->errors; ++i)
-        msg[info->bit[i] >> 3] ^= 1 << (7 - (info->bit[i] & 7));
+// Check modesChecksumBoth() against modesChecksum() on random messages
+static int testChecksumBoth()
+{
+    uint8_t msg[MODES_LONG_MSG_BYTES];
+    int failed = 0;
+
+    initLookupTables();
+
+    srand(1);
+    for (unsigned i = 0; i < 1000000 && !failed; ++i) {
+        for (unsigned j = 0; j < sizeof(msg); ++j)
+            msg[j] = rand();
+
+        uint32_t short_syndrome, long_syndrome;
+        modesChecksumBoth(msg, &short_syndrome, &long_syndrome);
+
+        uint32_t expected_short = modesChecksum(msg, MODES_SHORT_MSG_BITS);
+        uint32_t expected_long = modesChecksum(msg, MODES_LONG_MSG_BITS);
+        if (short_syndrome != expected_short || long_syndrome != expected_long) {
+            fprintf(stderr, "testChecksumBoth: FAIL: message %u: got %06X/%06X, expected %06X/%06X\n",
+                    i, short_syndrome, long_syndrome, expected_short, expected_long);
+            failed = 1;
+        }
+    }
+
+    if (!failed)
+        fprintf(stderr, "testChecksumBoth: PASS\n");
+    return failed;
+}
+
+// Compare the syndrome index against bsearch over a recorded distribution
+// of modesChecksumDiagnose() calls: a text file with one "<bitlen> <hex syndrome>"
+// pair per line.
+static int benchmarkDiagnose(int fixBits, const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+
+    unsigned count = 0, allocated = 0;
+    uint32_t *syndromes = NULL;
+    int *bitlens = NULL;
+    int bitlen;
+    unsigned syndrome;
+    while (fscanf(f, "%d %x", &bitlen, &syndrome) == 2) {
+        if (bitlen != 56 && bitlen != 112)
+            continue;
+        if (count == allocated) {
+            allocated = allocated ? allocated * 2 : 65536;
+            syndromes = realloc(syndromes, allocated * sizeof(*syndromes));
+            bitlens = realloc(bitlens, allocated * sizeof(*bitlens));
+            if (!syndromes || !bitlens) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+        }
+        syndromes[count] = syndrome;
+        bitlens[count] = bitlen;
+        ++count;
+    }
+    fclose(f);
+
+    if (!count) {
+        fprintf(stderr, "%s: no syndromes found\n", path);
+        return 1;
+    }
+
+    modesChecksumInit(fixBits, NULL);
+
+    // every table entry, and every recorded syndrome, must give the same answer both ways
+    for (int i = 0; i < bitErrorTableSize_short; ++i) {
+        if (modesChecksumDiagnose(bitErrorTable_short[i].syndrome, 56) != diagnoseBsearch(bitErrorTable_short[i].syndrome, 56)) {
+            fprintf(stderr, "FAILED: 56-bit syndrome %06X\n", bitErrorTable_short[i].syndrome);
+            return 1;
+        }
+    }
+    for (int i = 0; i < bitErrorTableSize_long; ++i) {
+        if (modesChecksumDiagnose(bitErrorTable_long[i].syndrome, 112) != diagnoseBsearch(bitErrorTable_long[i].syndrome, 112)) {
+            fprintf(stderr, "FAILED: 112-bit syndrome %06X\n", bitErrorTable_long[i].syndrome);
+            return 1;
+        }
+    }
+    for (unsigned i = 0; i < count; ++i) {
+        if (modesChecksumDiagnose(syndromes[i], bitlens[i]) != diagnoseBsearch(syndromes[i], bitlens[i])) {
+            fprintf(stderr, "FAILED: %d-bit syndrome %06X\n", bitlens[i], syndromes[i]);
+            return 1;
+        }
+    }
+
+    unsigned found_bsearch, found_index;
+    double ns_bsearch = timeDiagnose(diagnoseBsearch, syndromes, bitlens, count, &found_bsearch);
+    double ns_index = timeDiagnose(modesChecksumDiagnose, syndromes, bitlens, count, &found_index);
+
+    fprintf(stderr, "%u lookups (%u correctable), tables have %d short / %d long entries\n",
+            count, found_index, bitErrorTableSize_short, bitErrorTableSize_long);
+    fprintf(stderr, "  bsearch:        %6.1f ns/lookup\n", ns_bsearch);
+    fprintf(stderr, "  syndrome index: %6.1f ns/lookup\n", ns_index);
+
+    free(syndromes);
+    free(bitlens);
+    return 0;
 }
 
-#ifdef CRCDEBUG
 int main(int argc, char **argv)
 {
     int shortlen, longlen;
     int i;
     struct errorinfo *shorttable, *longtable;
 
+    if (argc == 2 && !strcmp(argv[1], "--benchmark")) {
+        return benchmarkChecksum();
+    }
+
+    if (argc == 2 && !strcmp(argv[1], "--test")) {
+        return testChecksumBoth();
+    }
+
+    if (argc == 4 && !strcmp(argv[1], "--diagnose-benchmark")) {
+        return benchmarkDiagnose(atoi(argv[2]), argv[3]);
+    }
+
     if (argc < 3) {
-        fprintf(stderr, "syntax: crctests <ncorrect> <ndetect>\n");
+        fprintf(stderr,
+                "syntax: crctests <ncorrect> <ndetect>\n"
+                "        crctests --test\n"
+                "        crctests --benchmark\n"
+                "        crctests --diagnose-benchmark <ncorrect> <syndrome file>\n");
         return 1;
     }
 
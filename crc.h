@@ -31,8 +31,10 @@ struct errorinfo {
     int8_t   bit[MODES_MAX_BITERRORS]; // bit positions to fix (-1 = no bit)
 };
 
-void modesChecksumInit(int fixBits);
+void modesChecksumInit(int fixBits, const char *cachePath);
 uint32_t modesChecksum(const uint8_t *msg, int bitlen);
+// Compute both the 56-bit and 112-bit syndromes of a 112-bit buffer in one pass
+void modesChecksumBoth(const uint8_t *msg, uint32_t *short_syndrome, uint32_t *long_syndrome);
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen);
 void modesChecksumFix(uint8_t *msg, struct errorinfo *info);
 
@@ -58,8 +58,117 @@ static inline int slice_phase4(uint16_t *m) {
     return m[0] + 5 * m[1] - 5 * m[2] - m[3];
 }
 
+// Slice one byte of a Mode S message starting at *pPtr with the given
+// phase offset, and advance *pPtr / *phase past it
+static inline uint8_t slice_byte(uint16_t **pPtr, int *phase)
+{
+    uint16_t *p = *pPtr;
+    uint8_t theByte = 0;
+
+    switch (*phase) {
+    case 0:
+        theByte =
+            (slice_phase0(p) > 0 ? 0x80 : 0) |
+            (slice_phase2(p+2) > 0 ? 0x40 : 0) |
+            (slice_phase4(p+4) > 0 ? 0x20 : 0) |
+            (slice_phase1(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase3(p+9) > 0 ? 0x08 : 0) |
+            (slice_phase0(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase2(p+14) > 0 ? 0x02 : 0) |
+            (slice_phase4(p+16) > 0 ? 0x01 : 0);
+
+        *phase = 1;
+        *pPtr += 19;
+        break;
+
+    case 1:
+        theByte =
+            (slice_phase1(p) > 0 ? 0x80 : 0) |
+            (slice_phase3(p+2) > 0 ? 0x40 : 0) |
+            (slice_phase0(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase2(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase4(p+9) > 0 ? 0x08 : 0) |
+            (slice_phase1(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase3(p+14) > 0 ? 0x02 : 0) |
+            (slice_phase0(p+17) > 0 ? 0x01 : 0);
+
+        *phase = 2;
+        *pPtr += 19;
+        break;
+
+    case 2:
+        theByte =
+            (slice_phase2(p) > 0 ? 0x80 : 0) |
+            (slice_phase4(p+2) > 0 ? 0x40 : 0) |
+            (slice_phase1(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase3(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase0(p+10) > 0 ? 0x08 : 0) |
+            (slice_phase2(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase4(p+14) > 0 ? 0x02 : 0) |
+            (slice_phase1(p+17) > 0 ? 0x01 : 0);
+
+        *phase = 3;
+        *pPtr += 19;
+        break;
+
+    case 3:
+        theByte =
+            (slice_phase3(p) > 0 ? 0x80 : 0) |
+            (slice_phase0(p+3) > 0 ? 0x40 : 0) |
+            (slice_phase2(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase4(p+7) > 0 ? 0x10 : 0) |
+            (slice_phase1(p+10) > 0 ? 0x08 : 0) |
+            (slice_phase3(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase0(p+15) > 0 ? 0x02 : 0) |
+            (slice_phase2(p+17) > 0 ? 0x01 : 0);
+
+        *phase = 4;
+        *pPtr += 19;
+        break;
+
+    case 4:
+        theByte =
+            (slice_phase4(p) > 0 ? 0x80 : 0) |
+            (slice_phase1(p+3) > 0 ? 0x40 : 0) |
+            (slice_phase3(p+5) > 0 ? 0x20 : 0) |
+            (slice_phase0(p+8) > 0 ? 0x10 : 0) |
+            (slice_phase2(p+10) > 0 ? 0x08 : 0) |
+            (slice_phase4(p+12) > 0 ? 0x04 : 0) |
+            (slice_phase1(p+15) > 0 ? 0x02 : 0) |
+            (slice_phase3(p+17) > 0 ? 0x01 : 0);
+
+        *phase = 0;
+        *pPtr += 20;
+        break;
+    }
+
+    return theByte;
+}
+
+//
+// Pass a message from the local demodulator on to useModesMessage(), either
+// directly or (with --io-thread) via the I/O thread
+//
+static void useDemodulatedMessage(struct modesMessage *mm) {
+    // With several receivers, only the first copy of a message goes on
+    if (Modes.receiver_count && receiverDuplicate(mm))
+        return;
+
+    if (!Modes.io_thread_enabled) {
+        useModesMessage(mm);
+        return;
+    }
+
+    // When reading from a file, there's no realtime deadline to meet, so
+    // wait for the I/O thread to catch up rather than dropping messages
+    if (!io_queue_put(mm, Modes.sdr_type == SDR_IFILE)) {
+        ++Modes.demod_stats->messages_dropped;
+    }
+}
+
 static uint32_t valid_df_short_bitset;        // set of acceptable DF values for short messages
 static uint32_t valid_df_long_bitset;         // set of acceptable DF values for long messages
+static score_rank df_max_score[32];           // best score that scoreModesMessage could return, by uncorrected DF
 
 static uint32_t generate_damage_set(uint8_t df, unsigned damage_bits)
 {
@@ -75,7 +184,7 @@ static uint32_t generate_damage_set(uint8_t df, unsigned damage_bits)
     return result;
 }
 
-static void init_bitsets()
+void demodulate2400Init(void)
 {
     // DFs that we directly understand without correction
     valid_df_short_bitset = (1 << 0) | (1 << 4) | (1 << 5) | (1 << 11);
@@ -90,136 +199,203 @@ static void init_bitsets()
         valid_df_long_bitset |= generate_damage_set(17, Modes.nfix_crc);
         valid_df_long_bitset |= generate_damage_set(18, Modes.nfix_crc);
     }
+
+    // Upper bound on the score for each uncorrected DF, used by the staged
+    // demodulator to skip phases that can't beat the current best. This
+    // mirrors the set of DFs that correctMessage() will try to turn into
+    // DF11/17/18.
+    unsigned fix_df_bits = (Modes.fix_df ? Modes.nfix_crc : 0);
+    uint32_t correctable_long = generate_damage_set(17, fix_df_bits) | generate_damage_set(18, fix_df_bits);
+    uint32_t correctable_short = generate_damage_set(11, fix_df_bits ? 1 : 0);
+    for (unsigned df = 0; df < 32; ++df) {
+        if (correctable_long & (1 << df))
+            df_max_score[df] = SR_DF17_KNOWN;
+        else if (correctable_short & (1 << df))
+            df_max_score[df] = SR_DF11_ACQ_KNOWN;
+        else
+            df_max_score[df] = SR_UNRELIABLE_KNOWN;
+    }
 }
 
-//
-// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
-// try to demodulate some Mode S messages.
-//
-void demodulate2400(struct mag_buf *mag)
+// Store a demodulated (but not yet decoded) message in mag->messages
+static bool save_demod_message(struct mag_buf *mag, const struct demod_message *dm)
 {
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
-    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
-    uint32_t j;
-
-    static unsigned last_message_end = 0;
+    if (mag->message_count == mag->message_size) {
+        unsigned newsize = mag->message_size ? mag->message_size * 2 : 64;
+        struct demod_message *newmessages = realloc(mag->messages, newsize * sizeof(*newmessages));
+        if (!newmessages)
+            return false;
+        mag->messages = newmessages;
+        mag->message_size = newsize;
+    }
 
-    // initialize bitsets on first call
-    if (!valid_df_short_bitset)
-        init_bitsets();
+    mag->messages[mag->message_count++] = *dm;
+    return true;
+}
 
-    if (mag->flags & MAGBUF_DISCONTINUOUS) {
-        // gap, start from the very beginning
-        last_message_end = 0;
-    }
+//
+// Try to demodulate a Mode S message whose preamble starts at sample 'j' of
+// 'mag'. If there is one, fill in 'dm' (except for signalLevel) and return
+// CANDIDATE_OK. If there would be one, but only from an address that isn't
+// in the ICAO filter, fill in dm->start and return CANDIDATE_UNKNOWN_ICAO.
+// This depends only on the samples and the ICAO filter, not on where
+// earlier messages were found.
+//
+typedef enum {
+    CANDIDATE_NONE,
+    CANDIDATE_UNKNOWN_ICAO,
+    CANDIDATE_OK
+} candidate_result;
 
+static candidate_result demodulateCandidate(struct mag_buf *mag, uint32_t j, struct stats *stats, struct demod_message *dm)
+{
+    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg = msg1;
+    struct score_context ctx1, ctx2, *ctx = &ctx1;     // scoring results for msg1 / msg2
     unsigned char *bestmsg;
+    struct score_context *bestctx;
     int bestscore, bestphase;
-
-    // maximum lookahead we use
-    assert(mag->overlap >= 19 + 1 + 269);
-
     uint16_t *m = mag->data;
-    uint32_t mlen = mag->validLength - mag->overlap;
 
-    uint64_t sum_scaled_signal_power = 0;
-
-    msg = msg1;
+    uint16_t *preamble = &m[j];
+    int high;
+    uint32_t base_signal, base_noise;
+    int try_phase;
+
+    // Look for a message starting at around sample 0 with phase offset 3..7
+
+    // Ideal sample values for preambles with different phase
+    // Xn is the first data symbol with phase offset N
+    //
+    // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
+    // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
+    // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
+    // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
+    // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
+    // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
+    //
+
+    if (preamble[1] > preamble[2] &&                                       // 1
+        preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
+        preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
+        preamble[10] < preamble[11]) {                                     // 11-12
+        // peaks at 1,3,9,11-12: phase 3
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9];
+        base_noise = preamble[5] + preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
+               preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3,9,12: phase 4
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
+               preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3-4,9-10,12: phase 5
+        high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[12];
+        base_noise = preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                 // 1
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1,4,10,12: phase 6
+        high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[2] > preamble[3] &&                                 // 1-2
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1-2,4,10,12: phase 7
+        high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[6] + preamble[7] + preamble[8];
+    } else {
+        // no suitable peaks
+        return CANDIDATE_NONE;
+    }
 
-    // sanity check
-    if (last_message_end > mlen)
-        last_message_end = mlen;
+    // Check for enough signal
+    if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
+        return CANDIDATE_NONE;
+
+    // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
+    if (preamble[5] >= high ||
+        preamble[6] >= high ||
+        preamble[7] >= high ||
+        preamble[8] >= high ||
+        preamble[14] >= high ||
+        preamble[15] >= high ||
+        preamble[16] >= high ||
+        preamble[17] >= high ||
+        preamble[18] >= high) {
+        return CANDIDATE_NONE;
+    }
 
-    for (j = last_message_end; j < mlen; j++) {
-        uint16_t *preamble = &m[j];
-        int high;
-        uint32_t base_signal, base_noise;
-        int try_phase;
-        int msglen;
+    // try all phases
+    stats->demod_preambles++;
+    bestmsg = NULL; bestctx = NULL; bestscore = SR_NOT_SET; bestphase = -1;
+
+    if (Modes.demod_strategy == DEMOD_STAGED) {
+        // Slice only the first byte for each phase and discard phases
+        // with an unusable DF, then slice and score the remaining phases,
+        // skipping those whose DF can't produce a better score than the
+        // best we already have.
+        uint16_t *stage_ptr[5];
+        int stage_phase[5];
+        uint8_t stage_first[5];
+        unsigned stage_bytelen[5];
+        score_rank stage_max[5];
+
+        for (unsigned k = 0; k < 5; ++k) {
+            try_phase = k + 4;
+            stage_ptr[k] = &m[j+19] + (try_phase/5);
+            stage_phase[k] = try_phase % 5;
+            stage_first[k] = slice_byte(&stage_ptr[k], &stage_phase[k]);
+
+            unsigned df = stage_first[k] >> 3;
+            if (valid_df_long_bitset & (1 << df))
+                stage_bytelen[k] = MODES_LONG_MSG_BYTES;
+            else if (valid_df_short_bitset & (1 << df))
+                stage_bytelen[k] = MODES_SHORT_MSG_BYTES;
+            else
+                stage_bytelen[k] = 0;
 
-        // Look for a message starting at around sample 0 with phase offset 3..7
+            if (stage_bytelen[k]) {
+                stage_max[k] = df_max_score[df];
+            } else {
+                stage_max[k] = SR_NOT_SET;
+                // rejected early by the DF filter
+                stats->demod_rejected_bad++;
+            }
+        }
 
-        // Ideal sample values for preambles with different phase
-        // Xn is the first data symbol with phase offset N
-        //
-        // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
-        // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
-        // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
-        // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
-        // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
-        // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
-        //
+        for (unsigned k = 0; k < 5; ++k) {
+            int score;
 
-        // quick check: we must have a rising edge 0->1 and a falling edge 12->13
-        if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
-           continue;
-
-        if (preamble[1] > preamble[2] &&                                       // 1
-            preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
-            preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
-            preamble[10] < preamble[11]) {                                     // 11-12
-            // peaks at 1,3,9,11-12: phase 3
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9];
-            base_noise = preamble[5] + preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
-                   preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3,9,12: phase 4
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
-                   preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3-4,9-10,12: phase 5
-            high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[12];
-            base_noise = preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                 // 1
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1,4,10,12: phase 6
-            high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[2] > preamble[3] &&                                 // 1-2
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1-2,4,10,12: phase 7
-            high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[6] + preamble[7] + preamble[8];
-        } else {
-            // no suitable peaks
-            continue;
-        }
+            // (a later phase must score strictly higher to replace an earlier one)
+            if ((int) stage_max[k] <= bestscore)
+                continue;
 
-        // Check for enough signal
-        if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
-            continue;
+            msg[0] = stage_first[k];
+            for (unsigned i = 1; i < stage_bytelen[k]; ++i)
+                msg[i] = slice_byte(&stage_ptr[k], &stage_phase[k]);
 
-        // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
-        if (preamble[5] >= high ||
-            preamble[6] >= high ||
-            preamble[7] >= high ||
-            preamble[8] >= high ||
-            preamble[14] >= high ||
-            preamble[15] >= high ||
-            preamble[16] >= high ||
-            preamble[17] >= high ||
-            preamble[18] >= high) {
-            continue;
+            score = scoreModesMessage(msg, ctx);
+            if (score > bestscore) {
+                bestmsg = msg;
+                bestctx = ctx;
+                bestscore = score;
+                bestphase = k + 4;
+                msg = (msg == msg1) ? msg2 : msg1;
+                ctx = (ctx == &ctx1) ? &ctx2 : &ctx1;
+            }
         }
-
-        // try all phases
-        Modes.stats_current.demod_preambles++;
-        bestmsg = NULL; bestscore = SR_NOT_SET; bestphase = -1;
+    } else {
         for (try_phase = 4; try_phase <= 8; ++try_phase) {
             uint16_t *pPtr;
             int phase, score;
@@ -232,86 +408,7 @@ void demodulate2400(struct mag_buf *mag)
 
             unsigned bytelen = 1;
             for (unsigned i = 0; i < bytelen; ++i) {
-                uint8_t theByte = 0;
-
-                switch (phase) {
-                case 0:
-                    theByte =
-                        (slice_phase0(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase2(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase4(pPtr+4) > 0 ? 0x20 : 0) |
-                        (slice_phase1(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase3(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase0(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase2(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase4(pPtr+16) > 0 ? 0x01 : 0);
-
-
-                    phase = 1;
-                    pPtr += 19;
-                    break;
-
-                case 1:
-                    theByte =
-                        (slice_phase1(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase3(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase0(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase2(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase4(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase1(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase3(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase0(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 2;
-                    pPtr += 19;
-                    break;
-
-                case 2:
-                    theByte =
-                        (slice_phase2(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase4(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase1(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase3(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase0(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase2(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase4(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase1(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 3;
-                    pPtr += 19;
-                    break;
-
-                case 3:
-                    theByte =
-                        (slice_phase3(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase0(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase2(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase4(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase1(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase3(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase0(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase2(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 4;
-                    pPtr += 19;
-                    break;
-
-                case 4:
-                    theByte =
-                        (slice_phase4(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase1(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase3(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase0(pPtr+8) > 0 ? 0x10 : 0) |
-                        (slice_phase2(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase4(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase1(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase3(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 0;
-                    pPtr += 20;
-                    break;
-                }
-
+                uint8_t theByte = slice_byte(&pPtr, &phase);
                 msg[i] = theByte;
 
                 if (i == 0) {
@@ -327,15 +424,16 @@ void demodulate2400(struct mag_buf *mag)
 
             if (bytelen == 1) {
                 // rejected early by the DF filter
-                Modes.stats_current.demod_rejected_bad++;
+                stats->demod_rejected_bad++;
                 continue;
             }
 
             // Score the mode S message and see if it's any good.
-            score = scoreModesMessage(msg);
+            score = scoreModesMessage(msg, ctx);
             if (score > bestscore) {
                 // new high score!
                 bestmsg = msg;
+                bestctx = ctx;
                 bestscore = score;
                 bestphase = try_phase;
 
@@ -343,72 +441,182 @@ void demodulate2400(struct mag_buf *mag)
                 // (if we find a better result then we'll swap back, but that's OK because
                 // we no longer need this copy if we found a better one)
                 msg = (msg == msg1) ? msg2 : msg1;
+                ctx = (ctx == &ctx1) ? &ctx2 : &ctx1;
             }
         }
+    }
 
-        // Do we have a candidate?
-        if (bestscore < SR_ACCEPT_THRESHOLD) {
-            if (bestscore >= SR_UNKNOWN_THRESHOLD)
-                Modes.stats_current.demod_rejected_unknown_icao++;
-            else
-                Modes.stats_current.demod_rejected_bad++;
-            continue; // nope.
+    // Do we have a candidate?
+    if (bestscore < SR_ACCEPT_THRESHOLD) {
+        if (bestscore >= SR_UNKNOWN_THRESHOLD) {
+            stats->demod_rejected_unknown_icao++;
+            dm->start = j;
+            return CANDIDATE_UNKNOWN_ICAO;
         }
+        stats->demod_rejected_bad++;
+        return CANDIDATE_NONE; // nope.
+    }
 
-        msglen = modesMessageLenByType(bestmsg[0] >> 3);
+    int msglen = modesMessageLenByType(bestmsg[0] >> 3);
 
-        // Set initial mm structure details
-        mm = zeroMessage;
+    memcpy(dm->msg, bestmsg, sizeof(dm->msg));
+    dm->score = bestscore;
+    dm->ctx = *bestctx;
+    dm->start = j;
+    dm->end = j + (msglen + 8) * 12/5;
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the end of bit 56 (even if
-        // the frame is a 112-bit frame)
-        mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the end of bit 56 (even if
+    // the frame is a 112-bit frame)
+    dm->timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    dm->sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, dm->timestampMsg);
+    return CANDIDATE_OK;
+}
+
+//
+// Measure the signal power of the message described by 'dm', add it to
+// 'stats' and return the scaled power (the sum of squared magnitudes)
+//
+static uint64_t measureSignal(struct mag_buf *mag, struct demod_message *dm, struct stats *stats)
+{
+    double signal_power;
+    uint64_t scaled_signal_power = 0;
+    int signal_len = modesMessageLenByType(dm->msg[0] >> 3) * 12/5;
+    int k;
+
+    for (k = 0; k < signal_len; ++k) {
+        uint32_t mag_k = mag->data[dm->start+19+k];
+        scaled_signal_power += mag_k * mag_k;
+    }
+
+    signal_power = scaled_signal_power / 65535.0 / 65535.0;
+    dm->signalLevel = signal_power / signal_len;
+    stats->signal_power_sum += signal_power;
+    stats->signal_power_count += signal_len;
+
+    if (dm->signalLevel > stats->peak_signal_power)
+        stats->peak_signal_power = dm->signalLevel;
+    if (dm->signalLevel > 0.50119)
+        stats->strong_signal_count++; // signal power above -3dBFS
+
+    return scaled_signal_power;
+}
+
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
+// try to demodulate some Mode S messages.
+//
+// If 'deferred' is false, accepted messages are decoded and passed to
+// useDemodulatedMessage() immediately. If 'deferred' is true, they are stored in
+// mag->messages for later processing by demodulate2400Deliver(), and no
+// global state other than 'stats' is modified.
+//
+static void demodulate2400Internal(struct demod_state *state, struct mag_buf *mag, struct stats *stats, bool deferred)
+{
+    static const struct modesMessage zeroMessage;
+    struct modesMessage mm;
+    struct demod_message dm;
+    uint32_t j;
+
+    unsigned last_message_end = state->last_message_end;
+
+    if (mag->flags & MAGBUF_DISCONTINUOUS) {
+        // gap, start from the very beginning
+        last_message_end = 0;
+    }
 
-        mm.score = bestscore;
+    // maximum lookahead we use
+    assert(mag->overlap >= 19 + 1 + 269);
 
-        // Decode the received message
-        if (decodeModesMessage(&mm, bestmsg) < 0) {
-            Modes.stats_current.demod_rejected_bad++;
+    uint16_t *m = mag->data;
+    uint32_t mlen = mag->validLength - mag->overlap;
+
+    uint64_t sum_scaled_signal_power = 0;
+
+    // sanity check
+    if (last_message_end > mlen)
+        last_message_end = mlen;
+
+    // make sure we have space for the worst case number of preamble candidates
+    if (state->candidates_size < mlen) {
+        free(state->candidates);
+        if (!(state->candidates = malloc(mlen * sizeof(*state->candidates)))) {
+            fprintf(stderr, "demodulate2400: out of memory allocating preamble candidates\n");
+            state->candidates_size = 0;
+            return;
+        }
+        state->candidates_size = mlen;
+    }
+    uint32_t *candidates = state->candidates;
+
+    // Find all offsets that might be the start of a preamble. This only
+    // rejects offsets that can't pass any of the phase-specific tests in
+    // demodulateCandidate, so the remaining checks are unchanged.
+    unsigned candidate_count = 0;
+    uint32_t candidate_base = last_message_end;
+    starch_preamble_u16(&m[candidate_base], mlen - candidate_base, candidates, &candidate_count);
+
+    uint32_t next_j = candidate_base;
+    for (unsigned c = 0; c < candidate_count; ++c) {
+        j = candidate_base + candidates[c];
+        if (j < next_j)
+            continue; // inside a message we already decoded
+
+        candidate_result result = demodulateCandidate(mag, j, stats, &dm);
+        if (result == CANDIDATE_UNKNOWN_ICAO && deferred) {
+            // The ICAO filter may have learned this address by the time the
+            // message is delivered (e.g. from an earlier message in this or
+            // the previous buffer); let demodulate2400Deliver() decide. Carry
+            // on scanning as if it was rejected.
+            dm.unknown_icao = true;
+            if (!save_demod_message(mag, &dm))
+                fprintf(stderr, "demodulate2400: out of memory saving demodulated message\n");
             continue;
-        } else {
-            Modes.stats_current.demod_accepted[mm.correctedbits]++;
         }
+        if (result != CANDIDATE_OK)
+            continue;
+        dm.unknown_icao = false;
 
-        // measure signal power
-        {
-            double signal_power;
-            uint64_t scaled_signal_power = 0;
-            int signal_len = msglen*12/5;
-            int k;
-
-            for (k = 0; k < signal_len; ++k) {
-                uint32_t mag = m[j+19+k];
-                scaled_signal_power += mag * mag;
+        // Set initial mm structure details
+        mm = zeroMessage;
+        mm.timestampMsg = dm.timestampMsg;
+        mm.sysTimestampMsg = dm.sysTimestampMsg;
+        mm.score = dm.score;
+
+        // Decode the received message (deferred messages are decoded in demodulate2400Deliver)
+        if (!deferred) {
+            stats->demod_crc_saved += dm.ctx.crc_ops;
+            if (decodeModesMessage(&mm, dm.msg, &dm.ctx) < 0) {
+                stats->demod_rejected_bad++;
+                continue;
+            } else {
+                stats->demod_accepted[mm.correctedbits]++;
             }
+        }
 
-            signal_power = scaled_signal_power / 65535.0 / 65535.0;
-            mm.signalLevel = signal_power / signal_len;
-            Modes.stats_current.signal_power_sum += signal_power;
-            Modes.stats_current.signal_power_count += signal_len;
-            sum_scaled_signal_power += scaled_signal_power;
+        // measure signal power
+        sum_scaled_signal_power += measureSignal(mag, &dm, stats);
+        mm.signalLevel = dm.signalLevel;
 
-            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
-                Modes.stats_current.peak_signal_power = mm.signalLevel;
-            if (mm.signalLevel > 0.50119)
-                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
-        }
+        if (deferred) {
+            if (!save_demod_message(mag, &dm)) {
+                fprintf(stderr, "demodulate2400: out of memory saving demodulated message\n");
+                stats->demod_rejected_bad++;
+                continue;
+            }
 
-        // Feed "empty" sample to adaptive gain logic
-        if (j > last_message_end)
-            adaptive_update(&m[last_message_end], j - last_message_end, NULL);
+            last_message_end = dm.end;
+        } else {
+            // Feed "empty" sample to adaptive gain logic
+            if (j > last_message_end)
+                adaptive_update(&m[last_message_end], j - last_message_end, NULL);
 
-        // Feed message samples to adaptive gain logic, update end pointer
-        last_message_end = j + (msglen + 8) * 12/5;
-        adaptive_update(&m[j], last_message_end - j, &mm);
+            // Feed message samples to adaptive gain logic, update end pointer
+            last_message_end = dm.end;
+            adaptive_update(&m[j], last_message_end - j, &mm);
+        }
 
         // Skip over the message:
         // (we actually skip to 8 bits before the end of the message,
@@ -416,24 +624,26 @@ void demodulate2400(struct mag_buf *mag)
         //  where the preamble of the second message clobbered the last
         //  few bits of the first message, but the message bits didn't
         //  overlap)
-        j = last_message_end - 8*12/5;
+        next_j = last_message_end - 8*12/5 + 1;
 
         // Pass data to the next layer
-        useModesMessage(&mm);
+        if (!deferred)
+            useDemodulatedMessage(&mm);
     }
 
     /* update noise power */
     {
         double sum_signal_power = sum_scaled_signal_power / 65535.0 / 65535.0;
-        Modes.stats_current.noise_power_sum += (mag->mean_power * mlen - sum_signal_power);
-        Modes.stats_current.noise_power_count += mlen;
+        stats->noise_power_sum += (mag->mean_power * mlen - sum_signal_power);
+        stats->noise_power_count += mlen;
     }
 
     // feed trailing empty samples to adaptive gain logic
     if (last_message_end < mlen) {
         // trailing data from end of last message to start of overlap;
         // on the next pass, start from the start of the overlap
-        adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
+        if (!deferred)
+            adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
         last_message_end = 0;
     } else {
         // last decoded message runs into the overlap region;
@@ -441,6 +651,191 @@ void demodulate2400(struct mag_buf *mag)
         // no trailing data to pass this time
         last_message_end -= mlen;
     }
+
+    state->last_message_end = last_message_end;
+}
+
+void demodulate2400(struct mag_buf *mag)
+{
+    static struct demod_state state;
+    demodulate2400Internal(&state, mag, Modes.demod_stats, false);
+}
+
+void demodulate2400Deferred(struct demod_state *state, struct mag_buf *mag)
+{
+    // Buffers may be handed to different threads, so we can't continue from
+    // where the last message in the previous buffer ended: scan from the
+    // start of the overlap. demodulate2400Deliver() discards messages that
+    // overlap ones already delivered, and rescans anything this skipped
+    // that the single-threaded demodulator would have looked at.
+    state->last_message_end = 0;
+    mag->message_count = 0;
+    demodulate2400Internal(state, mag, mag->stats, true);
+}
+
+// On the main thread, look for a message starting in [from, to) that
+// demodulate2400Deferred() skipped because it was inside a message that
+// turned out not to be delivered. Returns true and fills in 'dm' if one is
+// found.
+//
+// Like demodulate2400Internal(), only the offsets that pass
+// starch_preamble_u16 are tried, so the same preambles are accepted.
+static bool rescanSkipped(struct mag_buf *mag, uint32_t from, uint32_t to, struct demod_message *dm)
+{
+    uint32_t mlen = mag->validLength - mag->overlap;
+    if (to > mlen)
+        to = mlen;
+
+    // the skipped range is usually shorter than one message
+    uint32_t candidates[256];
+    for (uint32_t base = from; base < to; base += 256) {
+        unsigned len = (to - base < 256) ? to - base : 256;
+        unsigned candidate_count = 0;
+        starch_preamble_u16(&mag->data[base], len, candidates, &candidate_count);
+
+        for (unsigned c = 0; c < candidate_count; ++c) {
+            if (demodulateCandidate(mag, base + candidates[c], Modes.demod_stats, dm) == CANDIDATE_OK) {
+                measureSignal(mag, dm, Modes.demod_stats);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Deliver the messages in a buffer from "receiver"; *last_message_end_ptr
+// carries over where the last delivered message ended between that
+// receiver's buffers.
+//
+// The worker scanned the buffer from the start of the overlap, where the
+// single-threaded demodulator would have started at the end of the last
+// message delivered from the previous buffer. Where the two scans differ,
+// the worker may have skipped samples inside a message that isn't
+// delivered (it overlaps the previous buffer's last message, or fails to
+// decode); those are rescanned here, so the messages delivered are the
+// same as demodulate2400() would find.
+static void deliverMessages(struct mag_buf *mag, unsigned receiver, unsigned *last_message_end_ptr)
+{
+    unsigned last_message_end = *last_message_end_ptr;
+
+    // Adaptive gain only controls the primary SDR
+    bool primary = (receiver == 0);
+
+    if (mag->flags & MAGBUF_DISCONTINUOUS) {
+        // gap, start from the very beginning
+        last_message_end = 0;
+    }
+
+    uint16_t *m = mag->data;
+    uint32_t mlen = mag->validLength - mag->overlap;
+
+    if (last_message_end > mlen)
+        last_message_end = mlen;
+
+    // sink for the stats of messages the worker already counted
+    static struct stats rescored_stats;
+
+    uint32_t next_j = last_message_end;    // where the single-threaded scan would look next
+    uint32_t worker_next_j = 0;            // where the worker's scan continued after its last message
+    unsigned i = 0;
+    for (;;) {
+        struct demod_message rescanned, *dm;
+
+        while (i < mag->message_count && mag->messages[i].start < next_j) {
+            // overlaps a message that we already delivered
+            if (!mag->messages[i].unknown_icao) {
+                worker_next_j = mag->messages[i].end - 8*12/5 + 1;
+                Modes.demod_stats->demod_rejected_bad++;
+            }
+            ++i;
+        }
+
+        if (next_j < worker_next_j) {
+            // the worker skipped [next_j, worker_next_j)
+            if (!rescanSkipped(mag, next_j, worker_next_j, &rescanned)) {
+                next_j = worker_next_j;
+                continue;
+            }
+            dm = &rescanned;
+        } else if (i < mag->message_count && mag->messages[i].unknown_icao) {
+            // the worker's scan carried on past this; try it again with the
+            // ICAO filter as it is now. The worker already counted it.
+            if (demodulateCandidate(mag, mag->messages[i++].start, &rescored_stats, &rescanned) != CANDIDATE_OK)
+                continue;
+            Modes.demod_stats->demod_rejected_unknown_icao--;
+            measureSignal(mag, &rescanned, Modes.demod_stats);
+            dm = &rescanned;
+        } else if (i < mag->message_count) {
+            // the worker's scan and ours agree from here
+            dm = &mag->messages[i++];
+            worker_next_j = dm->end - 8*12/5 + 1;
+
+            if (dm->score < (int) df_max_score[dm->msg[0] >> 3]) {
+                // the ICAO filter may know more now than when the worker
+                // scored this; score it again, as demodulate2400() would
+                if (demodulateCandidate(mag, dm->start, &rescored_stats, &rescanned) != CANDIDATE_OK) {
+                    next_j = dm->start + 1;
+                    continue;
+                }
+                measureSignal(mag, &rescanned, &rescored_stats);
+                dm = &rescanned;
+            }
+        } else {
+            break;
+        }
+
+        struct modesMessage mm;
+        memset(&mm, 0, sizeof(mm));
+        // Each receiver has its own sample clock; only the primary SDR's
+        // clock is passed on (e.g. for multilateration)
+        mm.timestampMsg = primary ? dm->timestampMsg : 0;
+        mm.sysTimestampMsg = dm->sysTimestampMsg;
+        mm.receiver = receiver;
+        mm.signalLevel = dm->signalLevel;
+        mm.score = dm->score;
+
+        Modes.demod_stats->demod_crc_saved += dm->ctx.crc_ops;
+        if (decodeModesMessage(&mm, dm->msg, &dm->ctx) < 0) {
+            Modes.demod_stats->demod_rejected_bad++;
+            // the single-threaded scan would carry on from the next sample
+            next_j = dm->start + 1;
+            continue;
+        } else {
+            Modes.demod_stats->demod_accepted[mm.correctedbits]++;
+        }
+
+        // Feed samples to adaptive gain logic in the same way as demodulate2400()
+        if (primary && dm->start > last_message_end)
+            adaptive_update(&m[last_message_end], dm->start - last_message_end, NULL);
+        last_message_end = dm->end;
+        if (primary)
+            adaptive_update(&m[dm->start], dm->end - dm->start, &mm);
+        next_j = last_message_end - 8*12/5 + 1;
+
+        useDemodulatedMessage(&mm);
+    }
+
+    if (last_message_end < mlen) {
+        if (primary)
+            adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
+        last_message_end = 0;
+    } else {
+        last_message_end -= mlen;
+    }
+
+    *last_message_end_ptr = last_message_end;
+}
+
+void demodulate2400Deliver(struct mag_buf *mag)
+{
+    static unsigned last_message_end = 0;
+    deliverMessages(mag, 0, &last_message_end);
+}
+
+void demodulate2400DeliverReceiver(struct mag_buf *mag, unsigned receiver, unsigned *last_message_end)
+{
+    deliverMessages(mag, receiver, last_message_end);
 }
 
 #ifdef MODEAC_DEBUG
@@ -718,9 +1113,9 @@ void demodulate2400AC(struct mag_buf *mag)
         decodeModeAMessage(&mm, modeac);
 
         // Pass data to the next layer
-        useModesMessage(&mm);
+        useDemodulatedMessage(&mm);
 
         f1_sample += (20*87 / 25);
-        Modes.stats_current.demod_modeac++;
+        Modes.demod_stats->demod_modeac++;
     }
 }
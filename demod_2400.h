@@ -20,11 +20,48 @@
 #ifndef DUMP1090_DEMOD_2400_H
 #define DUMP1090_DEMOD_2400_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 struct mag_buf;
 
+// Per-thread demodulator state
+struct demod_state {
+    unsigned last_message_end;    // where the last decoded message ended, relative to the start of the next buffer
+    uint32_t *candidates;         // preamble candidate offsets
+    unsigned candidates_size;     // allocated size of candidates
+};
+
+// A Mode S message found by demodulate2400Deferred(), not yet decoded
+struct demod_message {
+    unsigned char msg[MODES_LONG_MSG_BYTES]; // message bytes, as demodulated
+    int score;                    // score from scoreModesMessage
+    struct score_context ctx;     // scoring context from scoreModesMessage
+    unsigned start;               // sample offset of the start of the preamble
+    unsigned end;                 // sample offset of the end of the message
+    uint64_t timestampMsg;        // 12MHz timestamp
+    uint64_t sysTimestampMsg;     // system timestamp
+    double signalLevel;           // RSSI, as a fraction of full-scale power
+    bool unknown_icao;            // only a possible message from an address not in the ICAO filter
+                                  // at the time; only 'start' is valid, and it is re-checked on delivery
+};
+
+void demodulate2400Init(void);
 void demodulate2400(struct mag_buf *mag);
 void demodulate2400AC(struct mag_buf *mag);
 
+// Demodulate a buffer without touching global state: messages go to
+// mag->messages and stats to mag->stats. Safe to call from multiple threads
+// with different states and buffers.
+void demodulate2400Deferred(struct demod_state *state, struct mag_buf *mag);
+
+// Decode and process the messages saved by demodulate2400Deferred().
+// Buffers must be passed in the order they were received.
+void demodulate2400Deliver(struct mag_buf *mag);
+
+// As demodulate2400Deliver(), for a buffer from additional receiver number
+// "receiver" (see receiver.h). *last_message_end holds that receiver's
+// delivery state between buffers; start it at 0.
+void demodulate2400DeliverReceiver(struct mag_buf *mag, unsigned receiver, unsigned *last_message_end);
+
 #endif
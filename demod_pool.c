@@ -0,0 +1,201 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demod_pool.c: Demodulator worker thread pool
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "dump1090.h"
+
+#include <assert.h>
+
+// Buffers are demodulated by whichever worker thread is free, and may
+// complete out of order; they are kept in a ring in submission order so
+// that the main thread can deliver results in sample order.
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;      // mutex protecting the pool state
+static pthread_cond_t pool_work_cond = PTHREAD_COND_INITIALIZER;    // condition used to signal new work (or shutdown)
+static pthread_cond_t pool_done_cond = PTHREAD_COND_INITIALIZER;    // condition used to signal completed work
+
+static pthread_t *pool_threads;            // worker threads
+static unsigned pool_thread_count;         // number of worker threads
+static bool pool_shutdown;                 // true if workers should exit
+
+static struct mag_buf **pool_ring;         // submitted buffers, indexed by sequence number modulo pool_ring_size
+static bool *pool_ring_done;               // true if the corresponding buffer has been demodulated
+static unsigned pool_ring_size;            // size of pool_ring
+
+static uint64_t pool_submitted;            // sequence number of the next buffer to be submitted
+static uint64_t pool_started;              // sequence number of the next buffer to be picked up by a worker
+static uint64_t pool_collected;            // sequence number of the next buffer to be collected
+
+static void *demod_pool_worker(void *arg)
+{
+    MODES_NOTUSED(arg);
+
+    struct demod_state state = { 0 };
+    set_thread_name("dump1090-demod");
+    set_thread_scheduling("dump1090-demod", Modes.demod_cpus, Modes.demod_priority);
+    register_stats_thread(STATS_THREAD_DEMOD_WORKERS);
+
+    pthread_mutex_lock(&pool_mutex);
+    for (;;) {
+        while (!pool_shutdown && pool_started == pool_submitted)
+            pthread_cond_wait(&pool_work_cond, &pool_mutex);
+
+        if (pool_shutdown)
+            break;
+
+        uint64_t seq = pool_started++;
+        struct mag_buf *buf = pool_ring[seq % pool_ring_size];
+        pthread_mutex_unlock(&pool_mutex);
+
+        if (!buf->stats)
+            buf->stats = malloc(sizeof(*buf->stats));
+
+        if (buf->stats) {
+            struct timespec start_time;
+
+            reset_stats(buf->stats);
+            add_block_latency(buf->stats, buf);
+            start_cpu_timing(&start_time);
+            demodulate2400Deferred(&state, buf);
+            end_cpu_timing(&start_time, &buf->stats->demod_cpu);
+        } else {
+            fprintf(stderr, "demod_pool_worker: out of memory allocating buffer stats\n");
+            buf->message_count = 0;
+        }
+
+        pthread_mutex_lock(&pool_mutex);
+        pool_ring_done[seq % pool_ring_size] = true;
+        if (seq == pool_collected)
+            pthread_cond_signal(&pool_done_cond);
+    }
+    pthread_mutex_unlock(&pool_mutex);
+
+    free(state.candidates);
+    return NULL;
+}
+
+bool demod_pool_create(unsigned threads)
+{
+    pool_ring_size = threads * 2;
+    if (!(pool_ring = calloc(pool_ring_size, sizeof(*pool_ring))))
+        goto nomem;
+    if (!(pool_ring_done = calloc(pool_ring_size, sizeof(*pool_ring_done))))
+        goto nomem;
+    if (!(pool_threads = calloc(threads, sizeof(*pool_threads))))
+        goto nomem;
+
+    pool_submitted = pool_started = pool_collected = 0;
+    pool_shutdown = false;
+
+    for (pool_thread_count = 0; pool_thread_count < threads; ++pool_thread_count) {
+        int err = pthread_create(&pool_threads[pool_thread_count], NULL, demod_pool_worker, NULL);
+        if (err) {
+            fprintf(stderr, "demod_pool_create: pthread_create failed: %s\n", strerror(err));
+            demod_pool_destroy();
+            return false;
+        }
+    }
+
+    return true;
+
+ nomem:
+    demod_pool_destroy();
+    return false;
+}
+
+void demod_pool_destroy()
+{
+    pthread_mutex_lock(&pool_mutex);
+    pool_shutdown = true;
+    pthread_cond_broadcast(&pool_work_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    for (unsigned i = 0; i < pool_thread_count; ++i)
+        pthread_join(pool_threads[i], NULL);
+
+    // Return anything left over to the freelist
+    for (; pool_collected < pool_submitted; ++pool_collected)
+        fifo_release(Modes.fifo, pool_ring[pool_collected % pool_ring_size]);
+
+    free(pool_threads);
+    pool_threads = NULL;
+    pool_thread_count = 0;
+
+    free(pool_ring);
+    pool_ring = NULL;
+    free(pool_ring_done);
+    pool_ring_done = NULL;
+    pool_ring_size = 0;
+}
+
+unsigned demod_pool_pending()
+{
+    // only modified by the main thread, no lock needed
+    return pool_submitted - pool_collected;
+}
+
+unsigned demod_pool_capacity()
+{
+    return pool_ring_size;
+}
+
+void demod_pool_submit(struct mag_buf *buf)
+{
+    assert(demod_pool_pending() < pool_ring_size);
+
+    pthread_mutex_lock(&pool_mutex);
+    uint64_t seq = pool_submitted++;
+    pool_ring[seq % pool_ring_size] = buf;
+    pool_ring_done[seq % pool_ring_size] = false;
+    pthread_cond_signal(&pool_work_cond);
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+struct mag_buf *demod_pool_collect(uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    if (timeout_ms)
+        get_deadline(timeout_ms, &deadline);
+
+    pthread_mutex_lock(&pool_mutex);
+
+    struct mag_buf *result = NULL;
+    while (pool_collected == pool_submitted || !pool_ring_done[pool_collected % pool_ring_size]) {
+        if (!timeout_ms) {
+            // Non-blocking
+            goto done;
+        }
+
+        int err = pthread_cond_timedwait(&pool_done_cond, &pool_mutex, &deadline);
+        if (err) {
+            if (err != ETIMEDOUT) {
+                fprintf(stderr, "demod_pool_collect: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
+            }
+
+            goto done; // done waiting
+        }
+    }
+
+    result = pool_ring[pool_collected % pool_ring_size];
+    ++pool_collected;
+
+ done:
+    pthread_mutex_unlock(&pool_mutex);
+    return result;
+}
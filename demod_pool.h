@@ -0,0 +1,54 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demod_pool.h: Demodulator worker thread pool
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef DEMOD_POOL_H
+#define DEMOD_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct mag_buf;
+
+// Start "threads" demodulator worker threads. Not threadsafe. Returns true on success.
+bool demod_pool_create(unsigned threads);
+
+// Stop and join the worker threads. Buffers that were submitted but not yet
+// collected are returned to the FIFO freelist. Not threadsafe.
+void demod_pool_destroy();
+
+// Number of buffers that have been submitted but not yet collected.
+unsigned demod_pool_pending();
+
+// Maximum number of buffers that can be pending at once.
+unsigned demod_pool_capacity();
+
+// Hand a buffer (from fifo_dequeue) to the worker threads for demodulation
+// via demodulate2400Deferred(). The caller must ensure that
+// demod_pool_pending() < demod_pool_capacity().
+void demod_pool_submit(struct mag_buf *buf);
+
+// Return the oldest submitted buffer once it has been demodulated, in the
+// same order that buffers were submitted. Wait up to timeout_ms for it to
+// be ready; return NULL if nothing is ready within the timeout.
+// The caller should pass the buffer to demodulate2400Deliver(), then
+// return it with fifo_release().
+struct mag_buf *demod_pool_collect(uint32_t timeout_ms);
+
+#endif
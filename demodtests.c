@@ -0,0 +1,330 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demodtests.c - check that --demod-threads finds the same messages as the
+//                single-threaded demodulator
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+// A synthetic capture is written to a temporary file and run through
+// ./dump1090 --raw --mlat with different numbers of demodulator threads and
+// block sizes; the output, including timestamps, must be identical. The
+// capture has DF11 / DF17 messages that put addresses in the ICAO filter,
+// address/parity messages that are only accepted once they have, and
+// messages that collide, so that messages straddle block boundaries in
+// every possible way.
+//
+// At every multiple of BOUNDARY_SAMPLES (a block boundary for all the block
+// sizes tested except the largest, and some of its boundaries too) a DF17
+// straddles the boundary and a second DF17 starts in its last bit. A worker
+// that demodulates the next block on its own finds the second message where
+// it starts, inside the first one; that is discarded on delivery, and the
+// samples the worker skipped are rescanned, which must find the second
+// message at the same offset as the single-threaded demodulator does.
+
+#define SAMPLE_RATE 2400000
+#define OVERSAMPLE 10                   // pulses are placed at 24MHz
+#define TEST_SECONDS 1.5
+#define TEST_ADDRESSES 64
+#define BOUNDARY_SAMPLES 81920          // multiple of 16384 and 20480
+#define TRAILING_SAMPLES 326            // dump1090's overlap between blocks at 2.4MHz;
+                                        // each block starts this far before its boundary
+
+static uint32_t rng_state = 2463534242U;
+
+static uint32_t test_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static double test_uniform(void)
+{
+    return (test_random() + 0.5) / 4294967296.0;
+}
+
+static double test_gauss(void)
+{
+    return sqrt(-2 * log(test_uniform())) * cos(2 * M_PI * test_uniform());
+}
+
+// Mode S CRC of the first bytes-3 bytes of msg
+static uint32_t test_crc(const uint8_t *msg, unsigned bytes)
+{
+    uint32_t rem = 0;
+    for (unsigned i = 0; i < (bytes - 3) * 8; ++i) {
+        unsigned bit = (msg[i / 8] >> (7 - i % 8)) & 1;
+        unsigned top = ((rem >> 23) & 1) ^ bit;
+        rem = (rem << 1) & 0xFFFFFF;
+        if (top)
+            rem ^= 0xFFF409;
+    }
+    return rem;
+}
+
+// Build a message of the given DF from addr; returns the length in bytes
+static unsigned build_message(uint8_t *msg, unsigned df, uint32_t addr)
+{
+    unsigned bytes = (df >= 16) ? 14 : 7;
+
+    for (unsigned i = 0; i < bytes; ++i)
+        msg[i] = test_random();
+    msg[0] = (df << 3) | 5;
+
+    uint32_t parity;
+    if (df == 11 || df == 17) {
+        // address in the clear
+        msg[1] = addr >> 16;
+        msg[2] = addr >> 8;
+        msg[3] = addr;
+        if (df == 17)
+            msg[4] = (11 << 3) | (msg[4] & 7); // airborne position
+        parity = test_crc(msg, bytes);
+    } else {
+        // address/parity
+        parity = test_crc(msg, bytes) ^ addr;
+    }
+
+    msg[bytes - 3] = parity >> 16;
+    msg[bytes - 2] = parity >> 8;
+    msg[bytes - 1] = parity;
+    return bytes;
+}
+
+// Build a random message from one of the addresses
+static unsigned make_message(uint8_t *msg, const uint32_t *addresses)
+{
+    static const unsigned ap_df[] = { 0, 4, 5, 20, 21 };
+    uint32_t addr = addresses[test_random() % TEST_ADDRESSES];
+    unsigned r = test_random() % 10;
+
+    if (r < 3)
+        return build_message(msg, 17, addr);
+    else if (r < 5)
+        return build_message(msg, 11, addr);
+    else
+        return build_message(msg, ap_df[test_random() % 5], addr);
+}
+
+// Add a 0.5us pulse (12 ticks) starting at 24MHz offset "start"
+static void add_pulse(float *i_samples, float *q_samples, unsigned long start, double amp_i, double amp_q)
+{
+    for (unsigned long t = start; t < start + 12; ++t) {
+        i_samples[t / OVERSAMPLE] += amp_i / OVERSAMPLE;
+        q_samples[t / OVERSAMPLE] += amp_q / OVERSAMPLE;
+    }
+}
+
+// Add a message starting at 24MHz offset "start"; returns where it ends
+static unsigned long add_message(float *i_samples, float *q_samples, unsigned long start, const uint8_t *msg, unsigned bytes, double amp)
+{
+    double phase = 2 * M_PI * test_uniform();
+    double amp_i = amp * cos(phase), amp_q = amp * sin(phase);
+    unsigned bits = bytes * 8;
+
+    // preamble pulses at 0, 1, 3.5, 4.5us; then PPM data bits
+    static const double preamble[4] = { 0, 1, 3.5, 4.5 };
+    for (unsigned p = 0; p < 4; ++p)
+        add_pulse(i_samples, q_samples, start + (unsigned long) (preamble[p] * 24), amp_i, amp_q);
+    for (unsigned b = 0; b < bits; ++b) {
+        unsigned bit = (msg[b / 8] >> (7 - b % 8)) & 1;
+        add_pulse(i_samples, q_samples, start + 8 * 24 + b * 24 + (bit ? 0 : 12), amp_i, amp_q);
+    }
+
+    return start + (8 + bits) * 24;
+}
+
+static int write_capture(const char *path)
+{
+    unsigned long samples = (unsigned long) (TEST_SECONDS * SAMPLE_RATE);
+    float *i_samples = calloc(samples, sizeof(float));
+    float *q_samples = calloc(samples, sizeof(float));
+    uint8_t *out = malloc(samples * 2);
+    uint32_t addresses[TEST_ADDRESSES];
+    unsigned count = 0, straddling = 0;
+    unsigned long boundary = BOUNDARY_SAMPLES;
+
+    if (!i_samples || !q_samples || !out) {
+        fprintf(stderr, "write_capture: out of memory\n");
+        return 0;
+    }
+
+    for (unsigned i = 0; i < TEST_ADDRESSES; ++i)
+        addresses[i] = test_random() & 0xFFFFFF;
+
+    // 24MHz time of the next message
+    unsigned long t = 1000 * OVERSAMPLE;
+    for (;;) {
+        uint8_t msg[14];
+        unsigned bytes = make_message(msg, addresses);
+        unsigned bits = bytes * 8;
+        unsigned long start = t + test_random() % (20 * OVERSAMPLE);
+        unsigned long end = start + (8 + bits) * 24;
+        if (end / OVERSAMPLE + 100 >= samples)
+            break;
+
+        if (end / OVERSAMPLE + 400 + TRAILING_SAMPLES >= boundary) {
+            // a DF17 that straddles the boundary, then one that starts in
+            // its last bit; both decode (the first with one bit corrected)
+            unsigned long first = (boundary - TRAILING_SAMPLES) * OVERSAMPLE - 1000;
+            bytes = build_message(msg, 17, addresses[test_random() % TEST_ADDRESSES]);
+            unsigned long second = add_message(i_samples, q_samples, first, msg, bytes, 0.3) - 24 + test_random() % 20;
+            bytes = build_message(msg, 17, addresses[test_random() % TEST_ADDRESSES]);
+            t = add_message(i_samples, q_samples, second, msg, bytes, 0.3 + 0.7 * test_uniform()) + 50 * 24;
+            count += 2;
+            ++straddling;
+            boundary += BOUNDARY_SAMPLES;
+            continue;
+        }
+
+        add_message(i_samples, q_samples, start, msg, bytes, pow(10, -2.5 * test_uniform()));
+        ++count;
+
+        // the next message may collide with this one
+        long gap = (long) (test_random() % 430) - 30;
+        long next = (long) end + gap * 24;
+        t = (next < 0) ? 0 : (unsigned long) next;
+    }
+
+    for (unsigned long s = 0; s < samples; ++s) {
+        double i = 127.4 + (i_samples[s] + 0.02 * test_gauss()) * 127;
+        double q = 127.4 + (q_samples[s] + 0.02 * test_gauss()) * 127;
+        out[2 * s] = (i < 0) ? 0 : (i > 255) ? 255 : (uint8_t) lround(i);
+        out[2 * s + 1] = (q < 0) ? 0 : (q > 255) ? 255 : (uint8_t) lround(q);
+    }
+
+    FILE *f = fopen(path, "wb");
+    int ok = f && fwrite(out, 2, samples, f) == samples;
+    if (f && fclose(f) != 0)
+        ok = 0;
+    if (!ok)
+        fprintf(stderr, "write_capture: could not write %s\n", path);
+
+    free(i_samples);
+    free(q_samples);
+    free(out);
+    fprintf(stderr, "synthetic capture: %u messages in %.1fs, %u pairs straddling block boundaries\n", count, TEST_SECONDS, straddling);
+    return ok;
+}
+
+// Run dump1090 on the capture; return its output (malloced) or NULL
+static char *run_dump1090(const char *path, unsigned threads, unsigned block_size)
+{
+    char command[512];
+    snprintf(command, sizeof(command),
+             "./dump1090 --ifile %s --raw --mlat --fix --demod-threads %u --fifo-block-size %u 2>/dev/null",
+             path, threads, block_size);
+
+    FILE *p = popen(command, "r");
+    if (!p)
+        return NULL;
+
+    size_t size = 0, capacity = 65536;
+    char *output = malloc(capacity + 1);
+    size_t n;
+    while (output && (n = fread(output + size, 1, capacity - size, p)) > 0) {
+        size += n;
+        if (size == capacity) {
+            char *bigger = realloc(output, capacity * 2 + 1);
+            if (!bigger) {
+                free(output);
+                output = NULL;
+                break;
+            }
+            output = bigger;
+            capacity *= 2;
+        }
+    }
+    pclose(p);
+
+    if (output)
+        output[size] = 0;
+    return output;
+}
+
+static unsigned count_lines(const char *s)
+{
+    unsigned lines = 0;
+    for (; *s; ++s)
+        if (*s == '\n')
+            ++lines;
+    return lines;
+}
+
+static int testDemodThreads(const char *path)
+{
+    static const unsigned block_sizes[] = { 16384, 20480, 131072 };
+    static const unsigned thread_counts[] = { 1, 2, 4 };
+    int ok = 1;
+
+    if (access("./dump1090", X_OK) != 0) {
+        fprintf(stderr, "testDemodThreads: FAIL: ./dump1090 not found\n");
+        return 0;
+    }
+
+    for (unsigned b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]); ++b) {
+        char *expected = run_dump1090(path, 0, block_sizes[b]);
+        if (!expected || count_lines(expected) < 100) {
+            fprintf(stderr, "testDemodThreads: FAIL: block size %u: too few messages decoded without demodulator threads\n", block_sizes[b]);
+            free(expected);
+            ok = 0;
+            continue;
+        }
+
+        for (unsigned t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t) {
+            char *got = run_dump1090(path, thread_counts[t], block_sizes[b]);
+            if (!got || strcmp(got, expected)) {
+                fprintf(stderr, "testDemodThreads: FAIL: block size %u: %u threads decoded %u messages, expected the same %u as with no threads\n",
+                        block_sizes[b], thread_counts[t], got ? count_lines(got) : 0, count_lines(expected));
+                ok = 0;
+            }
+            free(got);
+        }
+
+        fprintf(stderr, "testDemodThreads: block size %u: %u messages\n", block_sizes[b], count_lines(expected));
+        free(expected);
+    }
+
+    if (ok)
+        fprintf(stderr, "testDemodThreads: PASS\n");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    (void) argc;
+    (void) argv;
+
+    char path[] = "/tmp/dump1090-demodtests-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+
+    int ok = write_capture(path) && testDemodThreads(path);
+    unlink(path);
+    return ok ? 0 : 1;
+}
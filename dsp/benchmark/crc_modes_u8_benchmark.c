@@ -0,0 +1,52 @@
+#include <stdlib.h>
+
+void STARCH_BENCHMARK(crc_modes_u8) (void)
+{
+    uint8_t *in = NULL;
+    uint32_t *out = NULL;
+    const unsigned len = 14; /* long (112-bit) message */
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint8_t)) || !(out = STARCH_BENCHMARK_ALLOC(1, uint32_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = rand();
+    }
+
+    STARCH_BENCHMARK_RUN( crc_modes_u8, in, len, out );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out);
+}
+
+/* bit-at-a-time reference version */
+static uint32_t crc_modes_u8_reference(const uint8_t *in, unsigned len)
+{
+    uint32_t rem = 0;
+    for (unsigned i = 0; i < len - 3; ++i) {
+        rem ^= (uint32_t) in[i] << 16;
+        for (unsigned j = 0; j < 8; ++j) {
+            if (rem & 0x800000)
+                rem = (rem << 1) ^ 0xFFF409;
+            else
+                rem = (rem << 1);
+        }
+        rem &= 0xFFFFFF;
+    }
+
+    return rem ^ ((uint32_t) in[len - 3] << 16) ^ ((uint32_t) in[len - 2] << 8) ^ in[len - 1];
+}
+
+bool STARCH_BENCHMARK_VERIFY(crc_modes_u8) (const uint8_t *in, unsigned len, uint32_t *out)
+{
+    uint32_t reference = crc_modes_u8_reference(in, len);
+    if (*out != reference) {
+        fprintf(stderr, "verification failed: len=%u out=%06x expected=%06x\n", len, *out, reference);
+        return false;
+    }
+
+    return true;
+}
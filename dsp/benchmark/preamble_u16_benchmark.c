@@ -0,0 +1,112 @@
+#include <stdlib.h>
+
+void STARCH_BENCHMARK(preamble_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint32_t *out = NULL;
+    const unsigned len = 65536;
+    const unsigned lookahead = 18;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + lookahead, uint16_t)) || !(out = STARCH_BENCHMARK_ALLOC(len, uint32_t))) {
+        goto done;
+    }
+
+    // low-level noise with an ideal phase-4 preamble every ~300 samples
+    static const uint16_t preamble[] = { 1, 5, 0, 4, 2, 0, 0, 0, 0, 4, 2, 2, 4, 0, 0, 0, 0, 0, 0 };
+
+    srand(1);
+    for (unsigned i = 0; i < len + lookahead; ++i) {
+        in[i] = rand() % 4096;
+    }
+    for (unsigned i = 0; i + 19 < len; i += 250 + rand() % 100) {
+        for (unsigned k = 0; k < 19; ++k) {
+            in[i + k] = preamble[k] * 10000 + rand() % 1024;
+        }
+    }
+
+    unsigned count;
+    STARCH_BENCHMARK_RUN( preamble_u16, in, len, out, &count );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out);
+}
+
+/* this file is included once per alignment variant, only define the reference version once */
+#ifndef PREAMBLE_U16_REFERENCE
+#define PREAMBLE_U16_REFERENCE
+
+/* reference version of the phase-specific preamble tests, table-driven */
+static const struct {
+    int rising[4];   /* sample n must be < sample n+1 */
+    int falling[4];  /* sample n must be > sample n+1 */
+    int high[7];     /* samples summed to give the "high" level (times 4), -1 terminated */
+    int signal[5];   /* signal samples, -1 terminated */
+    int noise[5];    /* noise samples, -1 terminated */
+} preamble_u16_phases[5] = {
+    { { 2, 8, 10, -1 }, { 1, 3, 9, -1 },  { 1, 3, 9, 11, 12, -1 },    { 1, 3, 9, -1 },      { 5, 6, 7, -1 } },    /* phase 3 */
+    { { 2, 8, 11, -1 }, { 1, 3, 9, -1 },  { 1, 3, 9, 12, -1 },        { 1, 3, 9, 12, -1 },  { 5, 6, 7, 8, -1 } }, /* phase 4 */
+    { { 2, 8, 11, -1 }, { 1, 4, 10, -1 }, { 1, 3, 4, 9, 10, 12, -1 }, { 1, 12, -1 },        { 6, 7, -1 } },       /* phase 5 */
+    { { 3, 9, 11, -1 }, { 1, 4, 10, -1 }, { 1, 4, 10, 12, -1 },       { 1, 4, 10, 12, -1 }, { 5, 6, 7, 8, -1 } }, /* phase 6 */
+    { { 3, 9, 11, -1 }, { 2, 4, 10, -1 }, { 1, 2, 4, 10, 12, -1 },    { 4, 10, 12, -1 },    { 6, 7, 8, -1 } },    /* phase 7 */
+};
+
+static bool preamble_u16_reference(const uint16_t *p)
+{
+    if (! (p[0] < p[1] && p[12] > p[13]) )
+        return false;
+
+    unsigned quiet = 0;
+    static const unsigned quiet_samples[] = { 5, 6, 7, 8, 14, 15, 16, 17, 18 };
+    for (unsigned k = 0; k < 9; ++k) {
+        if (p[quiet_samples[k]] > quiet)
+            quiet = p[quiet_samples[k]];
+    }
+
+    for (unsigned phase = 0; phase < 5; ++phase) {
+        bool okay = true;
+        unsigned high = 0, signal = 0, noise = 0;
+
+        for (const int *n = preamble_u16_phases[phase].rising; *n >= 0; ++n)
+            okay = okay && (p[*n] < p[*n + 1]);
+        for (const int *n = preamble_u16_phases[phase].falling; *n >= 0; ++n)
+            okay = okay && (p[*n] > p[*n + 1]);
+        for (const int *n = preamble_u16_phases[phase].high; *n >= 0; ++n)
+            high += p[*n];
+        for (const int *n = preamble_u16_phases[phase].signal; *n >= 0; ++n)
+            signal += p[*n];
+        for (const int *n = preamble_u16_phases[phase].noise; *n >= 0; ++n)
+            noise += p[*n];
+
+        if (okay && quiet < high / 4 && signal * 2 >= noise * 3)
+            return true;
+    }
+
+    return false;
+}
+
+#endif /* PREAMBLE_U16_REFERENCE */
+
+bool STARCH_BENCHMARK_VERIFY(preamble_u16) (const uint16_t *in, unsigned len, uint32_t *out, unsigned *out_count)
+{
+    unsigned expected = 0;
+    bool okay = true;
+
+    for (unsigned i = 0; i < len; ++i) {
+        if (!preamble_u16_reference(&in[i]))
+            continue;
+
+        if (okay && expected < *out_count && out[expected] != i) {
+            fprintf(stderr, "verification failed: candidate %u: expected offset %u, got offset %u\n", expected, i, (unsigned) out[expected]);
+            okay = false;
+        }
+        ++expected;
+    }
+
+    if (expected != *out_count) {
+        fprintf(stderr, "verification failed: expected %u candidates, got %u candidates\n", expected, *out_count);
+        okay = false;
+    }
+
+    return okay;
+}
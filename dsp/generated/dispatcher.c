@@ -90,7 +90,7 @@ starch_count_above_u16_regentry starch_count_above_u16_registry[] = {
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 0, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
@@ -171,9 +171,99 @@ starch_count_above_u16_aligned_regentry starch_count_above_u16_aligned_registry[
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "generic_x86_avx2_aligned", "x86_avx2", starch_count_above_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 0, "generic_x86_avx2_aligned", "x86_avx2", starch_count_above_u16_aligned_generic_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
-    { 2, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2_pclmul },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for crc_modes_u8 */
+
+starch_crc_modes_u8_regentry * starch_crc_modes_u8_select() {
+    for (starch_crc_modes_u8_regentry *entry = starch_crc_modes_u8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_crc_modes_u8_dispatch ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2 ) {
+    starch_crc_modes_u8_regentry *entry = starch_crc_modes_u8_select();
+    if (!entry)
+        abort();
+
+    starch_crc_modes_u8 = entry->callable;
+    starch_crc_modes_u8 ( arg0, arg1, arg2 );
+}
+
+starch_crc_modes_u8_ptr starch_crc_modes_u8 = starch_crc_modes_u8_dispatch;
+
+void starch_crc_modes_u8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_crc_modes_u8_regentry *entry;
+    for (entry = starch_crc_modes_u8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_crc_modes_u8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_crc_modes_u8_registry, entry - starch_crc_modes_u8_registry, sizeof(starch_crc_modes_u8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_crc_modes_u8 = starch_crc_modes_u8_dispatch;
+}
+
+starch_crc_modes_u8_regentry starch_crc_modes_u8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "slice8_armv8_neon_simd", "armv8_neon_simd", starch_crc_modes_u8_slice8_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "slice4_armv8_neon_simd", "armv8_neon_simd", starch_crc_modes_u8_slice4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 2, "bytewise_armv8_neon_simd", "armv8_neon_simd", starch_crc_modes_u8_bytewise_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "slice8_generic", "generic", starch_crc_modes_u8_slice8_generic, NULL },
+    { 4, "slice4_generic", "generic", starch_crc_modes_u8_slice4_generic, NULL },
+    { 5, "bytewise_generic", "generic", starch_crc_modes_u8_bytewise_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "slice8_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_crc_modes_u8_slice8_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "slice4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_crc_modes_u8_slice4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 2, "bytewise_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_crc_modes_u8_bytewise_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "slice8_generic", "generic", starch_crc_modes_u8_slice8_generic, NULL },
+    { 4, "slice4_generic", "generic", starch_crc_modes_u8_slice4_generic, NULL },
+    { 5, "bytewise_generic", "generic", starch_crc_modes_u8_bytewise_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "slice8_generic", "generic", starch_crc_modes_u8_slice8_generic, NULL },
+    { 1, "slice4_generic", "generic", starch_crc_modes_u8_slice4_generic, NULL },
+    { 2, "bytewise_generic", "generic", starch_crc_modes_u8_bytewise_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "pclmul_x86_avx2", "x86_avx2", starch_crc_modes_u8_pclmul_x86_avx2, cpu_supports_avx2_pclmul },
+    { 1, "slice8_x86_avx2", "x86_avx2", starch_crc_modes_u8_slice8_x86_avx2, cpu_supports_avx2_pclmul },
+    { 2, "slice4_x86_avx2", "x86_avx2", starch_crc_modes_u8_slice4_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "bytewise_x86_avx2", "x86_avx2", starch_crc_modes_u8_bytewise_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "slice8_generic", "generic", starch_crc_modes_u8_slice8_generic, NULL },
+    { 5, "slice4_generic", "generic", starch_crc_modes_u8_slice4_generic, NULL },
+    { 6, "bytewise_generic", "generic", starch_crc_modes_u8_bytewise_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
@@ -259,10 +349,10 @@ starch_magnitude_power_uc8_regentry starch_magnitude_power_uc8_registry[] = {
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2_pclmul },
     { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
     { 5, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
 #endif /* STARCH_MIX_X86 */
@@ -358,13 +448,13 @@ starch_magnitude_power_uc8_aligned_regentry starch_magnitude_power_uc8_aligned_r
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
-    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 6, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2_pclmul },
+    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2_pclmul },
+    { 6, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2_pclmul },
     { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
     { 8, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
 #endif /* STARCH_MIX_X86 */
@@ -447,9 +537,9 @@ starch_magnitude_sc16_regentry starch_magnitude_sc16_registry[] = {
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2_pclmul },
     { 3, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
@@ -537,11 +627,11 @@ starch_magnitude_sc16_aligned_regentry starch_magnitude_sc16_aligned_registry[]
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 4, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_u32_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2_pclmul },
     { 5, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
@@ -633,11 +723,11 @@ starch_magnitude_sc16q11_regentry starch_magnitude_sc16q11_registry[] = {
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 4, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2_pclmul },
     { 5, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
     { 6, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
     { 7, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
@@ -741,15 +831,15 @@ starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligned_regis
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 4, "12bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 6, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 7, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 8, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "12bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2, cpu_supports_avx2_pclmul },
+    { 5, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2_pclmul },
+    { 6, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2_pclmul },
+    { 7, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2_pclmul },
+    { 8, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2_pclmul },
     { 9, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
     { 10, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
     { 11, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
@@ -838,10 +928,10 @@ starch_magnitude_uc8_regentry starch_magnitude_uc8_registry[] = {
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2_pclmul },
     { 4, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
     { 5, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
 #endif /* STARCH_MIX_X86 */
@@ -937,13 +1027,13 @@ starch_magnitude_uc8_aligned_regentry starch_magnitude_uc8_aligned_registry[] =
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_exact_x86_avx2, cpu_supports_avx2 },
-    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 6, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_exact_x86_avx2, cpu_supports_avx2_pclmul },
+    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2_pclmul },
+    { 6, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2_pclmul },
     { 7, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
     { 8, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
 #endif /* STARCH_MIX_X86 */
@@ -1031,10 +1121,10 @@ starch_mean_power_u16_regentry starch_mean_power_u16_registry[] = {
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
+    { 0, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 2, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
-    { 3, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2_pclmul },
     { 4, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
     { 5, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
 #endif /* STARCH_MIX_X86 */
@@ -1130,19 +1220,195 @@ starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_registry[]
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "u32_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u32_x86_avx2, cpu_supports_avx2 },
+    { 0, "u32_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u32_x86_avx2, cpu_supports_avx2_pclmul },
     { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 2, "float_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_float_x86_avx2, cpu_supports_avx2 },
-    { 3, "u64_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u64_x86_avx2, cpu_supports_avx2 },
-    { 4, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
-    { 5, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
-    { 6, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_float_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "u64_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u64_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2_pclmul },
+    { 5, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2_pclmul },
+    { 6, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2_pclmul },
     { 7, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
     { 8, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
+/* dispatcher / registry for preamble_u16 */
+
+starch_preamble_u16_regentry * starch_preamble_u16_select() {
+    for (starch_preamble_u16_regentry *entry = starch_preamble_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_u16_regentry *entry = starch_preamble_u16_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_u16 = entry->callable;
+    starch_preamble_u16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_preamble_u16_ptr starch_preamble_u16 = starch_preamble_u16_dispatch;
+
+void starch_preamble_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_u16_regentry *entry;
+    for (entry = starch_preamble_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_u16_registry, entry - starch_preamble_u16_registry, sizeof(starch_preamble_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_u16 = starch_preamble_u16_dispatch;
+}
+
+starch_preamble_u16_regentry starch_preamble_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_preamble_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "blocked_armv8_neon_simd", "armv8_neon_simd", starch_preamble_u16_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "blocked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_u16_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "blocked_x86_avx2", "x86_avx2", starch_preamble_u16_blocked_x86_avx2, cpu_supports_avx2_pclmul },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+    { 2, "generic_x86_avx2", "x86_avx2", starch_preamble_u16_generic_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for preamble_u16_aligned */
+
+starch_preamble_u16_aligned_regentry * starch_preamble_u16_aligned_select() {
+    for (starch_preamble_u16_aligned_regentry *entry = starch_preamble_u16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_u16_aligned_regentry *entry = starch_preamble_u16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_u16_aligned = entry->callable;
+    starch_preamble_u16_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_preamble_u16_aligned_ptr starch_preamble_u16_aligned = starch_preamble_u16_aligned_dispatch;
+
+void starch_preamble_u16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_u16_aligned_regentry *entry;
+    for (entry = starch_preamble_u16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_u16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_u16_aligned_registry, entry - starch_preamble_u16_aligned_registry, sizeof(starch_preamble_u16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_u16_aligned = starch_preamble_u16_aligned_dispatch;
+}
+
+starch_preamble_u16_aligned_regentry starch_preamble_u16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_u16_aligned_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "blocked_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_u16_aligned_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "generic_armv8_neon_simd", "armv8_neon_simd", starch_preamble_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "blocked_armv8_neon_simd", "armv8_neon_simd", starch_preamble_u16_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_u16_aligned_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "blocked_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_u16_aligned_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "blocked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_u16_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "blocked_x86_avx2_aligned", "x86_avx2", starch_preamble_u16_aligned_blocked_x86_avx2, cpu_supports_avx2_pclmul },
+    { 1, "generic_generic", "generic", starch_preamble_u16_generic_generic, NULL },
+    { 2, "generic_x86_avx2_aligned", "x86_avx2", starch_preamble_u16_aligned_generic_x86_avx2, cpu_supports_avx2_pclmul },
+    { 3, "generic_x86_avx2", "x86_avx2", starch_preamble_u16_generic_x86_avx2, cpu_supports_avx2_pclmul },
+    { 4, "blocked_x86_avx2", "x86_avx2", starch_preamble_u16_blocked_x86_avx2, cpu_supports_avx2_pclmul },
+    { 5, "blocked_generic", "generic", starch_preamble_u16_blocked_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
 
 int starch_read_wisdom (const char * path)
 {
@@ -1159,6 +1425,10 @@ int starch_read_wisdom (const char * path)
     for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_crc_modes_u8 = 0;
+    for (starch_crc_modes_u8_regentry *entry = starch_crc_modes_u8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
     int rank_magnitude_power_uc8 = 0;
     for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
         entry->rank = 0;
@@ -1199,6 +1469,14 @@ int starch_read_wisdom (const char * path)
     for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_preamble_u16 = 0;
+    for (starch_preamble_u16_regentry *entry = starch_preamble_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_u16_aligned = 0;
+    for (starch_preamble_u16_aligned_regentry *entry = starch_preamble_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
 
     char linebuf[512];
     while (fgets(linebuf, sizeof(linebuf), fp)) {
@@ -1250,6 +1528,15 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "crc_modes_u8")) {
+            for (starch_crc_modes_u8_regentry *entry = starch_crc_modes_u8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_crc_modes_u8;
+                    break;
+                }
+            }
+            continue;
+        }
         if (!strcmp(name, "magnitude_power_uc8")) {
             for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
                 if (!strcmp(impl, entry->name)) {
@@ -1340,6 +1627,24 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "preamble_u16")) {
+            for (starch_preamble_u16_regentry *entry = starch_preamble_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_u16_aligned")) {
+            for (starch_preamble_u16_aligned_regentry *entry = starch_preamble_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
     }
 
     if (ferror(fp)) {
@@ -1372,6 +1677,17 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
     }
+    {
+        starch_crc_modes_u8_regentry *entry;
+        for (entry = starch_crc_modes_u8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_crc_modes_u8;
+        }
+        qsort(starch_crc_modes_u8_registry, entry - starch_crc_modes_u8_registry, sizeof(starch_crc_modes_u8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_crc_modes_u8 = starch_crc_modes_u8_dispatch;
+    }
     {
         starch_magnitude_power_uc8_regentry *entry;
         for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
@@ -1482,6 +1798,28 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
     }
+    {
+        starch_preamble_u16_regentry *entry;
+        for (entry = starch_preamble_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_u16;
+        }
+        qsort(starch_preamble_u16_registry, entry - starch_preamble_u16_registry, sizeof(starch_preamble_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_u16 = starch_preamble_u16_dispatch;
+    }
+    {
+        starch_preamble_u16_aligned_regentry *entry;
+        for (entry = starch_preamble_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_u16_aligned;
+        }
+        qsort(starch_preamble_u16_aligned_registry, entry - starch_preamble_u16_aligned_registry, sizeof(starch_preamble_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_u16_aligned = starch_preamble_u16_aligned_dispatch;
+    }
 
     return 0;
 }
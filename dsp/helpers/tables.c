@@ -103,3 +103,40 @@ const uint16_t * get_sc16q11_mag_12bit_table()
     return table;
 }
 
+
+// Mode S CRC (generator 0x1fff409) slicing tables. These hold the 24-bit CRC
+// left-aligned in 32 bits (i.e. shifted left by 8), so the usual MSB-first
+// CRC-32 slicing scheme applies directly. Table k (0..7) gives the CRC
+// contribution of a byte that is followed by k further bytes.
+const uint32_t * get_crc_modes_table()
+{
+    static uint32_t *table = NULL;
+
+    if (!table) {
+        table = malloc(sizeof(uint32_t) * 8 * 256);
+        if (!table) {
+            fprintf(stderr, "can't allocate Mode S CRC lookup table\n");
+            abort();
+        }
+
+        for (unsigned i = 0; i < 256; ++i) {
+            uint32_t c = i << 24;
+            for (int j = 0; j < 8; ++j) {
+                if (c & 0x80000000U)
+                    c = (c << 1) ^ 0xFFF40900U;
+                else
+                    c = (c << 1);
+            }
+            table[i] = c;
+        }
+
+        for (unsigned k = 1; k < 8; ++k) {
+            for (unsigned i = 0; i < 256; ++i) {
+                uint32_t c = table[(k - 1) * 256 + i];
+                table[k * 256 + i] = (c << 8) ^ table[c >> 24];
+            }
+        }
+    }
+
+    return table;
+}
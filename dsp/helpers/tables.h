@@ -6,5 +6,6 @@
 const uint16_t * get_uc8_mag_table();
 const uint16_t * get_sc16q11_mag_11bit_table();
 const uint16_t * get_sc16q11_mag_12bit_table();
+const uint32_t * get_crc_modes_table();
 
 #endif
@@ -0,0 +1,161 @@
+#include <stdint.h>
+
+#include "dsp/helpers/tables.h"
+
+/*
+ * Compute the Mode S CRC syndrome of a message of "len" bytes (len >= 3):
+ * the 24-bit CRC (generator 0x1fff409) of the first len-3 bytes, XORed with
+ * the final 3 bytes (the parity / address-parity field). A message with no
+ * errors and a zero AP field has a syndrome of zero.
+ *
+ * All implementations must be bit-exact with the byte-at-a-time version.
+ * They are listed in order of preference, which is the default ranking in
+ * the absence of wisdom.
+ */
+
+static inline uint32_t crc_modes_u8_parity(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 16) | ((uint32_t) p[1] << 8) | p[2];
+}
+
+static inline uint32_t crc_modes_u8_load32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+/* Big-endian load of n (0..8) bytes */
+static inline uint64_t crc_modes_u8_load_n(const uint8_t *p, unsigned n)
+{
+    uint64_t v = 0;
+    for (unsigned i = 0; i < n; ++i)
+        v = (v << 8) | p[i];
+    return v;
+}
+
+#ifdef STARCH_FEATURE_PCLMUL
+
+#include <wmmintrin.h>
+
+/*
+ * Carry-less multiply with Barrett reduction. Up to 13 data bytes (which
+ * covers both 56- and 112-bit messages) are folded into a single 64-bit
+ * polynomial T congruent to the data modulo P, then
+ *
+ *   CRC = T(x).x^24 mod P(x) = (floor(T.mu / x^64) . P) mod x^24
+ *
+ * where mu = floor(x^88 / P) = x^64 + CRC_MODES_MU. Longer messages use
+ * slicing-by-8.
+ */
+
+#define CRC_MODES_POLY 0x1FFF409ULL          /* P(x) */
+#define CRC_MODES_X64 0xF52612ULL            /* x^64 mod P(x) */
+#define CRC_MODES_MU 0x80090B3E028FB241ULL   /* floor(x^88 / P(x)), less the x^64 term */
+
+void STARCH_IMPL_REQUIRES(crc_modes_u8, pclmul, STARCH_FEATURE_PCLMUL) (const uint8_t *in, unsigned len, uint32_t *out)
+{
+    const unsigned n = len - 3;
+    if (n > 13) {
+        STARCH_IMPL(crc_modes_u8, slice8) (in, len, out);
+        return;
+    }
+
+    uint64_t t;
+    if (n <= 8) {
+        t = crc_modes_u8_load_n(in, n);
+    } else {
+        /* T = high bytes . x^64 + low 8 bytes, with x^64 replaced by its residue */
+        __m128i hi = _mm_cvtsi64_si128((long long) crc_modes_u8_load_n(in, n - 8));
+        __m128i folded = _mm_clmulepi64_si128(hi, _mm_cvtsi64_si128((long long) CRC_MODES_X64), 0x00);
+        t = (uint64_t) _mm_cvtsi128_si64(folded) ^ crc_modes_u8_load_n(in + n - 8, 8);
+    }
+
+    __m128i tv = _mm_cvtsi64_si128((long long) t);
+    __m128i q = _mm_clmulepi64_si128(tv, _mm_cvtsi64_si128((long long) CRC_MODES_MU), 0x00);
+    q = _mm_xor_si128(_mm_srli_si128(q, 8), tv);
+    __m128i r = _mm_clmulepi64_si128(q, _mm_cvtsi64_si128((long long) CRC_MODES_POLY), 0x00);
+
+    *out = ((uint32_t) _mm_cvtsi128_si64(r) & 0xFFFFFF) ^ crc_modes_u8_parity(in + n);
+}
+
+#undef CRC_MODES_POLY
+#undef CRC_MODES_X64
+#undef CRC_MODES_MU
+
+#endif /* STARCH_FEATURE_PCLMUL */
+
+/* Slicing-by-8: eight table lookups per 64 bits of input */
+void STARCH_IMPL(crc_modes_u8, slice8) (const uint8_t *in, unsigned len, uint32_t *out)
+{
+    const uint32_t * const table = get_crc_modes_table();
+    const uint32_t * const t0 = table;
+    const uint32_t * const t1 = table + 256;
+    const uint32_t * const t2 = table + 512;
+    const uint32_t * const t3 = table + 768;
+    const uint32_t * const t4 = table + 1024;
+    const uint32_t * const t5 = table + 1280;
+    const uint32_t * const t6 = table + 1536;
+    const uint32_t * const t7 = table + 1792;
+    const unsigned n = len - 3;
+
+    const uint8_t *p = in;
+    const uint8_t *end = in + n;
+
+    uint32_t c = 0;
+    while (end - p >= 8) {
+        uint32_t hi = c ^ crc_modes_u8_load32(p);
+        uint32_t lo = crc_modes_u8_load32(p + 4);
+        c = t7[hi >> 24] ^ t6[(hi >> 16) & 255] ^ t5[(hi >> 8) & 255] ^ t4[hi & 255] ^
+            t3[lo >> 24] ^ t2[(lo >> 16) & 255] ^ t1[(lo >> 8) & 255] ^ t0[lo & 255];
+        p += 8;
+    }
+
+    if (end - p >= 4) {
+        c ^= crc_modes_u8_load32(p);
+        c = t3[c >> 24] ^ t2[(c >> 16) & 255] ^ t1[(c >> 8) & 255] ^ t0[c & 255];
+        p += 4;
+    }
+
+    while (p < end)
+        c = (c << 8) ^ t0[(c >> 24) ^ *p++];
+
+    *out = (c >> 8) ^ crc_modes_u8_parity(end);
+}
+
+/* Slicing-by-4: four table lookups per 32 bits of input */
+void STARCH_IMPL(crc_modes_u8, slice4) (const uint8_t *in, unsigned len, uint32_t *out)
+{
+    const uint32_t * const table = get_crc_modes_table();
+    const uint32_t * const t0 = table;
+    const uint32_t * const t1 = table + 256;
+    const uint32_t * const t2 = table + 512;
+    const uint32_t * const t3 = table + 768;
+    const unsigned n = len - 3;
+
+    const uint8_t *p = in;
+    const uint8_t *end = in + n;
+
+    uint32_t c = 0;
+    while (end - p >= 4) {
+        c ^= crc_modes_u8_load32(p);
+        c = t3[c >> 24] ^ t2[(c >> 16) & 255] ^ t1[(c >> 8) & 255] ^ t0[c & 255];
+        p += 4;
+    }
+
+    while (p < end)
+        c = (c << 8) ^ t0[(c >> 24) ^ *p++];
+
+    *out = (c >> 8) ^ crc_modes_u8_parity(end);
+}
+
+/* Byte at a time, one 256-entry table */
+void STARCH_IMPL(crc_modes_u8, bytewise) (const uint8_t *in, unsigned len, uint32_t *out)
+{
+    const uint32_t * const table = get_crc_modes_table();
+    const unsigned n = len - 3;
+
+    uint32_t c = 0;
+    for (unsigned i = 0; i < n; ++i)
+        c = (c << 8) ^ table[(c >> 24) ^ in[i]];
+
+    *out = (c >> 8) ^ crc_modes_u8_parity(in + n);
+}
@@ -0,0 +1,222 @@
+/*
+ * Scan a buffer of uint16_t magnitude samples for possible Mode S preambles.
+ *
+ * For each offset 0 .. len-1, test whether any of the five phase-specific
+ * preamble patterns used by demodulate2400() matches at that offset, and
+ * write the offsets that match to out[], in ascending order. The caller must
+ * allow for up to "len" results, and must provide at least 18 readable
+ * samples beyond in[len-1].
+ *
+ * A pattern matches if we have a rising edge 0->1 and a falling edge 12->13,
+ * the phase-specific peaks are present, there is enough signal relative to
+ * the phase-specific noise samples, and the quiet samples 5-8,14-18 are all
+ * below the phase-specific "high" level.
+ *
+ * This is a superset of what demodulate2400() accepts: the demodulator takes
+ * the first phase whose peaks match and then applies the signal/quiet tests
+ * to that phase only, while here any phase that passes all tests is enough.
+ */
+
+/* this file is included once per alignment variant, only define the helpers once */
+#ifndef PREAMBLE_U16_HELPERS
+#define PREAMBLE_U16_HELPERS
+
+static inline unsigned preamble_u16_quiet_max(const uint16_t *p)
+{
+    unsigned quiet = p[5];
+    if (p[6] > quiet) quiet = p[6];
+    if (p[7] > quiet) quiet = p[7];
+    if (p[8] > quiet) quiet = p[8];
+    if (p[14] > quiet) quiet = p[14];
+    if (p[15] > quiet) quiet = p[15];
+    if (p[16] > quiet) quiet = p[16];
+    if (p[17] > quiet) quiet = p[17];
+    if (p[18] > quiet) quiet = p[18];
+    return quiet;
+}
+
+static inline int preamble_u16_test(const uint16_t *p)
+{
+    if (! (p[0] < p[1] && p[12] > p[13]) )
+        return 0;
+
+    unsigned quiet = preamble_u16_quiet_max(p);
+
+    // phase 3: peaks at 1,3,9,11-12
+    if (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[10] < p[11] &&
+        quiet < (unsigned) (p[1] + p[3] + p[9] + p[11] + p[12]) / 4 &&
+        (unsigned) (p[1] + p[3] + p[9]) * 2 >= 3 * (unsigned) (p[5] + p[6] + p[7]))
+        return 1;
+
+    // phase 4: peaks at 1,3,9,12
+    if (p[1] > p[2] && p[2] < p[3] && p[3] > p[4] && p[8] < p[9] && p[9] > p[10] && p[11] < p[12] &&
+        quiet < (unsigned) (p[1] + p[3] + p[9] + p[12]) / 4 &&
+        (unsigned) (p[1] + p[3] + p[9] + p[12]) * 2 >= 3 * (unsigned) (p[5] + p[6] + p[7] + p[8]))
+        return 1;
+
+    // phase 5: peaks at 1,3-4,9-10,12
+    if (p[1] > p[2] && p[2] < p[3] && p[4] > p[5] && p[8] < p[9] && p[10] > p[11] && p[11] < p[12] &&
+        quiet < (unsigned) (p[1] + p[3] + p[4] + p[9] + p[10] + p[12]) / 4 &&
+        (unsigned) (p[1] + p[12]) * 2 >= 3 * (unsigned) (p[6] + p[7]))
+        return 1;
+
+    // phase 6: peaks at 1,4,10,12
+    if (p[1] > p[2] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12] &&
+        quiet < (unsigned) (p[1] + p[4] + p[10] + p[12]) / 4 &&
+        (unsigned) (p[1] + p[4] + p[10] + p[12]) * 2 >= 3 * (unsigned) (p[5] + p[6] + p[7] + p[8]))
+        return 1;
+
+    // phase 7: peaks at 1-2,4,10,12
+    if (p[2] > p[3] && p[3] < p[4] && p[4] > p[5] && p[9] < p[10] && p[10] > p[11] && p[11] < p[12] &&
+        quiet < (unsigned) (p[1] + p[2] + p[4] + p[10] + p[12]) / 4 &&
+        (unsigned) (p[4] + p[10] + p[12]) * 2 >= 3 * (unsigned) (p[6] + p[7] + p[8]))
+        return 1;
+
+    return 0;
+}
+
+#endif /* PREAMBLE_U16_HELPERS */
+
+/* Straightforward scalar version, early-out on each test */
+void STARCH_IMPL(preamble_u16, generic) (const uint16_t *in, unsigned len, uint32_t *out, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    unsigned count = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (preamble_u16_test(&in_align[i]))
+            out[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+/*
+ * Two-stage version: evaluate the edge and peak comparisons for a block of
+ * 16 offsets into a flags array with no branches (which the compiler can
+ * vectorize at 16 bits per lane), then run the full test only on the offsets
+ * that matched some phase's peaks. Trailing offsets that don't fill a block
+ * use the full test directly.
+ */
+void STARCH_IMPL(preamble_u16, blocked) (const uint16_t *in, unsigned len, uint32_t *out, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    unsigned count = 0;
+    unsigned base = 0;
+    unsigned len16 = len >> 4;
+
+    while (len16--) {
+        const uint16_t * restrict p = &in_align[base];
+        uint16_t flags[16];
+        uint16_t any = 0;
+
+        for (unsigned k = 0; k < 16; ++k) {
+            uint16_t p0 = p[k+0], p1 = p[k+1], p2 = p[k+2], p3 = p[k+3], p4 = p[k+4], p5 = p[k+5];
+            uint16_t p8 = p[k+8], p9 = p[k+9], p10 = p[k+10], p11 = p[k+11], p12 = p[k+12], p13 = p[k+13];
+
+            uint16_t phase3 = (p1 > p2) & (p2 < p3) & (p3 > p4) & (p8 < p9) & (p9 > p10) & (p10 < p11);
+            uint16_t phase4 = (p1 > p2) & (p2 < p3) & (p3 > p4) & (p8 < p9) & (p9 > p10) & (p11 < p12);
+            uint16_t phase5 = (p1 > p2) & (p2 < p3) & (p4 > p5) & (p8 < p9) & (p10 > p11) & (p11 < p12);
+            uint16_t phase6 = (p1 > p2) & (p3 < p4) & (p4 > p5) & (p9 < p10) & (p10 > p11) & (p11 < p12);
+            uint16_t phase7 = (p2 > p3) & (p3 < p4) & (p4 > p5) & (p9 < p10) & (p10 > p11) & (p11 < p12);
+
+            flags[k] = (p0 < p1) & (p12 > p13) & (phase3 | phase4 | phase5 | phase6 | phase7);
+            any |= flags[k];
+        }
+
+        if (any) {
+            for (unsigned k = 0; k < 16; ++k) {
+                if (flags[k] && preamble_u16_test(&p[k]))
+                    out[count++] = base + k;
+            }
+        }
+
+        base += 16;
+    }
+
+    for (; base < len; ++base) {
+        if (preamble_u16_test(&in_align[base]))
+            out[count++] = base;
+    }
+
+    *out_count = count;
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+/* Two-stage version as above, with the first stage testing 8 offsets at a time using NEON */
+void STARCH_IMPL_REQUIRES(preamble_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned len, uint32_t *out, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    unsigned count = 0;
+    unsigned len8 = len >> 3;
+    unsigned base = 0;
+
+    while (len8--) {
+        const uint16_t *p = &in_align[base];
+
+        uint16x8_t p0 = vld1q_u16(p + 0);
+        uint16x8_t p1 = vld1q_u16(p + 1);
+        uint16x8_t p2 = vld1q_u16(p + 2);
+        uint16x8_t p3 = vld1q_u16(p + 3);
+        uint16x8_t p4 = vld1q_u16(p + 4);
+        uint16x8_t p5 = vld1q_u16(p + 5);
+        uint16x8_t p8 = vld1q_u16(p + 8);
+        uint16x8_t p9 = vld1q_u16(p + 9);
+        uint16x8_t p10 = vld1q_u16(p + 10);
+        uint16x8_t p11 = vld1q_u16(p + 11);
+        uint16x8_t p12 = vld1q_u16(p + 12);
+        uint16x8_t p13 = vld1q_u16(p + 13);
+
+        // rising/falling edges, common to all phases
+        uint16x8_t edges = vandq_u16(vcltq_u16(p0, p1), vcgtq_u16(p12, p13));
+
+        // shared peak tests
+        uint16x8_t peak_1 = vcgtq_u16(p1, p2);
+        uint16x8_t peak_3 = vandq_u16(vcltq_u16(p2, p3), vcgtq_u16(p3, p4));
+        uint16x8_t peak_4 = vandq_u16(vcltq_u16(p3, p4), vcgtq_u16(p4, p5));
+        uint16x8_t peak_9 = vandq_u16(vcltq_u16(p8, p9), vcgtq_u16(p9, p10));
+        uint16x8_t peak_10 = vandq_u16(vcltq_u16(p9, p10), vcgtq_u16(p10, p11));
+        uint16x8_t peak_12 = vcltq_u16(p11, p12);
+
+        // phase 3: peaks at 1,3,9,11-12
+        uint16x8_t phase3 = vandq_u16(vandq_u16(peak_1, peak_3), vandq_u16(peak_9, vcltq_u16(p10, p11)));
+        // phase 4: peaks at 1,3,9,12
+        uint16x8_t phase4 = vandq_u16(vandq_u16(peak_1, peak_3), vandq_u16(peak_9, peak_12));
+        // phase 5: peaks at 1,3-4,9-10,12
+        uint16x8_t phase5 = vandq_u16(vandq_u16(vandq_u16(peak_1, vcltq_u16(p2, p3)), vcgtq_u16(p4, p5)),
+                                      vandq_u16(vandq_u16(vcltq_u16(p8, p9), vcgtq_u16(p10, p11)), peak_12));
+        // phase 6: peaks at 1,4,10,12
+        uint16x8_t phase6 = vandq_u16(vandq_u16(peak_1, peak_4), vandq_u16(peak_10, peak_12));
+        // phase 7: peaks at 1-2,4,10,12
+        uint16x8_t phase7 = vandq_u16(vandq_u16(vcgtq_u16(p2, p3), peak_4), vandq_u16(peak_10, peak_12));
+
+        uint16x8_t phases = vorrq_u16(vorrq_u16(vorrq_u16(phase3, phase4), vorrq_u16(phase5, phase6)), phase7);
+        uint16x8_t flags = vandq_u16(edges, phases);
+
+        uint16x4_t any = vorr_u16(vget_low_u16(flags), vget_high_u16(flags));
+        if (vget_lane_u64(vreinterpret_u64_u16(any), 0)) {
+            uint16_t flags_array[8];
+            vst1q_u16(flags_array, flags);
+            for (unsigned k = 0; k < 8; ++k) {
+                if (flags_array[k] && preamble_u16_test(&p[k]))
+                    out[count++] = base + k;
+            }
+        }
+
+        base += 8;
+    }
+
+    for (; base < len; ++base) {
+        if (preamble_u16_test(&in_align[base]))
+            out[count++] = base;
+    }
+
+    *out_count = count;
+}
+
+#endif /* STARCH_FEATURE_NEON */
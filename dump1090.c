@@ -111,13 +111,19 @@ static void modesInitConfig(void) {
 
     // Now initialise things that should not be 0/NULL to their defaults
     Modes.gain                    = MODES_DEFAULT_GAIN;
+    Modes.sdr_gain                = -1;
     Modes.freq                    = MODES_DEFAULT_FREQ;
     Modes.fix_df                  = 1;
+    Modes.demod_strategy          = DEMOD_STAGED;
     Modes.interactive_display_ttl = MODES_INTERACTIVE_DISPLAY_TTL;
     Modes.json_interval           = 1000;
     Modes.json_stats_interval     = 60000;
     Modes.json_location_accuracy  = 1;
     Modes.maxRange                = 1852 * 300; // 300NM default max range
+    Modes.track_prealloc          = 1024;
+    Modes.fifo_buffers            = MODES_MAG_BUFFERS;
+    Modes.fifo_block_samples      = MODES_MAG_BUF_SAMPLES;
+    Modes.receiver_dedup_window   = MODES_RECEIVER_DEDUP_WINDOW;
     Modes.mode_ac_auto            = 1;
 
     Modes.net_heartbeat_interval = MODES_NET_HEARTBEAT_INTERVAL;
@@ -164,7 +170,10 @@ static void modesInit(void) {
         exit(1);
     }
 
-    if (!fifo_create(MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples)) {
+    // The main thread only moves to --demod-cpu once the other threads are
+    // started, so place the sample buffers for the demodulator explicitly
+    sample_memory_configure(Modes.sample_hugepages, Modes.sample_mlock, first_cpu_in_list(Modes.demod_cpus));
+    if (!(Modes.fifo = fifo_create(Modes.fifo_buffers, Modes.fifo_block_samples + Modes.trailing_samples, Modes.trailing_samples))) {
         fprintf(stderr, "Out of memory allocating FIFO\n");
         exit(1);
     }
@@ -203,9 +212,19 @@ static void modesInit(void) {
     }
 
     // Prepare error correction tables
-    modesChecksumInit(Modes.nfix_crc);
+    modesChecksumInit(Modes.nfix_crc, Modes.crc_cache_path);
     icaoFilterInit();
-    modeACInit();
+    trackInit();
+    demodulate2400Init();
+
+    // Demodulator stats go straight into stats_current unless there is a
+    // separate I/O thread, which owns stats_current
+    if (Modes.sdr_type == SDR_NONE)
+        Modes.io_thread_enabled = false;
+    pthread_mutex_init(&Modes.stats_demod_mutex, NULL);
+    reset_stats(&Modes.stats_demod);
+    reset_stats(&Modes.stats_demod_done);
+    Modes.demod_stats = Modes.io_thread_enabled ? &Modes.stats_demod : &Modes.stats_current;
 
     if (Modes.show_only)
         icaoFilterAdd(Modes.show_only);
@@ -239,7 +258,47 @@ static void *readerThreadEntryPoint(void *arg)
     if (!Modes.exit)
         Modes.exit = 2; // unexpected exit
 
-    fifo_halt(); // wakes the main thread, if it's still waiting
+    fifo_halt(Modes.fifo); // wakes the main thread, if it's still waiting
+    return NULL;
+}
+
+static void backgroundTasks(void);
+
+//
+// With --io-thread, tracking, network and json output run on this thread,
+// fed with decoded messages by the main thread via io_queue, so a slow
+// client or a large aircraft list can't hold up demodulation
+//
+static void *ioThreadEntryPoint(void *arg)
+{
+    MODES_NOTUSED(arg);
+
+    set_thread_name("dump1090-io");
+    set_thread_scheduling("dump1090-io", Modes.io_cpus, Modes.io_priority);
+    register_stats_thread(STATS_THREAD_IO);
+
+    for (;;) {
+        struct modesMessage mm;
+        struct timespec start_time;
+        uint64_t deadline = mstime() + 100;
+
+        start_cpu_timing(&start_time);
+
+        // handle queued messages, but don't starve the background work if
+        // the demodulator is producing them as fast as we can consume them
+        while (io_queue_get(&mm)) {
+            useModesMessage(&mm);
+            if (mstime() >= deadline)
+                break;
+        }
+
+        backgroundTasks();
+        end_cpu_timing(&start_time, &Modes.stats_current.background_cpu);
+
+        if (!io_queue_wait(100 /* milliseconds */) && io_queue_halted())
+            break;
+    }
+
     return NULL;
 }
 //
@@ -311,6 +370,7 @@ static void showDSP()
     SHOW(magnitude_sc16q11);
     SHOW(mean_power_u16);
     SHOW(count_above_u16);
+    SHOW(preamble_u16);
 
 #undef SHOW
 
@@ -348,10 +408,38 @@ static void showHelp(void)
 "--no-fix                 Disable error correction using CRC\n"
 "--no-fix-df              Disable error correction of the DF message field\n"
 "                          (reduces CPU requirements)\n"
+"--crc-cache <path>       Cache error correction tables in this file\n"
+"                          (speeds up startup with --fix-2bit)\n"
 "--enable-df24            Enable decoding of DF24 Comm-D ELM messages\n"
+"--demod-strategy <s>     Phase search used by the demodulator ('staged', 'full')\n"
+"                          (default: staged)\n"
+"--demod-threads <n>      Demodulate on <n> worker threads\n"
+"                          (default: 0, demodulate on the main thread)\n"
+"--io-thread              Run tracking, network and json output on a separate\n"
+"                          thread from demodulation\n"
+"--reader-cpu <cpus>      Run the SDR reader thread on these CPUs (e.g. 2 or 0-1,4)\n"
+"--demod-cpu <cpus>       Run the main and demodulator threads on these CPUs\n"
+"--io-cpu <cpus>          Run the I/O thread (--io-thread) on these CPUs\n"
+"--reader-priority <n>    Run the SDR reader thread with SCHED_FIFO priority <n>\n"
+"--demod-priority <n>     Run the main and demodulator threads with SCHED_FIFO\n"
+"                          priority <n>\n"
+"--io-priority <n>        Run the I/O thread with SCHED_FIFO priority <n>\n"
+"--fifo-buffers <n>       Queue up to <n> sample blocks between the SDR and the\n"
+"                          demodulator (default: 12)\n"
+"--fifo-block-size <n>    Read samples from the SDR in blocks of <n> samples, a\n"
+"                          multiple of 4096 (default: 131072)\n"
+"--sample-hugepages       Use huge pages for sample buffers where possible\n"
+"--sample-mlock           Lock sample buffers into memory\n"
+"--receiver <spec>        Also read from another SDR, given as\n"
+"                          <type>[,key=value...] (e.g. rtlsdr,device=1,gain=40);\n"
+"                          may be repeated. Supported types: rtlsdr, ifile\n"
+"--receiver-dedup-window <ms>  Pass on a message heard by several receivers\n"
+"                          only once within this time (default: 100)\n"
 "--lat <latitude>         Reference/receiver latitude for surface positions\n"
 "--lon <longitude>        Reference/receiver longitude for surface positions\n"
 "--max-range <distance>   Absolute maximum range for position decoding (in NM)\n"
+"--track-prealloc <n>     Preallocate records for <n> aircraft (default: 1024)\n"
+"--track-max <n>          Track at most <n> aircraft at once (default: no limit)\n"
 "\n"
 // ------ 80 char limit ----------------------------------------------------------|
 "      Adaptive gain\n"
@@ -402,6 +490,8 @@ static void showHelp(void)
 "--net-verbatim           Make output connections default to verbatim mode\n"
 "                           (forward all messages without correction)\n"
 "--forward-mlat           Allow forwarding of received mlat results\n"
+"--forward-only           Only check messages and forward them to raw and Beast\n"
+"                          outputs; no decoding, aircraft tracking or SBS output\n"
 "\n"
 // ------ 80 char limit ----------------------------------------------------------|
 "      Stats and json output\n"
@@ -439,9 +529,21 @@ static void showHelp(void)
 void flush_stats(uint64_t now);
 void flush_stats(uint64_t now)
 {
+    if (Modes.io_thread_enabled) {
+        // pick up stats from buffers completed by the demodulator thread
+        pthread_mutex_lock(&Modes.stats_demod_mutex);
+        add_stats(&Modes.stats_demod_done, &Modes.stats_current, &Modes.stats_current);
+        reset_stats(&Modes.stats_demod_done);
+        pthread_mutex_unlock(&Modes.stats_demod_mutex);
+    }
+
     if (Modes.sdr_type != SDR_NONE) {
-        Modes.stats_current.sdr_gain = sdrGetGain();
+        // with --io-thread this runs on the I/O thread, while adaptive gain
+        // changes the gain on the demodulator thread
+        Modes.stats_current.sdr_gain = atomic_load_explicit(&Modes.sdr_gain, memory_order_relaxed);
     }
+    trackUpdateStats(&Modes.stats_current);
+    update_thread_stats(&Modes.stats_current);
 
     add_stats(&Modes.stats_current, &Modes.stats_periodic, &Modes.stats_periodic);
     add_stats(&Modes.stats_current, &Modes.stats_alltime, &Modes.stats_alltime);
@@ -485,6 +587,14 @@ static void backgroundTasks(void) {
     // copy out reader CPU time and reset it
     sdrUpdateCPUTime(&Modes.stats_current.reader_cpu);
 
+    // copy out FIFO telemetry from the reader threads and reset it
+    struct fifo_stats fifo_stats;
+    fifo_take_stats(Modes.fifo, &fifo_stats);
+    receiversTakeFifoStats(&fifo_stats);
+    if (fifo_stats.high_water > Modes.stats_current.fifo_high_water)
+        Modes.stats_current.fifo_high_water = fifo_stats.high_water;
+    Modes.stats_current.fifo_overruns += fifo_stats.overruns;
+
     // always update end time so it is current when requests arrive
     Modes.stats_current.end = mstime();
 
@@ -575,6 +685,59 @@ static void backgroundTasks(void) {
 //
 //=========================================================================
 //
+// With an I/O thread, hand the demodulator stats gathered so far to it; it
+// merges them into stats_current when it next flushes stats
+//
+static void handOffDemodStats(void)
+{
+    if (!Modes.io_thread_enabled)
+        return;
+
+    Modes.stats_demod.end = mstime();
+    pthread_mutex_lock(&Modes.stats_demod_mutex);
+    add_stats(&Modes.stats_demod, &Modes.stats_demod_done, &Modes.stats_demod_done);
+    pthread_mutex_unlock(&Modes.stats_demod_mutex);
+    reset_stats(&Modes.stats_demod);
+}
+
+//
+//=========================================================================
+//
+// Demodulate (or, if demodulation was done by a worker thread, deliver the
+// results from) one buffer, then return it to the FIFO freelist
+//
+static void processBuffer(struct mag_buf *buf)
+{
+    struct timespec start_time;
+
+    start_cpu_timing(&start_time);
+    if (Modes.demod_threads) {
+        // a worker that couldn't allocate stats leaves them NULL, with no messages
+        if (buf->stats)
+            add_stats(buf->stats, Modes.demod_stats, Modes.demod_stats);
+        demodulate2400Deliver(buf);
+    } else {
+        add_block_latency(Modes.demod_stats, buf);
+        demodulate2400(buf);
+    }
+    if (Modes.mode_ac) {
+        demodulate2400AC(buf);
+    }
+
+    Modes.demod_stats->samples_processed += buf->validLength - buf->overlap;
+    Modes.demod_stats->samples_dropped += buf->dropped;
+    Modes.demod_stats->receiver_samples_processed[0] += buf->validLength - buf->overlap;
+    Modes.demod_stats->receiver_samples_dropped[0] += buf->dropped;
+    if (buf->dropped)
+        ++Modes.demod_stats->drop_events;
+    end_cpu_timing(&start_time, &Modes.demod_stats->demod_cpu);
+
+    // Return the buffer to the FIFO freelist for reuse
+    fifo_release(Modes.fifo, buf);
+
+    handOffDemodStats();
+}
+
 //
 //=========================================================================
 //
@@ -632,6 +795,83 @@ int main(int argc, char **argv) {
             Modes.nfix_crc = 0;
         } else if (!strcmp(argv[j],"--no-fix-df")) {
             Modes.fix_df = 0;
+        } else if (!strcmp(argv[j], "--crc-cache") && more) {
+            free(Modes.crc_cache_path);
+            Modes.crc_cache_path = strdup(argv[++j]);
+        } else if (!strcmp(argv[j], "--demod-strategy") && more) {
+            char *strategy = argv[++j];
+            if (!strcmp(strategy, "staged")) {
+                Modes.demod_strategy = DEMOD_STAGED;
+            } else if (!strcmp(strategy, "full")) {
+                Modes.demod_strategy = DEMOD_FULL;
+            } else {
+                fprintf(stderr, "Demodulator strategy '%s' not recognized.\n", strategy);
+                exit(1);
+            }
+        } else if (!strcmp(argv[j], "--demod-threads") && more) {
+            int threads = atoi(argv[++j]);
+            if (threads < 0 || threads > MODES_DEMOD_THREADS_MAX) {
+                fprintf(stderr, "--demod-threads must be between 0 and %d\n", MODES_DEMOD_THREADS_MAX);
+                exit(1);
+            }
+            Modes.demod_threads = threads;
+        } else if (!strcmp(argv[j], "--fifo-buffers") && more) {
+            int buffers = atoi(argv[++j]);
+            if (buffers < 2 || buffers > MODES_MAG_BUFFERS_MAX) {
+                fprintf(stderr, "--fifo-buffers must be between 2 and %d\n", MODES_MAG_BUFFERS_MAX);
+                exit(1);
+            }
+            Modes.fifo_buffers = buffers;
+        } else if (!strcmp(argv[j], "--fifo-block-size") && more) {
+            int samples = atoi(argv[++j]);
+            if (samples < MODES_MAG_BUF_SAMPLES_MIN || samples > MODES_MAG_BUF_SAMPLES_MAX || samples % MODES_MAG_BUF_SAMPLES_ALIGN) {
+                fprintf(stderr, "--fifo-block-size must be a multiple of %d between %d and %d\n",
+                        MODES_MAG_BUF_SAMPLES_ALIGN, MODES_MAG_BUF_SAMPLES_MIN, MODES_MAG_BUF_SAMPLES_MAX);
+                exit(1);
+            }
+            Modes.fifo_block_samples = samples;
+        } else if (!strcmp(argv[j], "--sample-hugepages")) {
+            Modes.sample_hugepages = true;
+        } else if (!strcmp(argv[j], "--sample-mlock")) {
+            Modes.sample_mlock = true;
+        } else if (!strcmp(argv[j], "--receiver") && more) {
+            if (!receiverAdd(argv[++j]))
+                exit(1);
+        } else if (!strcmp(argv[j], "--receiver-dedup-window") && more) {
+            int window = atoi(argv[++j]);
+            if (window < 0) {
+                fprintf(stderr, "--receiver-dedup-window must not be negative\n");
+                exit(1);
+            }
+            Modes.receiver_dedup_window = window;
+        } else if ((!strcmp(argv[j], "--reader-cpu") || !strcmp(argv[j], "--demod-cpu") || !strcmp(argv[j], "--io-cpu")) && more) {
+            char *option = argv[j];
+            char *cpus = argv[++j];
+            if (!valid_cpu_list(cpus)) {
+                fprintf(stderr, "%s: CPU list '%s' not recognized.\n", option, cpus);
+                exit(1);
+            }
+            if (!strcmp(option, "--reader-cpu"))
+                Modes.reader_cpus = strdup(cpus);
+            else if (!strcmp(option, "--demod-cpu"))
+                Modes.demod_cpus = strdup(cpus);
+            else
+                Modes.io_cpus = strdup(cpus);
+        } else if ((!strcmp(argv[j], "--reader-priority") || !strcmp(argv[j], "--demod-priority") || !strcmp(argv[j], "--io-priority")) && more) {
+            char *option = argv[j];
+            int priority = atoi(argv[++j]);
+            if (priority < sched_get_priority_min(SCHED_FIFO) || priority > sched_get_priority_max(SCHED_FIFO)) {
+                fprintf(stderr, "%s must be between %d and %d\n", option, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+                exit(1);
+            }
+            if (!strcmp(option, "--reader-priority"))
+                Modes.reader_priority = priority;
+            else if (!strcmp(option, "--demod-priority"))
+                Modes.demod_priority = priority;
+            else
+                Modes.io_priority = priority;
+        } else if (!strcmp(argv[j], "--io-thread")) {
+            Modes.io_thread_enabled = true;
         } else if (!strcmp(argv[j],"--no-crc-check")) {
             fprintf(stderr, "warning: --no-crc-check no longer supported, option ignored (please raise an issue on github if you have a usecase that needs this)\n");
         } else if (!strcmp(argv[j],"--phase-enhance")) {
@@ -697,6 +937,8 @@ int main(int argc, char **argv) {
             Modes.net_verbatim = 1;
         } else if (!strcmp(argv[j],"--forward-mlat")) {
             Modes.forward_mlat = 1;
+        } else if (!strcmp(argv[j],"--forward-only")) {
+            Modes.forward_only = 1;
         } else if (!strcmp(argv[j],"--onlyaddr")) {
             Modes.onlyaddr = 1;
         } else if (!strcmp(argv[j],"--metric")) {
@@ -728,6 +970,20 @@ int main(int argc, char **argv) {
             Modes.fUserLon = atof(argv[++j]);
         } else if (!strcmp(argv[j],"--max-range") && more) {
             Modes.maxRange = atof(argv[++j]) * 1852.0; // convert to metres
+        } else if (!strcmp(argv[j],"--track-prealloc") && more) {
+            int prealloc = atoi(argv[++j]);
+            if (prealloc < 0 || prealloc > MODES_TRACK_PREALLOC_MAX) {
+                fprintf(stderr, "--track-prealloc must be between 0 and %d\n", MODES_TRACK_PREALLOC_MAX);
+                exit(1);
+            }
+            Modes.track_prealloc = prealloc;
+        } else if (!strcmp(argv[j],"--track-max") && more) {
+            int max = atoi(argv[++j]);
+            if (max < 0) {
+                fprintf(stderr, "--track-max must not be negative (use 0 for no limit)\n");
+                exit(1);
+            }
+            Modes.track_max = max;
         } else if (!strcmp(argv[j],"--debug") && more) {
             fprintf(stderr, "warning: --debug is obsolete and ignored\n");
             ++j;
@@ -826,9 +1082,27 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
+    if (Modes.sdr_type == SDR_NONE && Modes.receiver_count) {
+        fprintf(stderr, "--receiver needs a primary SDR; it cannot be used with --net-only or --device-type none\n");
+        exit(1);
+    }
+
     if (Modes.nfix_crc > MODES_MAX_BITERRORS)
         Modes.nfix_crc = MODES_MAX_BITERRORS;
 
+    if (Modes.forward_only) {
+        if (Modes.interactive) {
+            fprintf(stderr, "--forward-only cannot be used with --interactive\n");
+            exit(1);
+        }
+
+        // these outputs need decoded messages / aircraft state
+        free(Modes.net_output_sbs_ports);
+        Modes.net_output_sbs_ports = strdup("0");
+        free(Modes.net_output_stratux_ports);
+        Modes.net_output_stratux_ports = strdup("0");
+    }
+
     // Initialization
     log_with_timestamp("%s %s starting up.", MODES_DUMP1090_VARIANT, MODES_DUMP1090_VERSION);
     modesInit();
@@ -836,6 +1110,12 @@ int main(int argc, char **argv) {
     if (!sdrOpen()) {
         exit(1);
     }
+    if (Modes.sdr_type != SDR_NONE)
+        atomic_store_explicit(&Modes.sdr_gain, sdrGetGain(), memory_order_relaxed);
+
+    if (!receiversOpen()) {
+        exit(1);
+    }
 
     if (Modes.net) {
         modesInitNet();
@@ -886,34 +1166,70 @@ int main(int argc, char **argv) {
     } else {
         int watchdogCounter = 300; // about 30 seconds
 
+        if (Modes.demod_threads && !demod_pool_create(Modes.demod_threads)) {
+            fprintf(stderr, "Failed to start demodulator threads\n");
+            exit(1);
+        }
+
+        if (Modes.io_thread_enabled) {
+            if (!io_queue_create(IO_QUEUE_SIZE)) {
+                fprintf(stderr, "Failed to create I/O thread queue\n");
+                exit(1);
+            }
+            pthread_create(&Modes.io_thread, NULL, ioThreadEntryPoint, NULL);
+        }
+
         // Create the thread that will read the data from the device.
         pthread_create(&Modes.reader_thread, NULL, readerThreadEntryPoint, NULL);
 
-        while (!Modes.exit) {
-            // get the next sample buffer off the FIFO; wait only up to 100ms
-            // this is fairly aggressive as all our network I/O runs out of the background work!
-            struct mag_buf *buf = fifo_dequeue(100 /* milliseconds */);
-            struct timespec start_time;
+        if (!receiversStart()) {
+            fprintf(stderr, "Failed to start additional receivers\n");
+            exit(1);
+        }
 
-            if (buf) {
-                // Process one buffer
+        // The main thread runs demodulation. Set its scheduling only now, so
+        // the threads started above don't inherit it.
+        set_thread_scheduling("dump1090", Modes.demod_cpus, Modes.demod_priority);
+        register_stats_thread(STATS_THREAD_DEMOD);
 
-                start_cpu_timing(&start_time);
-                demodulate2400(buf);
-                if (Modes.mode_ac) {
-                    demodulate2400AC(buf);
+        while (!Modes.exit) {
+            struct mag_buf *buf;
+            struct timespec start_time;
+            bool processed = false;
+
+            if (Modes.demod_threads) {
+                // keep the demodulator threads busy; only wait on the FIFO
+                // if they have nothing to do
+                unsigned pending = demod_pool_pending();
+                while (pending < demod_pool_capacity() && (buf = fifo_dequeue(Modes.fifo, pending ? 0 : 100 /* milliseconds */))) {
+                    demod_pool_submit(buf);
+                    ++pending;
                 }
 
-                Modes.stats_current.samples_processed += buf->validLength - buf->overlap;
-                Modes.stats_current.samples_dropped += buf->dropped;
-                end_cpu_timing(&start_time, &Modes.stats_current.demod_cpu);
+                // take results in the order they were received; wait only up to 100ms
+                buf = pending ? demod_pool_collect(100 /* milliseconds */) : NULL;
+            } else {
+                // get the next sample buffer off the FIFO; wait only up to 100ms
+                // this is fairly aggressive as all our network I/O runs out of the background work!
+                buf = fifo_dequeue(Modes.fifo, 100 /* milliseconds */);
+            }
 
-                // Return the buffer to the FIFO freelist for reuse
-                fifo_release(buf);
+            while (buf) {
+                processBuffer(buf);
 
                 // We got something so reset the watchdog
                 watchdogCounter = 300;
-            } else {
+                processed = true;
+
+                // deliver any other results that are already done
+                buf = Modes.demod_threads ? demod_pool_collect(0) : NULL;
+            }
+
+            // then whatever the additional receivers have demodulated
+            if (Modes.receiver_count && receiversDeliver())
+                handOffDemodStats();
+
+            if (!processed) {
                 // Nothing to process this time around.
                 if (--watchdogCounter <= 0) {
                     log_with_timestamp("No samples received from the SDR for a long time. Maybe the hardware is wedged? Giving up.");
@@ -921,14 +1237,36 @@ int main(int argc, char **argv) {
                 }
             }
 
-            start_cpu_timing(&start_time);
-            backgroundTasks();
-            end_cpu_timing(&start_time, &Modes.stats_current.background_cpu);
+            if (!Modes.io_thread_enabled) {
+                start_cpu_timing(&start_time);
+                backgroundTasks();
+                end_cpu_timing(&start_time, &Modes.stats_current.background_cpu);
+            }
         }
 
         log_with_timestamp("Waiting for receive thread termination");
         sdrStop();   // tell reader thread to wake up and exit
-        fifo_halt(); // Reader thread should do this anyway, but just in case..
+        fifo_halt(Modes.fifo); // Reader thread should do this anyway, but just in case..
+
+        if (Modes.demod_threads) {
+            // Finish off anything the demodulator threads already have, so we don't throw away trailing data
+            struct mag_buf *buf;
+            while (demod_pool_pending() && (buf = demod_pool_collect(1000 /* milliseconds */)))
+                processBuffer(buf);
+            demod_pool_destroy();
+        }
+
+        if (Modes.receiver_count) {
+            receiversStop();
+            handOffDemodStats();
+        }
+
+        if (Modes.io_thread_enabled) {
+            // Let the I/O thread finish off any queued messages, then wait for it
+            io_queue_halt();
+            pthread_join(Modes.io_thread, NULL);
+            io_queue_destroy();
+        }
 
         // Wait on reader thread exit
         if (join_thread(Modes.reader_thread, NULL, 30000) == ETIMEDOUT) {
@@ -947,7 +1285,8 @@ int main(int argc, char **argv) {
     }
 
     sdrClose();
-    fifo_destroy();
+    receiversClose();
+    fifo_destroy(Modes.fifo);
 
     if (Modes.exit == 1) {
         log_with_timestamp("Normal exit.");
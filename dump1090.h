@@ -91,8 +91,17 @@
 #define MODES_DEFAULT_HEIGHT       700
 #define MODES_RTL_BUFFERS          15                         // Number of RTL buffers
 #define MODES_RTL_BUF_SIZE         (16*16384)                 // 256k
-#define MODES_MAG_BUF_SAMPLES      (MODES_RTL_BUF_SIZE / 2)   // Each sample is 2 bytes
-#define MODES_MAG_BUFFERS          12                         // Number of magnitude buffers (should be smaller than RTL_BUFFERS for flowcontrol to work)
+#define MODES_MAG_BUF_SAMPLES      (MODES_RTL_BUF_SIZE / 2)   // Default new samples per magnitude buffer (--fifo-block-size); each RTL sample is 2 bytes
+#define MODES_MAG_BUF_SAMPLES_MIN  16384                      // Smallest allowed --fifo-block-size
+#define MODES_MAG_BUF_SAMPLES_MAX  (16*1048576)               // Largest allowed --fifo-block-size
+#define MODES_MAG_BUF_SAMPLES_ALIGN 4096                      // --fifo-block-size must be a multiple of this (SDR transfer size constraints)
+#define MODES_MAG_BUFFERS          12                         // Default number of magnitude buffers in the FIFO's sample ring (--fifo-buffers)
+#define MODES_MAG_BUFFERS_MAX      1024                       // Largest allowed --fifo-buffers
+#define MODES_DEMOD_THREADS_MAX    64                         // Largest allowed --demod-threads
+#define MODES_TRACK_PREALLOC_MAX   100000                     // Largest allowed --track-prealloc
+#define MODES_MAX_RECEIVERS        8                          // Most SDRs in one process: the primary SDR plus up to 7 --receiver
+#define MODES_RECEIVER_DEDUP_WINDOW 100                       // Default --receiver-dedup-window, milliseconds
+#define IO_QUEUE_SIZE              8192                       // Number of decoded messages that can be queued for the I/O thread (--io-thread)
 #define MODES_LEGACY_AUTO_GAIN     -10                        // old gain value for "use automatic gain"
 #define MODES_DEFAULT_GAIN         999999                     // Use default SDR gain
 #define MODES_MSG_SQUELCH_DB       4.0                        // Minimum SNR, in dB
@@ -287,13 +296,16 @@ typedef enum {
 #include "anet.h"
 #include "net_io.h"
 #include "crc.h"
-#include "demod_2400.h"
 #include "stats.h"
 #include "cpr.h"
 #include "icao_filter.h"
 #include "convert.h"
 #include "sdr.h"
 #include "fifo.h"
+#include "sample_memory.h"
+#include "demod_pool.h"
+#include "receiver.h"
+#include "io_queue.h"
 #include "adaptive.h"
 
 //======================== structure declarations =========================
@@ -302,15 +314,26 @@ typedef enum {
     SDR_NONE, SDR_IFILE, SDR_RTLSDR, SDR_BLADERF, SDR_HACKRF, SDR_LIMESDR, SDR_SOAPYSDR
 } sdr_type_t;
 
+typedef enum {
+    DEMOD_FULL,      // slice and score every phase that has a plausible DF
+    DEMOD_STAGED     // slice the DF of every phase first, then only the phases that could improve on the best score so far
+} demod_strategy_t;
+
 // Program global state
 struct _Modes {                             // Internal state
     pthread_t       reader_thread;
+    pthread_t       io_thread;                            // runs tracking, network and json output if io_thread_enabled
 
     pthread_mutex_t reader_cpu_mutex;                     // mutex protecting reader_cpu_accumulator
     struct timespec reader_cpu_accumulator;               // accumulated CPU time used by the reader thread
     struct timespec reader_cpu_start;                     // start time for the last reader thread CPU measurement
 
+    struct fifo    *fifo;                                 // FIFO from the (primary) SDR to the demodulator
     unsigned        trailing_samples;                     // extra trailing samples in magnitude buffers
+    unsigned        fifo_buffers;                         // number of magnitude buffers in the SDR to demodulator FIFO
+    unsigned        fifo_block_samples;                   // new samples per magnitude buffer, excluding trailing samples
+    bool            sample_hugepages;                     // back sample buffers with huge pages where possible
+    bool            sample_mlock;                         // lock sample buffers into memory
     double          sample_rate;                          // actual sample rate in use (in hz)
 
     uint16_t       *log10lut;        // Magnitude -> log10 lookup table
@@ -323,6 +346,8 @@ struct _Modes {                             // Internal state
     char *        dev_name;
     float         gain;              // value in dB, or MODES_AUTO_GAIN, or MODES_MAX_GAIN
     int           freq;
+    atomic_int    sdr_gain;          // current gain step (-1 if unknown); kept up to date by the thread that
+                                     // changes the gain, so other threads needn't ask the SDR
 
     // Networking
     char           aneterr[ANET_ERR_LEN];
@@ -348,9 +373,21 @@ struct _Modes {                             // Internal state
     // Configuration
     sdr_type_t sdr_type;             // where are we getting data from?
     int   nfix_crc;                  // Number of crc bit error(s) to correct
+    char *crc_cache_path;            // File to cache error correction tables in, or NULL
     int   check_crc;                 // Only display messages with good CRC
     int   fix_df;                    // Try to correct damage to the DF field, as well as the main message body
     int   enable_df24;               // Enable decoding of DF24..DF31 (Comm-D ELM)
+    demod_strategy_t demod_strategy; // How demodulate2400 tries the possible phases of a preamble
+    unsigned demod_threads;          // Number of demodulator worker threads (0 = demodulate on the main thread)
+    bool  io_thread_enabled;         // Run tracking, network and json output on a separate thread from demodulation
+    char *reader_cpus;               // CPU list for the SDR reader thread (--reader-cpu), or NULL
+    char *demod_cpus;                // CPU list for the main and demodulator threads (--demod-cpu), or NULL
+    char *io_cpus;                   // CPU list for the I/O thread (--io-cpu), or NULL
+    int   reader_priority;           // SCHED_FIFO priority for the SDR reader thread, or 0
+    int   demod_priority;            // SCHED_FIFO priority for the main and demodulator threads, or 0
+    int   io_priority;               // SCHED_FIFO priority for the I/O thread, or 0
+    unsigned receiver_count;         // Number of additional receivers (--receiver), see receiver.h
+    unsigned receiver_dedup_window;  // Messages heard by several receivers within this many ms are passed on once
     int   raw;                       // Raw output format
     int   mode_ac;                   // Enable decoding of SSR Modes A & C
     int   mode_ac_auto;              // allow toggling of A/C by Beast commands
@@ -369,6 +406,7 @@ struct _Modes {                             // Internal state
     int   net_sndbuf_size;           // TCP output buffer size (64Kb * 2^n)
     int   net_verbatim;              // if true, Beast output connections default to verbatim mode
     int   forward_mlat;              // allow forwarding of mlat messages to output ports
+    int   forward_only;              // only validate messages and forward them to raw/Beast outputs; no field decoding or tracking
     int   quiet;                     // Suppress stdout
     uint32_t show_only;              // Only show messages from this ICAO
     int   interactive;               // Interactive mode
@@ -401,6 +439,8 @@ struct _Modes {                             // Internal state
     double fUserLon;                // Users receiver/antenna lat/lon needed for initial surface location
     int    bUserFlags;              // Flags relating to the user details
     double maxRange;                // Absolute maximum decoding range, in *metres*
+    unsigned track_prealloc;        // Number of aircraft records to preallocate
+    unsigned track_max;             // Maximum number of aircraft records (0 = no limit)
 
     // State tracking
     struct aircraft *aircrafts;
@@ -415,6 +455,11 @@ struct _Modes {                             // Internal state
     struct stats stats_5min;        // Accumulated stats from the last 5 complete 1-minute windows
     struct stats stats_15min;       // Accumulated stats from the last 15 complete 1-minute windows
 
+    struct stats *demod_stats;      // Where the demodulator collects stats: &stats_current, or &stats_demod when using an I/O thread
+    struct stats stats_demod;       // Stats collected by the demodulator thread when using an I/O thread, for the current buffer
+    struct stats stats_demod_done;  // Stats from completed buffers waiting to be merged into stats_current; protected by stats_demod_mutex
+    pthread_mutex_t stats_demod_mutex;
+
     // Adaptive gain config
     float adaptive_min_gain_db;
     float adaptive_max_gain_db;
@@ -454,6 +499,7 @@ struct modesMessage {
     uint64_t      timestampMsg;                   // Timestamp of the message (12MHz clock)
     uint64_t      sysTimestampMsg;                // Timestamp of the message (system time)
     int           remote;                         // If set this message is from a remote station
+    unsigned      receiver;                       // Local receiver that demodulated this message: 0 = the primary SDR, N = the Nth --receiver
     double        signalLevel;                    // RSSI, in the range [0..1], as a fraction of full-scale power
     int           score;                          // Scoring from scoreModesMessage, if used
     int           reliable;                       // is this a "reliable" message (uncorrected DF11/DF17/DF18)?
@@ -498,6 +544,7 @@ struct modesMessage {
     unsigned squawk_valid : 1;
     unsigned callsign_valid : 1;
     unsigned cpr_valid : 1;
+    unsigned cpr_filtered : 1;   // position was present but discarded as a known-bad encoding
     unsigned cpr_odd : 1;
     unsigned cpr_decoded : 1;
     unsigned cpr_relative : 1;
@@ -655,9 +702,11 @@ struct modesMessage {
 };
 
 // This one needs modesMessage:
+#include "comm_b.h" // struct commb_history, used by track.h
 #include "track.h"
+#include "gillham_tables.h" // needs modeAToIndex from track.h
 #include "mode_s.h"
-#include "comm_b.h"
+#include "demod_2400.h" // needs struct score_context from mode_s.h
 
 // ======================== function declarations =========================
 
@@ -670,9 +719,6 @@ extern "C" {
 //
 int  detectModeA       (uint16_t *m, struct modesMessage *mm);
 void decodeModeAMessage(struct modesMessage *mm, int ModeA);
-void modeACInit();
-int modeAToModeC (unsigned int modeA);
-unsigned modeCToModeA (int modeC);
 
 //
 // Functions exported from interactive.c
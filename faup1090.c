@@ -104,9 +104,8 @@ static void faupInit(void) {
     }
 
     // Prepare error correction tables
-    modesChecksumInit(1);
+    modesChecksumInit(1, NULL);
     icaoFilterInit();
-    modeACInit();
 }
 
 //
@@ -19,6 +19,7 @@
 
 #include "fifo.h"
 #include "util.h"
+#include "sample_memory.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -26,236 +27,490 @@
 #include <string.h>
 #include <pthread.h>
 #include <assert.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+// Each FIFO has exactly one producer (an SDR reader thread, which calls
+// fifo_acquire and fifo_enqueue) and one consumer (the thread demodulating
+// that SDR's data, which calls fifo_dequeue and fifo_release). Buffers circulate between them through
+// two single-producer / single-consumer rings: "queue" carries filled buffers
+// to the consumer, "freelist" carries released buffers back to the producer.
+//
+// Neither ring needs a lock. The mutex and condition variables are only used
+// when one side has to block: a side that is about to wait sets its "waiting"
+// flag, and the other side only takes the mutex to signal it when that flag
+// is set.
+//
+// The sample data of all buffers lives in one ring of samples. Each buffer's
+// data starts "overlap" samples before the end of the previous buffer's data,
+// so the overlap is shared rather than copied. Where possible the ring's pages
+// are mapped twice, back to back, so that a buffer that runs past the end of
+// the ring continues seamlessly at the start. Buffers are only ever in flight
+// in the order they were acquired, so the ring is sized to hold every buffer
+// at its full length without the producer overwriting data that is still in
+// use.
+//
+// The new samples of every buffer start on a SAMPLE_ALIGNMENT boundary, so
+// the SDR converters can always use the aligned starch kernels. When a buffer
+// ends on an unaligned sample, the next one leaves a small gap and takes a
+// copy of the overlap instead of sharing it.
+
+struct fifo_ring {
+    _Alignas(64) atomic_uint head;  // next slot to read; written only by the ring's consumer
+    _Alignas(64) atomic_uint tail;  // next slot to write; written only by the ring's producer
+    _Alignas(64) struct mag_buf **slots;
+    unsigned mask;                  // ring size - 1, ring size is a power of two
+};
+
+struct fifo {
+    struct fifo_ring queue;         // buffers awaiting demodulation
+    struct fifo_ring freelist;      // preallocated buffers available to the producer
+    atomic_bool halted;             // true if queue has been halted
+
+    struct mag_buf *buffers;        // all preallocated buffers
+    unsigned buffer_count;
+
+    pthread_mutex_t mutex;          // mutex protecting the condition variables
+    pthread_cond_t notempty_cond;   // condition used to signal FIFO-not-empty
+    pthread_cond_t empty_cond;      // condition used to signal FIFO-empty
+    pthread_cond_t free_cond;       // condition used to signal freelist-not-empty
+    atomic_bool notempty_waiting;   // consumer is (about to be) waiting on notempty_cond
+    atomic_bool empty_waiting;      // producer is (about to be) waiting on empty_cond
+    atomic_bool free_waiting;       // producer is (about to be) waiting on free_cond
+
+    atomic_uint high_water;         // most buffers queued at once, since the last fifo_take_stats
+    atomic_uint overruns;           // failed non-blocking fifo_acquire calls, since the last fifo_take_stats
+
+    uint16_t *sample_ring;          // sample data for all buffers
+    size_t sample_ring_size;        // size of the ring, in samples
+    size_t sample_ring_bytes;       // size of the ring mapping (or allocation), in bytes
+    bool sample_ring_mirrored;      // true if the ring is mapped twice, back to back
+    size_t sample_ring_pos;         // ring offset of the next new sample; only used by the producer
+    unsigned release_index;         // index of the next buffer to be released; only used by the consumer
+
+    unsigned overlap_length;        // desired overlap size in samples
+    unsigned aligned_overlap;       // overlap_length rounded up to a multiple of SAMPLE_ALIGN_SAMPLES
+    size_t sample_ring_slack;       // most extra ring space one buffer can use for alignment and discontinuities
+};
+
+#define SAMPLE_ALIGN_SAMPLES (SAMPLE_ALIGNMENT / sizeof(uint16_t))
+
+// Round a sample ring offset up to an aligned sample
+static size_t align_samples(size_t pos)
+{
+    return (pos + SAMPLE_ALIGN_SAMPLES - 1) / SAMPLE_ALIGN_SAMPLES * SAMPLE_ALIGN_SAMPLES;
+}
 
-static pthread_mutex_t fifo_mutex = PTHREAD_MUTEX_INITIALIZER;        // mutex protecting the queues
-static pthread_cond_t fifo_notempty_cond = PTHREAD_COND_INITIALIZER;  // condition used to signal FIFO-not-empty
-static pthread_cond_t fifo_empty_cond = PTHREAD_COND_INITIALIZER;     // condition used to signal FIFO-empty
-static pthread_cond_t fifo_free_cond = PTHREAD_COND_INITIALIZER;      // condition used to signal freelist-not-empty
-static struct mag_buf *fifo_head;          // head of queued buffers awaiting demodulation
-static struct mag_buf *fifo_tail;          // tail of queued buffers awaiting demodulation
-static struct mag_buf *fifo_freelist;      // freelist of preallocated buffers
-static bool fifo_halted;                   // true if queue has been halted
+static bool ring_create(struct fifo_ring *ring, unsigned count)
+{
+    unsigned size = 1;
+    while (size < count)
+        size <<= 1;
 
-static unsigned overlap_length;     // desired overlap size in samples (size of overlap_buffer)
-static uint16_t *overlap_buffer;    // buffer used to save overlapping data
+    if (!(ring->slots = calloc(size, sizeof(ring->slots[0]))))
+        return false;
 
-// Create the queue structures. Not threadsafe.
-bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    return true;
+}
+
+static void ring_destroy(struct fifo_ring *ring)
 {
-    if (!(overlap_buffer = calloc(overlap, sizeof(overlap_buffer[0]))))
-        goto nomem;
+    free(ring->slots);
+    ring->slots = NULL;
+}
 
-    overlap_length = overlap;
+static bool ring_empty(struct fifo_ring *ring)
+{
+    return atomic_load_explicit(&ring->head, memory_order_acquire) == atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
 
-    for (unsigned i = 0; i < buffer_count; ++i) {
-        struct mag_buf *newbuf;
-        if (!(newbuf = calloc(1, sizeof(*newbuf)))) {
-            goto nomem;
-        }
+// Add a buffer to the ring. Only called by the ring's producer. The ring is
+// big enough to hold every buffer, so it is never full.
+static void ring_push(struct fifo_ring *ring, struct mag_buf *buf)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    assert(tail - atomic_load_explicit(&ring->head, memory_order_acquire) <= ring->mask);
+    ring->slots[tail & ring->mask] = buf;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
 
-        if (!(newbuf->data = calloc(buffer_size, sizeof(newbuf->data[0])))) {
-            free(newbuf);
-            goto nomem;
-        }
+// Remove a buffer from the ring, or return NULL if it is empty. Only called by
+// the ring's consumer.
+static struct mag_buf *ring_pop(struct fifo_ring *ring)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head == atomic_load_explicit(&ring->tail, memory_order_acquire))
+        return NULL;
 
-        newbuf->totalLength = buffer_size;
-        newbuf->next = fifo_freelist;
-        fifo_freelist = newbuf;
+    struct mag_buf *buf = ring->slots[head & ring->mask];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return buf;
+}
+
+// Wake the other side if it is waiting on "cond". The fence pairs with the
+// one in fifo_wait, so that either the waiter sees the ring update that was
+// just made, or we see its waiting flag.
+static void fifo_wake(struct fifo *fifo, atomic_bool *waiting, pthread_cond_t *cond)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiting, memory_order_relaxed)) {
+        pthread_mutex_lock(&fifo->mutex);
+        pthread_cond_broadcast(cond);
+        pthread_mutex_unlock(&fifo->mutex);
     }
+}
 
-    return true;
+// Block on "cond" until ready() returns true, the FIFO is halted, or the
+// deadline passes (if deadline is non-NULL). Returns the final value of ready().
+static bool fifo_wait(struct fifo *fifo, atomic_bool *waiting, pthread_cond_t *cond, bool (*ready)(struct fifo *), const struct timespec *deadline, const char *what)
+{
+    bool result;
 
- nomem:
-    fifo_destroy();
-    return false;
+    pthread_mutex_lock(&fifo->mutex);
+    atomic_store_explicit(waiting, true, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    while (!(result = ready(fifo)) && !atomic_load(&fifo->halted)) {
+        int err = deadline ? pthread_cond_timedwait(cond, &fifo->mutex, deadline) : pthread_cond_wait(cond, &fifo->mutex);
+        if (err) {
+            if (err != ETIMEDOUT) {
+                fprintf(stderr, "%s: pthread_cond_wait unexpectedly returned %s\n", what, strerror(err));
+            }
+
+            break; // done waiting
+        }
+    }
+
+    atomic_store_explicit(waiting, false, memory_order_relaxed);
+    pthread_mutex_unlock(&fifo->mutex);
+    return result;
+}
+
+static bool queue_ready(struct fifo *fifo)
+{
+    return !ring_empty(&fifo->queue);
+}
+
+static bool queue_drained(struct fifo *fifo)
+{
+    return ring_empty(&fifo->queue);
+}
+
+static bool freelist_ready(struct fifo *fifo)
+{
+    return !ring_empty(&fifo->freelist);
 }
 
-static void free_buffer_list(struct mag_buf *head)
+// Get an anonymous shared memory file descriptor of the given size
+static int sample_ring_fd(size_t bytes)
 {
-    while (head) {
-        struct mag_buf *next = head->next;
-        free(head->data);
-        free(head);
-        head = next;
+    int fd = -1;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+    fd = syscall(SYS_memfd_create, "dump1090-fifo", 0);
+#endif
+
+    if (fd < 0) {
+        // fall back to a POSIX shared memory object, unlinked immediately
+        static atomic_uint shm_sequence;
+        char name[64];
+        snprintf(name, sizeof(name), "/dump1090-fifo-%ld-%u", (long) getpid(), atomic_fetch_add(&shm_sequence, 1));
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (fd < 0)
+            return -1;
+        shm_unlink(name);
     }
+
+    if (ftruncate(fd, bytes) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
 }
 
-void fifo_destroy()
+// Map "bytes" bytes of shared memory twice, back to back. Returns NULL on failure.
+static void *sample_ring_map_mirrored(size_t bytes)
 {
-    free_buffer_list(fifo_head);
-    fifo_head = fifo_tail = NULL;
+    int fd = sample_ring_fd(bytes);
+    if (fd < 0)
+        return NULL;
+
+    // Reserve address space for both copies, then map the memory into each half
+    uint8_t *base = mmap(NULL, bytes * 2, PROT_NONE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
 
-    free_buffer_list(fifo_freelist);
-    fifo_freelist = NULL;
+    if (mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, bytes * 2);
+        close(fd);
+        return NULL;
+    }
 
-    free(overlap_buffer);
-    overlap_buffer = NULL;
+    close(fd);
+    return base;
 }
 
-void fifo_drain()
+// Create the queue structures. Not threadsafe.
+struct fifo *fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
 {
-    pthread_mutex_lock(&fifo_mutex);
-    while (fifo_head && !fifo_halted) {
-        pthread_cond_wait(&fifo_empty_cond, &fifo_mutex);
+    struct fifo *fifo = calloc(1, sizeof(*fifo));
+    if (!fifo)
+        return NULL;
+
+    atomic_init(&fifo->halted, false);
+    atomic_init(&fifo->notempty_waiting, false);
+    atomic_init(&fifo->empty_waiting, false);
+    atomic_init(&fifo->free_waiting, false);
+    atomic_init(&fifo->high_water, 0);
+    atomic_init(&fifo->overruns, 0);
+
+    pthread_mutex_init(&fifo->mutex, NULL);
+    pthread_cond_init(&fifo->notempty_cond, NULL);
+    pthread_cond_init(&fifo->empty_cond, NULL);
+    pthread_cond_init(&fifo->free_cond, NULL);
+
+    fifo->overlap_length = overlap;
+    fifo->aligned_overlap = align_samples(overlap);
+
+    // Every buffer in flight can use up to buffer_size new samples of the
+    // ring (a discontinuous buffer doesn't share its overlap), plus the slack
+    // for realigning it, and the oldest one also needs the overlap before it.
+    // Without mirroring, one more buffer's worth is needed as the producer
+    // wraps early rather than run off the end of the ring.
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    fifo->sample_ring_slack = 2 * fifo->aligned_overlap + SAMPLE_ALIGN_SAMPLES;
+    size_t wanted = ((size_t) buffer_count + 1) * (buffer_size + fifo->sample_ring_slack) + fifo->aligned_overlap;
+    fifo->sample_ring_bytes = (wanted * sizeof(uint16_t) + page_size - 1) / page_size * page_size;
+    fifo->sample_ring_size = fifo->sample_ring_bytes / sizeof(uint16_t);
+
+    if ((fifo->sample_ring = sample_ring_map_mirrored(fifo->sample_ring_bytes))) {
+        fifo->sample_ring_mirrored = true;
+        sample_memory_prepare(fifo->sample_ring, fifo->sample_ring_bytes * 2);
+    } else {
+        fprintf(stderr, "fifo_create: could not create a mirrored sample ring (%s), falling back to copying at wraparound\n", strerror(errno));
+        fifo->sample_ring_mirrored = false;
+        if (!(fifo->sample_ring = sample_memory_alloc(fifo->sample_ring_bytes)))
+            goto nomem;
+    }
+
+    // Start with an overlap of zeros, as if preceded by silence
+    fifo->sample_ring_pos = fifo->aligned_overlap;
+    fifo->release_index = 0;
+
+    if (!ring_create(&fifo->queue, buffer_count) || !ring_create(&fifo->freelist, buffer_count))
+        goto nomem;
+
+    if (!(fifo->buffers = calloc(buffer_count, sizeof(fifo->buffers[0]))))
+        goto nomem;
+
+    for (fifo->buffer_count = 0; fifo->buffer_count < buffer_count; ++fifo->buffer_count) {
+        struct mag_buf *newbuf = &fifo->buffers[fifo->buffer_count];
+        newbuf->totalLength = buffer_size;
+        ring_push(&fifo->freelist, newbuf);
     }
-    pthread_mutex_unlock(&fifo_mutex);
+
+    return fifo;
+
+ nomem:
+    fifo_destroy(fifo);
+    return NULL;
 }
 
-void fifo_halt()
+void fifo_destroy(struct fifo *fifo)
 {
-    pthread_mutex_lock(&fifo_mutex);
+    if (!fifo)
+        return;
+
+    // Buffers are freed from the array of all buffers, wherever they
+    // currently are.
+    for (unsigned i = 0; i < fifo->buffer_count; ++i) {
+        free(fifo->buffers[i].messages);
+        free(fifo->buffers[i].stats);
+    }
 
-    // Drain all enqueued buffers to the freelist
-    while (fifo_head) {
-        struct mag_buf *freebuf = fifo_head;
-        fifo_head = freebuf->next;
+    free(fifo->buffers);
 
-        freebuf->next = fifo_freelist;
-        fifo_freelist = freebuf;
+    ring_destroy(&fifo->queue);
+    ring_destroy(&fifo->freelist);
+
+    if (fifo->sample_ring) {
+        if (fifo->sample_ring_mirrored)
+            munmap(fifo->sample_ring, fifo->sample_ring_bytes * 2);
+        else
+            sample_memory_free(fifo->sample_ring, fifo->sample_ring_bytes);
     }
 
-    fifo_tail = NULL;
-    fifo_halted = true;
+    pthread_cond_destroy(&fifo->free_cond);
+    pthread_cond_destroy(&fifo->empty_cond);
+    pthread_cond_destroy(&fifo->notempty_cond);
+    pthread_mutex_destroy(&fifo->mutex);
+    free(fifo);
+}
 
-    // wake all waiters
-    pthread_cond_broadcast(&fifo_notempty_cond);
-    pthread_cond_broadcast(&fifo_empty_cond);
-    pthread_cond_broadcast(&fifo_free_cond);
-    pthread_mutex_unlock(&fifo_mutex);
+void fifo_drain(struct fifo *fifo)
+{
+    if (!queue_drained(fifo) && !atomic_load(&fifo->halted))
+        fifo_wait(fifo, &fifo->empty_waiting, &fifo->empty_cond, queue_drained, NULL, "fifo_drain");
 }
 
-struct mag_buf *fifo_acquire(uint32_t timeout_ms)
+void fifo_halt(struct fifo *fifo)
 {
-    struct timespec deadline;
-    if (timeout_ms)
-        get_deadline(timeout_ms, &deadline);
+    atomic_store(&fifo->halted, true);
 
-    pthread_mutex_lock(&fifo_mutex);
+    // wake all waiters
+    pthread_mutex_lock(&fifo->mutex);
+    pthread_cond_broadcast(&fifo->notempty_cond);
+    pthread_cond_broadcast(&fifo->empty_cond);
+    pthread_cond_broadcast(&fifo->free_cond);
+    pthread_mutex_unlock(&fifo->mutex);
+}
 
-    struct mag_buf *result = NULL;
-    while (!fifo_halted && !fifo_freelist) {
-        if (!timeout_ms) {
-            // Non-blocking
-            goto done;
-        }
+struct mag_buf *fifo_acquire(struct fifo *fifo, uint32_t timeout_ms)
+{
+    if (atomic_load(&fifo->halted))
+        return NULL;
 
+    struct mag_buf *result = ring_pop(&fifo->freelist);
+    if (!result && timeout_ms) {
         // No free buffers, wait for one
-        int err = pthread_cond_timedwait(&fifo_free_cond, &fifo_mutex, &deadline);
-        if (err) {
-            if (err != ETIMEDOUT) {
-                fprintf(stderr, "fifo_acquire: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
-            }
+        struct timespec deadline;
+        get_deadline(timeout_ms, &deadline);
+        if (fifo_wait(fifo, &fifo->free_waiting, &fifo->free_cond, freelist_ready, &deadline, "fifo_acquire") && !atomic_load(&fifo->halted))
+            result = ring_pop(&fifo->freelist);
+    }
 
-            goto done; // done waiting
-        }
+    if (!result && !timeout_ms && !atomic_load(&fifo->halted)) {
+        // The caller can't wait, so it is going to drop a block
+        atomic_fetch_add_explicit(&fifo->overruns, 1, memory_order_relaxed);
     }
 
-    if (!fifo_halted) {
-        result = fifo_freelist;
-        fifo_freelist = result->next;
+    if (result) {
+        // The new buffer starts with the last "overlap" samples of the
+        // previous one. Without mirroring, if the buffer (plus the room that
+        // realigning or a discontinuity needs) could run off the end of the
+        // ring, continue from the start of the ring. Otherwise, if the
+        // previous buffer ended on an unaligned sample, skip ahead to the
+        // next aligned sample that leaves room for the overlap before it.
+        // Either way, the overlap is copied to its new position.
+        uint16_t *ring = fifo->sample_ring;
+        unsigned overlap = fifo->overlap_length;
+        size_t pos = fifo->sample_ring_pos;
+        if (!fifo->sample_ring_mirrored && pos + result->totalLength + fifo->sample_ring_slack > fifo->sample_ring_size)
+            pos = fifo->aligned_overlap;
+        else if (pos % SAMPLE_ALIGN_SAMPLES)
+            pos = align_samples(pos + overlap);
+
+        if (pos != fifo->sample_ring_pos) {
+            memcpy(&ring[pos - overlap], &ring[fifo->sample_ring_pos - overlap], overlap * sizeof(ring[0]));
+            fifo->sample_ring_pos = pos;
+        }
 
-        result->overlap = overlap_length;
+        result->data = &ring[fifo->sample_ring_pos - overlap];
+        result->overlap = overlap;
         result->validLength = result->overlap;
         result->sampleTimestamp = 0;
         result->sysTimestamp = 0;
+        result->deliveryTimestamp = monotonic_ns();
         result->flags = 0;
         result->mean_level = 0;
         result->mean_power = 0;
         result->dropped = 0;
-        result->next = NULL;
+        result->message_count = 0;
     }
 
- done:
-    pthread_mutex_unlock(&fifo_mutex);
     return result;
 }
 
-void fifo_enqueue(struct mag_buf *buf)
+void fifo_enqueue(struct fifo *fifo, struct mag_buf *buf)
 {
-    assert(buf->validLength <= buf->totalLength);
-    assert(buf->validLength >= overlap_length);
+    unsigned overlap = fifo->overlap_length;
 
-    pthread_mutex_lock(&fifo_mutex);
+    assert(buf->validLength <= buf->totalLength);
+    assert(buf->validLength >= overlap);
 
-    if (fifo_halted) {
-        // Shutting down, just return the buffer to the freelist.
-        buf->next = fifo_freelist;
-        fifo_freelist = buf;
-        goto done;
+    if (atomic_load(&fifo->halted)) {
+        // Shutting down, just drop the buffer; fifo_destroy will free it.
+        return;
     }
 
-    // Populate the overlap region
+    // The overlap region already holds the tail of the previous buffer
     if (buf->flags & MAGBUF_DISCONTINUOUS) {
-        // This buffer is discontinuous to the previous, so the overlap region is not valid; zero it out
-        memset(buf->data, 0, overlap_length * sizeof(buf->data[0]));
-    } else {
-        memcpy(buf->data, overlap_buffer, overlap_length * sizeof(buf->data[0]));
+        // This buffer is discontinuous to the previous, so the overlap region
+        // is not valid. It can't be zeroed in place, as the previous buffer
+        // may still be in use, so move the new data along to make room for a
+        // zeroed overlap, keeping it aligned. This is rare (only after
+        // dropping samples).
+        uint16_t *data = buf->data + fifo->aligned_overlap;
+        memmove(&data[overlap], &buf->data[overlap], (buf->validLength - overlap) * sizeof(data[0]));
+        memset(data, 0, overlap * sizeof(data[0]));
+        buf->data = data;
     }
 
-    // Save the tail of the buffer for next time
-    memcpy(overlap_buffer, &buf->data[buf->validLength - overlap_length], overlap_length * sizeof(overlap_buffer[0]));
-
-    // enqueue and tell the main thread
-    buf->next = NULL;
-    if (!fifo_head) {
-        fifo_head = fifo_tail = buf;
-        pthread_cond_signal(&fifo_notempty_cond);
-    } else {
-        fifo_tail->next = buf;
-        fifo_tail = buf;
-    }
-
- done:
-    pthread_mutex_unlock(&fifo_mutex);
+    // The next buffer starts from the tail of this one. With mirroring, keep
+    // the start of the next buffer's data within the first copy of the ring.
+    fifo->sample_ring_pos = (size_t) (buf->data - fifo->sample_ring) + buf->validLength;
+    if (fifo->sample_ring_mirrored && fifo->sample_ring_pos >= fifo->sample_ring_size + overlap)
+        fifo->sample_ring_pos -= fifo->sample_ring_size;
+
+    // enqueue and tell the consumer
+    ring_push(&fifo->queue, buf);
+    fifo_wake(fifo, &fifo->notempty_waiting, &fifo->notempty_cond);
+
+    // Track the deepest the queue gets. fifo_take_stats may reset the
+    // high-water mark concurrently, so update it with a compare-exchange.
+    unsigned depth = atomic_load_explicit(&fifo->queue.tail, memory_order_relaxed) - atomic_load_explicit(&fifo->queue.head, memory_order_relaxed);
+    unsigned high_water = atomic_load_explicit(&fifo->high_water, memory_order_relaxed);
+    while (depth > high_water && !atomic_compare_exchange_weak_explicit(&fifo->high_water, &high_water, depth, memory_order_relaxed, memory_order_relaxed))
+        ;
 }
 
-struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
+struct mag_buf *fifo_dequeue(struct fifo *fifo, uint32_t timeout_ms)
 {
-    struct timespec deadline;
-    if (timeout_ms)
-        get_deadline(timeout_ms, &deadline);
-
-    pthread_mutex_lock(&fifo_mutex);
-
-    struct mag_buf *result = NULL;
-    while (!fifo_head && !fifo_halted) {
-        if (!timeout_ms) {
-            // Non-blocking
-            goto done;
-        }
+    if (atomic_load(&fifo->halted))
+        return NULL;
 
+    struct mag_buf *result = ring_pop(&fifo->queue);
+    if (!result && timeout_ms) {
         // No data pending, wait for some
-        int err = pthread_cond_timedwait(&fifo_notempty_cond, &fifo_mutex, &deadline);
-        if (err) {
-            if (err != ETIMEDOUT) {
-                fprintf(stderr, "fifo_dequeue: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
-            }
-
-            goto done; // done waiting
-        }
+        struct timespec deadline;
+        get_deadline(timeout_ms, &deadline);
+        if (fifo_wait(fifo, &fifo->notempty_waiting, &fifo->notempty_cond, queue_ready, &deadline, "fifo_dequeue") && !atomic_load(&fifo->halted))
+            result = ring_pop(&fifo->queue);
     }
 
-    if (!fifo_halted) {
-        result = fifo_head;
-        fifo_head = result->next;
-        result->next = NULL;
-        if (!fifo_head) {
-            fifo_tail = NULL;
-            pthread_cond_broadcast(&fifo_empty_cond);
-        }
-    }
+    if (result && queue_drained(fifo))
+        fifo_wake(fifo, &fifo->empty_waiting, &fifo->empty_cond);
 
- done:
-    pthread_mutex_unlock(&fifo_mutex);
     return result;
 }
 
-void fifo_release(struct mag_buf *buf)
+void fifo_release(struct fifo *fifo, struct mag_buf *buf)
+{
+    // The sample ring sizing relies on buffers being released in order
+    assert(buf == &fifo->buffers[fifo->release_index]);
+    if (++fifo->release_index == fifo->buffer_count)
+        fifo->release_index = 0;
+
+    ring_push(&fifo->freelist, buf);
+    fifo_wake(fifo, &fifo->free_waiting, &fifo->free_cond);
+}
+
+void fifo_take_stats(struct fifo *fifo, struct fifo_stats *stats)
 {
-    pthread_mutex_lock(&fifo_mutex);
-    if (!fifo_freelist)
-        pthread_cond_signal(&fifo_free_cond);
-    buf->next = fifo_freelist;
-    fifo_freelist = buf;
-    pthread_mutex_unlock(&fifo_mutex);
+    stats->high_water = atomic_exchange_explicit(&fifo->high_water, 0, memory_order_relaxed);
+    stats->overruns = atomic_exchange_explicit(&fifo->overruns, 0, memory_order_relaxed);
 }
@@ -49,10 +49,13 @@ typedef enum {
 // The demodulator looks for signals starting at offsets 0 .. validLength-overlap-1,
 // with the trailing overlap region allowing decoding of a maximally-sized message that starts
 // at validLength-overlap-1. Signals that start after this point are not decoded, but they will
-// be copied into the starting overlap of the next buffer and decoded on the next iteration.
+// be in the starting overlap of the next buffer and decoded on the next iteration.
+//
+// All buffers' data lives in one shared ring of samples, and a buffer's starting overlap is
+// the same memory as the previous buffer's trailing overlap, so nothing is copied between them.
 
 struct mag_buf {
-    uint16_t       *data;            // Magnitude data, starting with overlap from the previous block
+    uint16_t       *data;            // Magnitude data, starting with overlap from the previous block (points into the FIFO's sample ring)
     unsigned        totalLength;     // Maximum number of samples (allocated size of "data")
     unsigned        validLength;     // Number of valid samples in "data", including overlap samples
     unsigned        overlap;         // Number of leading overlap samples at the start of "data";
@@ -60,40 +63,57 @@ struct mag_buf {
 
     uint64_t        sampleTimestamp; // Clock timestamp of the start of this block, 12MHz clock
     uint64_t        sysTimestamp;    // Estimated system time at start of block
+    uint64_t        deliveryTimestamp; // Monotonic time (ns, see monotonic_ns) when the SDR delivered this block;
+                                     // set by fifo_acquire, producers that hold on to a buffer before delivering it may update it
 
     mag_buf_flags   flags;           // bitwise flags for this buffer
     double          mean_level;      // Mean of normalized (0..1) signal level
     double          mean_power;      // Mean of normalized (0..1) power level
     unsigned        dropped;         // (approx) number of dropped samples, if flag MAGBUF_DISCONTINUOUS is set; zero if not discontinuous
 
-    struct mag_buf *next;            // linked list forward link
+    // Results of demodulation on a worker thread, see demodulate2400Deferred()
+    struct demod_message *messages;  // Messages found in this buffer, in sample order
+    unsigned        message_count;   // Number of valid entries in "messages"
+    unsigned        message_size;    // Allocated size of "messages"
+    struct stats   *stats;           // Demodulator stats for this buffer
 };
 
-// Create the queue structures. Not threadsafe. Returns true on success.
+// A FIFO carries sample buffers from one SDR to its demodulator. Each FIFO
+// supports exactly one producer thread (calling fifo_acquire, fifo_enqueue
+// and fifo_drain) and one consumer (calling fifo_dequeue and fifo_release;
+// these may be on two different threads, but each only ever on one);
+// fifo_halt may be called from any thread. Buffers are passed
+// between the two without locking, and the threads only synchronize when one
+// of them has to wait.
+
+struct fifo;
+
+// Create a FIFO. Not threadsafe. Returns NULL on failure.
 //
-//   buffer_count - the number of buffers to preallocate
+//   buffer_count - the number of buffers to preallocate; the sample ring holds this many full buffers
 //   buffer_size  - the size of each magnitude buffer, in samples, including overlap
 //   overlap      - the number of samples to overlap between adjacent buffers
-bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap);
+struct fifo *fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap);
 
-// Destroy the fifo structures allocated in magbuf_fifo_create. Not threadsafe; ensure all FIFO users
-// are done before calling.
-void fifo_destroy();
+// Destroy a FIFO created by fifo_create, including all buffers. Does nothing
+// if fifo is NULL. Not threadsafe; ensure all FIFO users are done before calling.
+void fifo_destroy(struct fifo *fifo);
 
-// Block until the FIFO is empty.
-void fifo_drain();
+// Block until the FIFO is empty (or halted).
+void fifo_drain(struct fifo *fifo);
 
-// Mark the FIFO as halted. Move any buffers in FIFO to the freelist immediately.
-// Future calls to magbuf_acquire() will immediately return NULL.
-// Future calls to magbuf_produce() will immediately put the produced buffer on the freelist.
-// Future alls to magbuf_consume() will immediately return NULL; if there are
+// Mark the FIFO as halted. Any buffers in the FIFO are abandoned; they are
+// freed by fifo_destroy.
+// Future calls to fifo_acquire() will immediately return NULL.
+// Future calls to fifo_enqueue() will immediately abandon the produced buffer.
+// Future calls to fifo_dequeue() will immediately return NULL; if there are
 //   existing calls waiting on data, they will be immediately awoken and return NULL.
-void fifo_halt();
+void fifo_halt(struct fifo *fifo);
 
 // Get an unused buffer from the freelist and return it.
 // Block up to timeout_ms waiting for a free buffer. Return NULL if there are no
 // free buffers available within the timeout, or if the FIFO is halted.
-struct mag_buf *fifo_acquire(uint32_t timeout_ms);
+struct mag_buf *fifo_acquire(struct fifo *fifo, uint32_t timeout_ms);
 
 // Put a filled buffer (previously obtained from fifo_acquire) onto the head of the FIFO.
 // The caller should have filled:
@@ -105,15 +125,26 @@ struct mag_buf *fifo_acquire(uint32_t timeout_ms);
 //   buf->mean_level (if flags & HAS_METRICS)
 //   buf->mean_power (if flags & HAS_METRICS)
 //   buf->dropped    (if flags & DISCONTINUOUS)
-void fifo_enqueue(struct mag_buf *buf);
+void fifo_enqueue(struct fifo *fifo, struct mag_buf *buf);
 
 // Get a buffer from the tail of the FIFO.
 // If the FIFO is halted (or becomes halted), return NULL immediately.
 // If the FIFO is empty, wait for up to "timeout_ms" milliseconds
 //   for more data; return NULL if no data arrives within the timeout.
-struct mag_buf *fifo_dequeue(uint32_t timeout_ms);
+struct mag_buf *fifo_dequeue(struct fifo *fifo, uint32_t timeout_ms);
+
+// Release a buffer previously returned by fifo_dequeue() back to the freelist.
+// Buffers must be released in the order they were dequeued.
+void fifo_release(struct fifo *fifo, struct mag_buf *buf);
+
+// FIFO telemetry, collected by fifo_take_stats()
+struct fifo_stats {
+    unsigned high_water;    // most buffers queued at once
+    unsigned overruns;      // fifo_acquire(0) calls that found no free buffer, i.e. blocks the SDR had to drop
+};
 
-// Release a buffer previously returned by fifo_acquire() or fifo_pop() back to the freelist.
-void fifo_release(struct mag_buf *buf);
+// Copy out the FIFO telemetry accumulated since the last call, and reset it.
+// Safe to call from any thread.
+void fifo_take_stats(struct fifo *fifo, struct fifo_stats *stats);
 
 #endif
@@ -0,0 +1,296 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// fifotests.c - stress tests for the SDR to demodulator FIFO
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "fifo.h"
+#include "sample_memory.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#define TEST_BUFFERS 8
+#define TEST_OVERLAP 64
+#define TEST_SAMPLES 4096
+
+// Latency histogram buckets: bucket N counts latencies of [2^(N-1), 2^N) us,
+// bucket 0 is under 1us
+#define LATENCY_BUCKETS 16
+
+static unsigned test_count;
+static struct fifo *test_fifo;
+static volatile int test_failed;
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Simple per-thread PRNG (xorshift32), used to vary buffer sizes and delays
+static uint32_t test_random(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Sometimes stall for a little while, so that each side sometimes has to
+// wait for the other. Which side stalls more changes over the run.
+static void test_stall(uint32_t *state, unsigned seq, int producer)
+{
+    unsigned phase = (seq * 4 / test_count);    // 0..3
+    unsigned odds = ((phase == 1) == producer) ? 4 : (phase == 3 ? 64 : 1024);
+    if (test_random(state) % odds == 0) {
+        struct timespec ts = { 0, test_random(state) % 50000 };
+        nanosleep(&ts, NULL);
+    }
+}
+
+static uint16_t test_sample(unsigned seq, unsigned i)
+{
+    return (uint16_t) (seq * 31 + i * 7);
+}
+
+static void *producer_thread(void *arg)
+{
+    uint32_t state = 12345;
+    (void) arg;
+
+    for (unsigned seq = 0; seq < test_count; ++seq) {
+        struct mag_buf *buf;
+        while (!(buf = fifo_acquire(test_fifo, 100))) {
+            if (test_failed)
+                return NULL;
+        }
+
+        if (buf->overlap != TEST_OVERLAP || buf->validLength != TEST_OVERLAP) {
+            fprintf(stderr, "testFifoStress: FAIL: acquired buffer has overlap %u validLength %u\n", buf->overlap, buf->validLength);
+            test_failed = 1;
+        }
+
+        if ((uintptr_t) &buf->data[buf->overlap] % SAMPLE_ALIGNMENT) {
+            fprintf(stderr, "testFifoStress: FAIL: buffer %u new data at %p is not aligned\n", seq, (void *) &buf->data[buf->overlap]);
+            test_failed = 1;
+        }
+
+        buf->validLength = TEST_OVERLAP + 1 + test_random(&state) % (buf->totalLength - TEST_OVERLAP);
+        for (unsigned i = buf->overlap; i < buf->validLength; ++i)
+            buf->data[i] = test_sample(seq, i);
+        buf->sampleTimestamp = seq;
+        buf->flags = (seq % 97 == 0) ? MAGBUF_DISCONTINUOUS : 0;
+
+        test_stall(&state, seq, 1);
+
+        buf->sysTimestamp = now_ns(); // not ms, but the FIFO doesn't care
+        fifo_enqueue(test_fifo, buf);
+    }
+
+    fifo_drain(test_fifo);
+
+    // give the consumer time to start waiting again, then wake it with a halt
+    struct timespec ts = { 0, 10000000 };
+    nanosleep(&ts, NULL);
+    fifo_halt(test_fifo);
+    return NULL;
+}
+
+static int testFifoStress()
+{
+    pthread_t producer;
+    uint64_t histogram[LATENCY_BUCKETS] = { 0 };
+    uint16_t previous_tail[TEST_OVERLAP] = { 0 };
+    uint64_t max_latency = 0;
+    uint32_t state = 67890;
+    unsigned seq = 0;
+    uint64_t start = now_ns();
+
+    if (!(test_fifo = fifo_create(TEST_BUFFERS, TEST_SAMPLES + TEST_OVERLAP, TEST_OVERLAP))) {
+        fprintf(stderr, "testFifoStress: FAIL: fifo_create failed\n");
+        return 0;
+    }
+
+    // an empty FIFO times out
+    uint64_t wait_start = now_ns();
+    if (fifo_dequeue(test_fifo, 20) != NULL || now_ns() - wait_start < 15000000) {
+        fprintf(stderr, "testFifoStress: FAIL: fifo_dequeue on an empty FIFO did not time out\n");
+        test_failed = 1;
+    }
+
+    pthread_create(&producer, NULL, producer_thread, NULL);
+
+    while (seq < test_count && !test_failed) {
+        struct mag_buf *buf = fifo_dequeue(test_fifo, 1000);
+        if (!buf) {
+            fprintf(stderr, "testFifoStress: FAIL: fifo_dequeue timed out waiting for buffer %u\n", seq);
+            test_failed = 1;
+            break;
+        }
+
+        uint64_t latency = now_ns() - buf->sysTimestamp;
+        unsigned bucket = 0;
+        while (bucket < LATENCY_BUCKETS - 1 && latency >= (1000ULL << bucket))
+            ++bucket;
+        ++histogram[bucket];
+        if (latency > max_latency)
+            max_latency = latency;
+
+        if ((uintptr_t) &buf->data[buf->overlap] % SAMPLE_ALIGNMENT) {
+            fprintf(stderr, "testFifoStress: FAIL: dequeued buffer %u has unaligned new data\n", seq);
+            test_failed = 1;
+        }
+
+        if (buf->sampleTimestamp != seq) {
+            fprintf(stderr, "testFifoStress: FAIL: got buffer %u, expected %u\n", (unsigned) buf->sampleTimestamp, seq);
+            test_failed = 1;
+        }
+
+        // the overlap is either the tail of the previous buffer, or zeros
+        for (unsigned i = 0; i < TEST_OVERLAP; ++i) {
+            uint16_t expected = (buf->flags & MAGBUF_DISCONTINUOUS) ? 0 : previous_tail[i];
+            if (buf->data[i] != expected) {
+                fprintf(stderr, "testFifoStress: FAIL: buffer %u overlap sample %u is %u, expected %u\n", seq, i, buf->data[i], expected);
+                test_failed = 1;
+                break;
+            }
+        }
+
+        for (unsigned i = TEST_OVERLAP; i < buf->validLength; ++i) {
+            if (buf->data[i] != test_sample(seq, i)) {
+                fprintf(stderr, "testFifoStress: FAIL: buffer %u sample %u is %u, expected %u\n", seq, i, buf->data[i], test_sample(seq, i));
+                test_failed = 1;
+                break;
+            }
+        }
+
+        memcpy(previous_tail, &buf->data[buf->validLength - TEST_OVERLAP], sizeof(previous_tail));
+        test_stall(&state, seq, 0);
+        fifo_release(test_fifo, buf);
+        ++seq;
+    }
+
+    // the producer drains then halts the FIFO, which should wake us promptly
+    if (!test_failed) {
+        wait_start = now_ns();
+        if (fifo_dequeue(test_fifo, 5000) != NULL || now_ns() - wait_start > 1000000000) {
+            fprintf(stderr, "testFifoStress: FAIL: fifo_halt did not wake a waiting fifo_dequeue\n");
+            test_failed = 1;
+        }
+        if (fifo_acquire(test_fifo, 0) != NULL || fifo_dequeue(test_fifo, 0) != NULL) {
+            fprintf(stderr, "testFifoStress: FAIL: FIFO still usable after fifo_halt\n");
+            test_failed = 1;
+        }
+    } else {
+        fifo_halt(test_fifo);
+    }
+
+    pthread_join(producer, NULL);
+    fifo_destroy(test_fifo);
+
+    double elapsed = (now_ns() - start) / 1e9;
+    fprintf(stderr, "enqueue to dequeue latency:\n");
+    for (unsigned bucket = 0; bucket < LATENCY_BUCKETS; ++bucket) {
+        if (!histogram[bucket])
+            continue;
+        if (bucket == 0)
+            fprintf(stderr, "  %7s - %7uus: %8llu\n", "", 1U, (unsigned long long) histogram[bucket]);
+        else if (bucket == LATENCY_BUCKETS - 1)
+            fprintf(stderr, "  %7uus - %7s: %8llu\n", 1U << (bucket - 1), "", (unsigned long long) histogram[bucket]);
+        else
+            fprintf(stderr, "  %7uus - %7uus: %8llu\n", 1U << (bucket - 1), 1U << bucket, (unsigned long long) histogram[bucket]);
+    }
+    fprintf(stderr, "  max %.1fus\n", max_latency / 1000.0);
+
+    if (test_failed)
+        return 0;
+
+    fprintf(stderr, "testFifoStress: PASS (%u buffers in %.2fs)\n", seq, elapsed);
+    return 1;
+}
+
+// Non-blocking acquires that find no free buffer count as overruns, and the
+// deepest the queue gets is reported as the high-water mark
+static int testFifoStats()
+{
+    struct fifo_stats stats;
+    int ok = 1;
+
+    if (!(test_fifo = fifo_create(3, TEST_SAMPLES + TEST_OVERLAP, TEST_OVERLAP))) {
+        fprintf(stderr, "testFifoStats: FAIL: fifo_create failed\n");
+        return 0;
+    }
+
+    for (unsigned i = 0; i < 3; ++i) {
+        struct mag_buf *buf = fifo_acquire(test_fifo, 0);
+        if (!buf) {
+            fprintf(stderr, "testFifoStats: FAIL: fifo_acquire failed for buffer %u\n", i);
+            fifo_destroy(test_fifo);
+            return 0;
+        }
+        buf->validLength = TEST_OVERLAP + 100;
+        fifo_enqueue(test_fifo, buf);
+    }
+
+    if (fifo_acquire(test_fifo, 0) != NULL || fifo_acquire(test_fifo, 0) != NULL) {
+        fprintf(stderr, "testFifoStats: FAIL: fifo_acquire succeeded on a full FIFO\n");
+        ok = 0;
+    }
+
+    // a timed-out blocking acquire is not an overrun
+    fifo_acquire(test_fifo, 1);
+
+    fifo_take_stats(test_fifo, &stats);
+    if (stats.high_water != 3 || stats.overruns != 2) {
+        fprintf(stderr, "testFifoStats: FAIL: got high water %u, overruns %u (expected 3, 2)\n", stats.high_water, stats.overruns);
+        ok = 0;
+    }
+
+    struct mag_buf *buf;
+    while ((buf = fifo_dequeue(test_fifo, 0)))
+        fifo_release(test_fifo, buf);
+
+    // taking the stats resets them
+    fifo_take_stats(test_fifo, &stats);
+    if (stats.high_water != 0 || stats.overruns != 0) {
+        fprintf(stderr, "testFifoStats: FAIL: got high water %u, overruns %u after reset (expected 0, 0)\n", stats.high_water, stats.overruns);
+        ok = 0;
+    }
+
+    fifo_destroy(test_fifo);
+
+    if (ok)
+        fprintf(stderr, "testFifoStats: PASS\n");
+    return ok;
+}
+
+// Usage: fifotests [buffer count]
+int main(int argc, char **argv)
+{
+    test_count = (argc > 1) ? (unsigned) atoi(argv[1]) : 100000;
+    if (test_count < 4)
+        test_count = 4;
+
+    int ok = 1;
+    ok = testFifoStress() && ok;
+    ok = testFifoStats() && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,366 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// forwardtests.c - check that --forward-only and --track-max forward the
+//                  same messages to the raw output as a full decode does
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// A stream of messages is fed to ./dump1090 --net-only on its raw input
+// port, and whatever comes out of its raw output port is collected: with a
+// full decode, with --forward-only, and with room to track only one
+// aircraft (so most messages have no aircraft record). All must forward exactly
+// the messages from aircraft that were established by clean DF17s (with
+// single-bit errors corrected), and drop the error-corrected DF17 / DF18
+// messages from addresses that have never been confirmed.
+
+#define TEST_KNOWN 16
+#define TEST_MESSAGES 600
+
+static uint32_t rng_state = 2463534242U;
+
+static uint32_t test_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Mode S CRC of the first bytes-3 bytes of msg
+static uint32_t test_crc(const uint8_t *msg, unsigned bytes)
+{
+    uint32_t rem = 0;
+    for (unsigned i = 0; i < (bytes - 3) * 8; ++i) {
+        unsigned bit = (msg[i / 8] >> (7 - i % 8)) & 1;
+        unsigned top = ((rem >> 23) & 1) ^ bit;
+        rem = (rem << 1) & 0xFFFFFF;
+        if (top)
+            rem ^= 0xFFF409;
+    }
+    return rem;
+}
+
+// Build a message of the given DF from addr; "iid" is xored into the DF11
+// parity. Returns the length in bytes.
+static unsigned make_message(uint8_t *msg, unsigned df, uint32_t addr, unsigned iid)
+{
+    unsigned bytes = (df >= 16) ? 14 : 7;
+    for (unsigned i = 0; i < bytes; ++i)
+        msg[i] = test_random();
+    msg[0] = (df << 3) | 5;
+
+    uint32_t parity;
+    if (df == 11 || df == 17 || df == 18) {
+        msg[1] = addr >> 16;
+        msg[2] = addr >> 8;
+        msg[3] = addr;
+        if (df == 18)
+            msg[0] = (df << 3);                  // CF=0, ICAO address
+        if (df != 11)
+            msg[4] = (11 << 3) | (msg[4] & 7);   // airborne position
+        parity = test_crc(msg, bytes) ^ iid;
+    } else {
+        parity = test_crc(msg, bytes) ^ addr;   // address/parity
+    }
+
+    msg[bytes - 3] = parity >> 16;
+    msg[bytes - 2] = parity >> 8;
+    msg[bytes - 1] = parity;
+    return bytes;
+}
+
+struct buffer {
+    char *data;
+    size_t size;
+    size_t capacity;
+};
+
+static void append(struct buffer *b, const char *data, size_t len)
+{
+    if (b->size + len + 1 > b->capacity) {
+        size_t capacity = b->capacity ? b->capacity : 4096;
+        while (b->size + len + 1 > capacity)
+            capacity *= 2;
+        b->data = realloc(b->data, capacity);
+        if (!b->data) {
+            fprintf(stderr, "forwardtests: out of memory\n");
+            exit(1);
+        }
+        b->capacity = capacity;
+    }
+    memcpy(b->data + b->size, data, len);
+    b->size += len;
+    b->data[b->size] = 0;
+}
+
+static void append_message(struct buffer *b, const uint8_t *msg, unsigned bytes)
+{
+    char line[40];
+    char *p = line;
+    *p++ = '*';
+    for (unsigned i = 0; i < bytes; ++i)
+        p += sprintf(p, "%02X", msg[i]);
+    *p++ = ';';
+    *p++ = '\n';
+    append(b, line, p - line);
+}
+
+// Build the input stream and the raw output it should produce
+static void make_stream(struct buffer *input, struct buffer *expected)
+{
+    static const unsigned ap_df[] = { 0, 4, 5, 16, 20, 21 };
+    uint32_t known[TEST_KNOWN];
+    uint8_t msg[14];
+    unsigned bytes;
+
+    for (unsigned i = 0; i < TEST_KNOWN; ++i) {
+        known[i] = 0x400000 + (test_random() & 0x0FFFFF);
+        // two clean DF17s make the aircraft reliable to the tracker
+        for (unsigned n = 0; n < 2; ++n) {
+            bytes = make_message(msg, 17, known[i], 0);
+            append_message(input, msg, bytes);
+            append_message(expected, msg, bytes);
+        }
+    }
+
+    for (unsigned i = 0; i < TEST_MESSAGES; ++i) {
+        unsigned r = test_random() % 10;
+        if (r < 3) {
+            // error-corrected DF17 / DF18 from an address seen nowhere else:
+            // unreliable, so neither output may forward it
+            uint32_t addr = 0x800000 + i;
+            bytes = make_message(msg, (r == 0) ? 18 : 17, addr, 0);
+            unsigned bit = 8 + test_random() % (bytes * 8 - 8);
+            msg[bit / 8] ^= 0x80 >> (bit % 8);
+            append_message(input, msg, bytes);
+            continue;
+        }
+
+        uint32_t addr = known[test_random() % TEST_KNOWN];
+        int flip = 0;
+        switch (r) {
+        case 3:
+            bytes = make_message(msg, 17, addr, 0);
+            break;
+        case 4:
+            bytes = make_message(msg, 17, addr, 0);
+            flip = 1;
+            break;
+        case 5:
+            bytes = make_message(msg, 11, addr, 0);
+            break;
+        case 6:
+            bytes = make_message(msg, 11, addr, 1 + test_random() % 15);
+            break;
+        default:
+            bytes = make_message(msg, ap_df[test_random() % 6], addr, 0);
+            break;
+        }
+
+        // the raw output carries the corrected message
+        append_message(expected, msg, bytes);
+        if (flip) {
+            unsigned bit = 8 + test_random() % (bytes * 8 - 8);
+            msg[bit / 8] ^= 0x80 >> (bit % 8);
+        }
+        append_message(input, msg, bytes);
+    }
+}
+
+static unsigned free_port(void)
+{
+    struct sockaddr_in sa;
+    socklen_t len = sizeof(sa);
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return 0;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    unsigned port = 0;
+    if (bind(fd, (struct sockaddr *) &sa, sizeof(sa)) == 0 && getsockname(fd, (struct sockaddr *) &sa, &len) == 0)
+        port = ntohs(sa.sin_port);
+    close(fd);
+    return port;
+}
+
+static void sleep_ms(unsigned ms)
+{
+    struct timespec ts = { ms / 1000, (ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+static int connect_port(unsigned port)
+{
+    struct sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = htons(port);
+
+    // dump1090 may still be starting up
+    for (unsigned tries = 0; tries < 100; ++tries) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+        if (connect(fd, (struct sockaddr *) &sa, sizeof(sa)) == 0)
+            return fd;
+        close(fd);
+        sleep_ms(50);
+    }
+    return -1;
+}
+
+// Feed "input" to a dump1090 started with up to two extra arguments (or
+// NULL) and collect its raw output into *output. Returns 0 on failure.
+static int run_dump1090(const char *const *extra, const struct buffer *input, struct buffer *output)
+{
+    unsigned in_port = free_port(), out_port = free_port();
+    char in_arg[16], out_arg[16];
+    snprintf(in_arg, sizeof(in_arg), "%u", in_port);
+    snprintf(out_arg, sizeof(out_arg), "%u", out_port);
+    if (!in_port || !out_port || in_port == out_port)
+        return 0;
+
+    pid_t pid = fork();
+    if (pid < 0)
+        return 0;
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        dup2(null, 2);
+        execl("./dump1090", "./dump1090", "--net-only", "--quiet", "--fix",
+              "--net-bind-address", "127.0.0.1",
+              "--net-ri-port", in_arg, "--net-ro-port", out_arg,
+              "--net-sbs-port", "0", "--net-bi-port", "0", "--net-bo-port", "0",
+              extra[0], extra[1], (char *) NULL);
+        _exit(127);
+    }
+
+    int ok = 0;
+    int out_fd = connect_port(out_port);
+    int in_fd = -1;
+    if (out_fd >= 0) {
+        // let dump1090 accept the output connection before any input arrives
+        sleep_ms(300);
+        in_fd = connect_port(in_port);
+    }
+
+    if (in_fd >= 0) {
+        size_t sent = 0;
+        while (sent < input->size) {
+            ssize_t n = write(in_fd, input->data + sent, input->size - sent);
+            if (n <= 0)
+                break;
+            sent += n;
+        }
+
+        // raw output is flushed at least every 500ms; stop once it has been
+        // quiet for a while
+        ok = (sent == input->size);
+        struct pollfd pfd = { out_fd, POLLIN, 0 };
+        char buf[4096];
+        while (ok && poll(&pfd, 1, 1500) > 0) {
+            ssize_t n = read(out_fd, buf, sizeof(buf));
+            if (n <= 0)
+                break;
+            append(output, buf, n);
+        }
+    }
+
+    if (in_fd >= 0)
+        close(in_fd);
+    if (out_fd >= 0)
+        close(out_fd);
+    kill(pid, SIGTERM);
+    waitpid(pid, NULL, 0);
+    return ok;
+}
+
+static unsigned count_lines(const char *s)
+{
+    unsigned lines = 0;
+    for (; s && *s; ++s)
+        if (*s == '\n')
+            ++lines;
+    return lines;
+}
+
+static int testForwardOnly(void)
+{
+    static const char *modes[][2] = {
+        { NULL, NULL },
+        { "--forward-only", NULL },
+        { "--track-max", "1" }
+    };
+    struct buffer input = { 0 }, expected = { 0 };
+    int ok = 1;
+
+    if (access("./dump1090", X_OK) != 0) {
+        fprintf(stderr, "testForwardOnly: FAIL: ./dump1090 not found\n");
+        return 0;
+    }
+
+    make_stream(&input, &expected);
+
+    for (unsigned m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m) {
+        struct buffer output = { 0 };
+        const char *name = modes[m][0] ? modes[m][0] : "full decode";
+        if (!run_dump1090(modes[m], &input, &output)) {
+            fprintf(stderr, "testForwardOnly: FAIL: %s: could not run ./dump1090\n", name);
+            ok = 0;
+        } else if (!output.data || strcmp(output.data, expected.data)) {
+            fprintf(stderr, "testForwardOnly: FAIL: %s: forwarded %u messages, expected %u\n",
+                    name, count_lines(output.data), count_lines(expected.data));
+            ok = 0;
+        } else {
+            fprintf(stderr, "testForwardOnly: %s: forwarded %u of %u messages\n",
+                    name, count_lines(output.data), count_lines(input.data));
+        }
+        free(output.data);
+    }
+
+    free(input.data);
+    free(expected.data);
+    if (ok)
+        fprintf(stderr, "testForwardOnly: PASS\n");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    (void) argc;
+    (void) argv;
+
+    signal(SIGPIPE, SIG_IGN);
+    return testForwardOnly() ? 0 : 1;
+}
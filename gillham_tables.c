@@ -0,0 +1,1048 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// gillham_tables.c: Gillham / identity decoding lookup tables
+//
+// Generated by tools/gillham-tables.py - do not edit.
+
+#include "dump1090.h"
+
+// ID13 field without the X bit (see gillhamIndex) -> hex-encoded squawk
+const uint16_t gillham_squawk[4096] = {
+    0x0000, 0x0004, 0x0400, 0x0404, 0x0002, 0x0006, 0x0402, 0x0406, 0x0200, 0x0204, 0x0600, 0x0604, 0x0202, 0x0206, 0x0602, 0x0606,
+    0x0001, 0x0005, 0x0401, 0x0405, 0x0003, 0x0007, 0x0403, 0x0407, 0x0201, 0x0205, 0x0601, 0x0605, 0x0203, 0x0207, 0x0603, 0x0607,
+    0x0100, 0x0104, 0x0500, 0x0504, 0x0102, 0x0106, 0x0502, 0x0506, 0x0300, 0x0304, 0x0700, 0x0704, 0x0302, 0x0306, 0x0702, 0x0706,
+    0x0101, 0x0105, 0x0501, 0x0505, 0x0103, 0x0107, 0x0503, 0x0507, 0x0301, 0x0305, 0x0701, 0x0705, 0x0303, 0x0307, 0x0703, 0x0707,
+    0x4000, 0x4004, 0x4400, 0x4404, 0x4002, 0x4006, 0x4402, 0x4406, 0x4200, 0x4204, 0x4600, 0x4604, 0x4202, 0x4206, 0x4602, 0x4606,
+    0x4001, 0x4005, 0x4401, 0x4405, 0x4003, 0x4007, 0x4403, 0x4407, 0x4201, 0x4205, 0x4601, 0x4605, 0x4203, 0x4207, 0x4603, 0x4607,
+    0x4100, 0x4104, 0x4500, 0x4504, 0x4102, 0x4106, 0x4502, 0x4506, 0x4300, 0x4304, 0x4700, 0x4704, 0x4302, 0x4306, 0x4702, 0x4706,
+    0x4101, 0x4105, 0x4501, 0x4505, 0x4103, 0x4107, 0x4503, 0x4507, 0x4301, 0x4305, 0x4701, 0x4705, 0x4303, 0x4307, 0x4703, 0x4707,
+    0x0040, 0x0044, 0x0440, 0x0444, 0x0042, 0x0046, 0x0442, 0x0446, 0x0240, 0x0244, 0x0640, 0x0644, 0x0242, 0x0246, 0x0642, 0x0646,
+    0x0041, 0x0045, 0x0441, 0x0445, 0x0043, 0x0047, 0x0443, 0x0447, 0x0241, 0x0245, 0x0641, 0x0645, 0x0243, 0x0247, 0x0643, 0x0647,
+    0x0140, 0x0144, 0x0540, 0x0544, 0x0142, 0x0146, 0x0542, 0x0546, 0x0340, 0x0344, 0x0740, 0x0744, 0x0342, 0x0346, 0x0742, 0x0746,
+    0x0141, 0x0145, 0x0541, 0x0545, 0x0143, 0x0147, 0x0543, 0x0547, 0x0341, 0x0345, 0x0741, 0x0745, 0x0343, 0x0347, 0x0743, 0x0747,
+    0x4040, 0x4044, 0x4440, 0x4444, 0x4042, 0x4046, 0x4442, 0x4446, 0x4240, 0x4244, 0x4640, 0x4644, 0x4242, 0x4246, 0x4642, 0x4646,
+    0x4041, 0x4045, 0x4441, 0x4445, 0x4043, 0x4047, 0x4443, 0x4447, 0x4241, 0x4245, 0x4641, 0x4645, 0x4243, 0x4247, 0x4643, 0x4647,
+    0x4140, 0x4144, 0x4540, 0x4544, 0x4142, 0x4146, 0x4542, 0x4546, 0x4340, 0x4344, 0x4740, 0x4744, 0x4342, 0x4346, 0x4742, 0x4746,
+    0x4141, 0x4145, 0x4541, 0x4545, 0x4143, 0x4147, 0x4543, 0x4547, 0x4341, 0x4345, 0x4741, 0x4745, 0x4343, 0x4347, 0x4743, 0x4747,
+    0x2000, 0x2004, 0x2400, 0x2404, 0x2002, 0x2006, 0x2402, 0x2406, 0x2200, 0x2204, 0x2600, 0x2604, 0x2202, 0x2206, 0x2602, 0x2606,
+    0x2001, 0x2005, 0x2401, 0x2405, 0x2003, 0x2007, 0x2403, 0x2407, 0x2201, 0x2205, 0x2601, 0x2605, 0x2203, 0x2207, 0x2603, 0x2607,
+    0x2100, 0x2104, 0x2500, 0x2504, 0x2102, 0x2106, 0x2502, 0x2506, 0x2300, 0x2304, 0x2700, 0x2704, 0x2302, 0x2306, 0x2702, 0x2706,
+    0x2101, 0x2105, 0x2501, 0x2505, 0x2103, 0x2107, 0x2503, 0x2507, 0x2301, 0x2305, 0x2701, 0x2705, 0x2303, 0x2307, 0x2703, 0x2707,
+    0x6000, 0x6004, 0x6400, 0x6404, 0x6002, 0x6006, 0x6402, 0x6406, 0x6200, 0x6204, 0x6600, 0x6604, 0x6202, 0x6206, 0x6602, 0x6606,
+    0x6001, 0x6005, 0x6401, 0x6405, 0x6003, 0x6007, 0x6403, 0x6407, 0x6201, 0x6205, 0x6601, 0x6605, 0x6203, 0x6207, 0x6603, 0x6607,
+    0x6100, 0x6104, 0x6500, 0x6504, 0x6102, 0x6106, 0x6502, 0x6506, 0x6300, 0x6304, 0x6700, 0x6704, 0x6302, 0x6306, 0x6702, 0x6706,
+    0x6101, 0x6105, 0x6501, 0x6505, 0x6103, 0x6107, 0x6503, 0x6507, 0x6301, 0x6305, 0x6701, 0x6705, 0x6303, 0x6307, 0x6703, 0x6707,
+    0x2040, 0x2044, 0x2440, 0x2444, 0x2042, 0x2046, 0x2442, 0x2446, 0x2240, 0x2244, 0x2640, 0x2644, 0x2242, 0x2246, 0x2642, 0x2646,
+    0x2041, 0x2045, 0x2441, 0x2445, 0x2043, 0x2047, 0x2443, 0x2447, 0x2241, 0x2245, 0x2641, 0x2645, 0x2243, 0x2247, 0x2643, 0x2647,
+    0x2140, 0x2144, 0x2540, 0x2544, 0x2142, 0x2146, 0x2542, 0x2546, 0x2340, 0x2344, 0x2740, 0x2744, 0x2342, 0x2346, 0x2742, 0x2746,
+    0x2141, 0x2145, 0x2541, 0x2545, 0x2143, 0x2147, 0x2543, 0x2547, 0x2341, 0x2345, 0x2741, 0x2745, 0x2343, 0x2347, 0x2743, 0x2747,
+    0x6040, 0x6044, 0x6440, 0x6444, 0x6042, 0x6046, 0x6442, 0x6446, 0x6240, 0x6244, 0x6640, 0x6644, 0x6242, 0x6246, 0x6642, 0x6646,
+    0x6041, 0x6045, 0x6441, 0x6445, 0x6043, 0x6047, 0x6443, 0x6447, 0x6241, 0x6245, 0x6641, 0x6645, 0x6243, 0x6247, 0x6643, 0x6647,
+    0x6140, 0x6144, 0x6540, 0x6544, 0x6142, 0x6146, 0x6542, 0x6546, 0x6340, 0x6344, 0x6740, 0x6744, 0x6342, 0x6346, 0x6742, 0x6746,
+    0x6141, 0x6145, 0x6541, 0x6545, 0x6143, 0x6147, 0x6543, 0x6547, 0x6341, 0x6345, 0x6741, 0x6745, 0x6343, 0x6347, 0x6743, 0x6747,
+    0x0020, 0x0024, 0x0420, 0x0424, 0x0022, 0x0026, 0x0422, 0x0426, 0x0220, 0x0224, 0x0620, 0x0624, 0x0222, 0x0226, 0x0622, 0x0626,
+    0x0021, 0x0025, 0x0421, 0x0425, 0x0023, 0x0027, 0x0423, 0x0427, 0x0221, 0x0225, 0x0621, 0x0625, 0x0223, 0x0227, 0x0623, 0x0627,
+    0x0120, 0x0124, 0x0520, 0x0524, 0x0122, 0x0126, 0x0522, 0x0526, 0x0320, 0x0324, 0x0720, 0x0724, 0x0322, 0x0326, 0x0722, 0x0726,
+    0x0121, 0x0125, 0x0521, 0x0525, 0x0123, 0x0127, 0x0523, 0x0527, 0x0321, 0x0325, 0x0721, 0x0725, 0x0323, 0x0327, 0x0723, 0x0727,
+    0x4020, 0x4024, 0x4420, 0x4424, 0x4022, 0x4026, 0x4422, 0x4426, 0x4220, 0x4224, 0x4620, 0x4624, 0x4222, 0x4226, 0x4622, 0x4626,
+    0x4021, 0x4025, 0x4421, 0x4425, 0x4023, 0x4027, 0x4423, 0x4427, 0x4221, 0x4225, 0x4621, 0x4625, 0x4223, 0x4227, 0x4623, 0x4627,
+    0x4120, 0x4124, 0x4520, 0x4524, 0x4122, 0x4126, 0x4522, 0x4526, 0x4320, 0x4324, 0x4720, 0x4724, 0x4322, 0x4326, 0x4722, 0x4726,
+    0x4121, 0x4125, 0x4521, 0x4525, 0x4123, 0x4127, 0x4523, 0x4527, 0x4321, 0x4325, 0x4721, 0x4725, 0x4323, 0x4327, 0x4723, 0x4727,
+    0x0060, 0x0064, 0x0460, 0x0464, 0x0062, 0x0066, 0x0462, 0x0466, 0x0260, 0x0264, 0x0660, 0x0664, 0x0262, 0x0266, 0x0662, 0x0666,
+    0x0061, 0x0065, 0x0461, 0x0465, 0x0063, 0x0067, 0x0463, 0x0467, 0x0261, 0x0265, 0x0661, 0x0665, 0x0263, 0x0267, 0x0663, 0x0667,
+    0x0160, 0x0164, 0x0560, 0x0564, 0x0162, 0x0166, 0x0562, 0x0566, 0x0360, 0x0364, 0x0760, 0x0764, 0x0362, 0x0366, 0x0762, 0x0766,
+    0x0161, 0x0165, 0x0561, 0x0565, 0x0163, 0x0167, 0x0563, 0x0567, 0x0361, 0x0365, 0x0761, 0x0765, 0x0363, 0x0367, 0x0763, 0x0767,
+    0x4060, 0x4064, 0x4460, 0x4464, 0x4062, 0x4066, 0x4462, 0x4466, 0x4260, 0x4264, 0x4660, 0x4664, 0x4262, 0x4266, 0x4662, 0x4666,
+    0x4061, 0x4065, 0x4461, 0x4465, 0x4063, 0x4067, 0x4463, 0x4467, 0x4261, 0x4265, 0x4661, 0x4665, 0x4263, 0x4267, 0x4663, 0x4667,
+    0x4160, 0x4164, 0x4560, 0x4564, 0x4162, 0x4166, 0x4562, 0x4566, 0x4360, 0x4364, 0x4760, 0x4764, 0x4362, 0x4366, 0x4762, 0x4766,
+    0x4161, 0x4165, 0x4561, 0x4565, 0x4163, 0x4167, 0x4563, 0x4567, 0x4361, 0x4365, 0x4761, 0x4765, 0x4363, 0x4367, 0x4763, 0x4767,
+    0x2020, 0x2024, 0x2420, 0x2424, 0x2022, 0x2026, 0x2422, 0x2426, 0x2220, 0x2224, 0x2620, 0x2624, 0x2222, 0x2226, 0x2622, 0x2626,
+    0x2021, 0x2025, 0x2421, 0x2425, 0x2023, 0x2027, 0x2423, 0x2427, 0x2221, 0x2225, 0x2621, 0x2625, 0x2223, 0x2227, 0x2623, 0x2627,
+    0x2120, 0x2124, 0x2520, 0x2524, 0x2122, 0x2126, 0x2522, 0x2526, 0x2320, 0x2324, 0x2720, 0x2724, 0x2322, 0x2326, 0x2722, 0x2726,
+    0x2121, 0x2125, 0x2521, 0x2525, 0x2123, 0x2127, 0x2523, 0x2527, 0x2321, 0x2325, 0x2721, 0x2725, 0x2323, 0x2327, 0x2723, 0x2727,
+    0x6020, 0x6024, 0x6420, 0x6424, 0x6022, 0x6026, 0x6422, 0x6426, 0x6220, 0x6224, 0x6620, 0x6624, 0x6222, 0x6226, 0x6622, 0x6626,
+    0x6021, 0x6025, 0x6421, 0x6425, 0x6023, 0x6027, 0x6423, 0x6427, 0x6221, 0x6225, 0x6621, 0x6625, 0x6223, 0x6227, 0x6623, 0x6627,
+    0x6120, 0x6124, 0x6520, 0x6524, 0x6122, 0x6126, 0x6522, 0x6526, 0x6320, 0x6324, 0x6720, 0x6724, 0x6322, 0x6326, 0x6722, 0x6726,
+    0x6121, 0x6125, 0x6521, 0x6525, 0x6123, 0x6127, 0x6523, 0x6527, 0x6321, 0x6325, 0x6721, 0x6725, 0x6323, 0x6327, 0x6723, 0x6727,
+    0x2060, 0x2064, 0x2460, 0x2464, 0x2062, 0x2066, 0x2462, 0x2466, 0x2260, 0x2264, 0x2660, 0x2664, 0x2262, 0x2266, 0x2662, 0x2666,
+    0x2061, 0x2065, 0x2461, 0x2465, 0x2063, 0x2067, 0x2463, 0x2467, 0x2261, 0x2265, 0x2661, 0x2665, 0x2263, 0x2267, 0x2663, 0x2667,
+    0x2160, 0x2164, 0x2560, 0x2564, 0x2162, 0x2166, 0x2562, 0x2566, 0x2360, 0x2364, 0x2760, 0x2764, 0x2362, 0x2366, 0x2762, 0x2766,
+    0x2161, 0x2165, 0x2561, 0x2565, 0x2163, 0x2167, 0x2563, 0x2567, 0x2361, 0x2365, 0x2761, 0x2765, 0x2363, 0x2367, 0x2763, 0x2767,
+    0x6060, 0x6064, 0x6460, 0x6464, 0x6062, 0x6066, 0x6462, 0x6466, 0x6260, 0x6264, 0x6660, 0x6664, 0x6262, 0x6266, 0x6662, 0x6666,
+    0x6061, 0x6065, 0x6461, 0x6465, 0x6063, 0x6067, 0x6463, 0x6467, 0x6261, 0x6265, 0x6661, 0x6665, 0x6263, 0x6267, 0x6663, 0x6667,
+    0x6160, 0x6164, 0x6560, 0x6564, 0x6162, 0x6166, 0x6562, 0x6566, 0x6360, 0x6364, 0x6760, 0x6764, 0x6362, 0x6366, 0x6762, 0x6766,
+    0x6161, 0x6165, 0x6561, 0x6565, 0x6163, 0x6167, 0x6563, 0x6567, 0x6361, 0x6365, 0x6761, 0x6765, 0x6363, 0x6367, 0x6763, 0x6767,
+    0x1000, 0x1004, 0x1400, 0x1404, 0x1002, 0x1006, 0x1402, 0x1406, 0x1200, 0x1204, 0x1600, 0x1604, 0x1202, 0x1206, 0x1602, 0x1606,
+    0x1001, 0x1005, 0x1401, 0x1405, 0x1003, 0x1007, 0x1403, 0x1407, 0x1201, 0x1205, 0x1601, 0x1605, 0x1203, 0x1207, 0x1603, 0x1607,
+    0x1100, 0x1104, 0x1500, 0x1504, 0x1102, 0x1106, 0x1502, 0x1506, 0x1300, 0x1304, 0x1700, 0x1704, 0x1302, 0x1306, 0x1702, 0x1706,
+    0x1101, 0x1105, 0x1501, 0x1505, 0x1103, 0x1107, 0x1503, 0x1507, 0x1301, 0x1305, 0x1701, 0x1705, 0x1303, 0x1307, 0x1703, 0x1707,
+    0x5000, 0x5004, 0x5400, 0x5404, 0x5002, 0x5006, 0x5402, 0x5406, 0x5200, 0x5204, 0x5600, 0x5604, 0x5202, 0x5206, 0x5602, 0x5606,
+    0x5001, 0x5005, 0x5401, 0x5405, 0x5003, 0x5007, 0x5403, 0x5407, 0x5201, 0x5205, 0x5601, 0x5605, 0x5203, 0x5207, 0x5603, 0x5607,
+    0x5100, 0x5104, 0x5500, 0x5504, 0x5102, 0x5106, 0x5502, 0x5506, 0x5300, 0x5304, 0x5700, 0x5704, 0x5302, 0x5306, 0x5702, 0x5706,
+    0x5101, 0x5105, 0x5501, 0x5505, 0x5103, 0x5107, 0x5503, 0x5507, 0x5301, 0x5305, 0x5701, 0x5705, 0x5303, 0x5307, 0x5703, 0x5707,
+    0x1040, 0x1044, 0x1440, 0x1444, 0x1042, 0x1046, 0x1442, 0x1446, 0x1240, 0x1244, 0x1640, 0x1644, 0x1242, 0x1246, 0x1642, 0x1646,
+    0x1041, 0x1045, 0x1441, 0x1445, 0x1043, 0x1047, 0x1443, 0x1447, 0x1241, 0x1245, 0x1641, 0x1645, 0x1243, 0x1247, 0x1643, 0x1647,
+    0x1140, 0x1144, 0x1540, 0x1544, 0x1142, 0x1146, 0x1542, 0x1546, 0x1340, 0x1344, 0x1740, 0x1744, 0x1342, 0x1346, 0x1742, 0x1746,
+    0x1141, 0x1145, 0x1541, 0x1545, 0x1143, 0x1147, 0x1543, 0x1547, 0x1341, 0x1345, 0x1741, 0x1745, 0x1343, 0x1347, 0x1743, 0x1747,
+    0x5040, 0x5044, 0x5440, 0x5444, 0x5042, 0x5046, 0x5442, 0x5446, 0x5240, 0x5244, 0x5640, 0x5644, 0x5242, 0x5246, 0x5642, 0x5646,
+    0x5041, 0x5045, 0x5441, 0x5445, 0x5043, 0x5047, 0x5443, 0x5447, 0x5241, 0x5245, 0x5641, 0x5645, 0x5243, 0x5247, 0x5643, 0x5647,
+    0x5140, 0x5144, 0x5540, 0x5544, 0x5142, 0x5146, 0x5542, 0x5546, 0x5340, 0x5344, 0x5740, 0x5744, 0x5342, 0x5346, 0x5742, 0x5746,
+    0x5141, 0x5145, 0x5541, 0x5545, 0x5143, 0x5147, 0x5543, 0x5547, 0x5341, 0x5345, 0x5741, 0x5745, 0x5343, 0x5347, 0x5743, 0x5747,
+    0x3000, 0x3004, 0x3400, 0x3404, 0x3002, 0x3006, 0x3402, 0x3406, 0x3200, 0x3204, 0x3600, 0x3604, 0x3202, 0x3206, 0x3602, 0x3606,
+    0x3001, 0x3005, 0x3401, 0x3405, 0x3003, 0x3007, 0x3403, 0x3407, 0x3201, 0x3205, 0x3601, 0x3605, 0x3203, 0x3207, 0x3603, 0x3607,
+    0x3100, 0x3104, 0x3500, 0x3504, 0x3102, 0x3106, 0x3502, 0x3506, 0x3300, 0x3304, 0x3700, 0x3704, 0x3302, 0x3306, 0x3702, 0x3706,
+    0x3101, 0x3105, 0x3501, 0x3505, 0x3103, 0x3107, 0x3503, 0x3507, 0x3301, 0x3305, 0x3701, 0x3705, 0x3303, 0x3307, 0x3703, 0x3707,
+    0x7000, 0x7004, 0x7400, 0x7404, 0x7002, 0x7006, 0x7402, 0x7406, 0x7200, 0x7204, 0x7600, 0x7604, 0x7202, 0x7206, 0x7602, 0x7606,
+    0x7001, 0x7005, 0x7401, 0x7405, 0x7003, 0x7007, 0x7403, 0x7407, 0x7201, 0x7205, 0x7601, 0x7605, 0x7203, 0x7207, 0x7603, 0x7607,
+    0x7100, 0x7104, 0x7500, 0x7504, 0x7102, 0x7106, 0x7502, 0x7506, 0x7300, 0x7304, 0x7700, 0x7704, 0x7302, 0x7306, 0x7702, 0x7706,
+    0x7101, 0x7105, 0x7501, 0x7505, 0x7103, 0x7107, 0x7503, 0x7507, 0x7301, 0x7305, 0x7701, 0x7705, 0x7303, 0x7307, 0x7703, 0x7707,
+    0x3040, 0x3044, 0x3440, 0x3444, 0x3042, 0x3046, 0x3442, 0x3446, 0x3240, 0x3244, 0x3640, 0x3644, 0x3242, 0x3246, 0x3642, 0x3646,
+    0x3041, 0x3045, 0x3441, 0x3445, 0x3043, 0x3047, 0x3443, 0x3447, 0x3241, 0x3245, 0x3641, 0x3645, 0x3243, 0x3247, 0x3643, 0x3647,
+    0x3140, 0x3144, 0x3540, 0x3544, 0x3142, 0x3146, 0x3542, 0x3546, 0x3340, 0x3344, 0x3740, 0x3744, 0x3342, 0x3346, 0x3742, 0x3746,
+    0x3141, 0x3145, 0x3541, 0x3545, 0x3143, 0x3147, 0x3543, 0x3547, 0x3341, 0x3345, 0x3741, 0x3745, 0x3343, 0x3347, 0x3743, 0x3747,
+    0x7040, 0x7044, 0x7440, 0x7444, 0x7042, 0x7046, 0x7442, 0x7446, 0x7240, 0x7244, 0x7640, 0x7644, 0x7242, 0x7246, 0x7642, 0x7646,
+    0x7041, 0x7045, 0x7441, 0x7445, 0x7043, 0x7047, 0x7443, 0x7447, 0x7241, 0x7245, 0x7641, 0x7645, 0x7243, 0x7247, 0x7643, 0x7647,
+    0x7140, 0x7144, 0x7540, 0x7544, 0x7142, 0x7146, 0x7542, 0x7546, 0x7340, 0x7344, 0x7740, 0x7744, 0x7342, 0x7346, 0x7742, 0x7746,
+    0x7141, 0x7145, 0x7541, 0x7545, 0x7143, 0x7147, 0x7543, 0x7547, 0x7341, 0x7345, 0x7741, 0x7745, 0x7343, 0x7347, 0x7743, 0x7747,
+    0x1020, 0x1024, 0x1420, 0x1424, 0x1022, 0x1026, 0x1422, 0x1426, 0x1220, 0x1224, 0x1620, 0x1624, 0x1222, 0x1226, 0x1622, 0x1626,
+    0x1021, 0x1025, 0x1421, 0x1425, 0x1023, 0x1027, 0x1423, 0x1427, 0x1221, 0x1225, 0x1621, 0x1625, 0x1223, 0x1227, 0x1623, 0x1627,
+    0x1120, 0x1124, 0x1520, 0x1524, 0x1122, 0x1126, 0x1522, 0x1526, 0x1320, 0x1324, 0x1720, 0x1724, 0x1322, 0x1326, 0x1722, 0x1726,
+    0x1121, 0x1125, 0x1521, 0x1525, 0x1123, 0x1127, 0x1523, 0x1527, 0x1321, 0x1325, 0x1721, 0x1725, 0x1323, 0x1327, 0x1723, 0x1727,
+    0x5020, 0x5024, 0x5420, 0x5424, 0x5022, 0x5026, 0x5422, 0x5426, 0x5220, 0x5224, 0x5620, 0x5624, 0x5222, 0x5226, 0x5622, 0x5626,
+    0x5021, 0x5025, 0x5421, 0x5425, 0x5023, 0x5027, 0x5423, 0x5427, 0x5221, 0x5225, 0x5621, 0x5625, 0x5223, 0x5227, 0x5623, 0x5627,
+    0x5120, 0x5124, 0x5520, 0x5524, 0x5122, 0x5126, 0x5522, 0x5526, 0x5320, 0x5324, 0x5720, 0x5724, 0x5322, 0x5326, 0x5722, 0x5726,
+    0x5121, 0x5125, 0x5521, 0x5525, 0x5123, 0x5127, 0x5523, 0x5527, 0x5321, 0x5325, 0x5721, 0x5725, 0x5323, 0x5327, 0x5723, 0x5727,
+    0x1060, 0x1064, 0x1460, 0x1464, 0x1062, 0x1066, 0x1462, 0x1466, 0x1260, 0x1264, 0x1660, 0x1664, 0x1262, 0x1266, 0x1662, 0x1666,
+    0x1061, 0x1065, 0x1461, 0x1465, 0x1063, 0x1067, 0x1463, 0x1467, 0x1261, 0x1265, 0x1661, 0x1665, 0x1263, 0x1267, 0x1663, 0x1667,
+    0x1160, 0x1164, 0x1560, 0x1564, 0x1162, 0x1166, 0x1562, 0x1566, 0x1360, 0x1364, 0x1760, 0x1764, 0x1362, 0x1366, 0x1762, 0x1766,
+    0x1161, 0x1165, 0x1561, 0x1565, 0x1163, 0x1167, 0x1563, 0x1567, 0x1361, 0x1365, 0x1761, 0x1765, 0x1363, 0x1367, 0x1763, 0x1767,
+    0x5060, 0x5064, 0x5460, 0x5464, 0x5062, 0x5066, 0x5462, 0x5466, 0x5260, 0x5264, 0x5660, 0x5664, 0x5262, 0x5266, 0x5662, 0x5666,
+    0x5061, 0x5065, 0x5461, 0x5465, 0x5063, 0x5067, 0x5463, 0x5467, 0x5261, 0x5265, 0x5661, 0x5665, 0x5263, 0x5267, 0x5663, 0x5667,
+    0x5160, 0x5164, 0x5560, 0x5564, 0x5162, 0x5166, 0x5562, 0x5566, 0x5360, 0x5364, 0x5760, 0x5764, 0x5362, 0x5366, 0x5762, 0x5766,
+    0x5161, 0x5165, 0x5561, 0x5565, 0x5163, 0x5167, 0x5563, 0x5567, 0x5361, 0x5365, 0x5761, 0x5765, 0x5363, 0x5367, 0x5763, 0x5767,
+    0x3020, 0x3024, 0x3420, 0x3424, 0x3022, 0x3026, 0x3422, 0x3426, 0x3220, 0x3224, 0x3620, 0x3624, 0x3222, 0x3226, 0x3622, 0x3626,
+    0x3021, 0x3025, 0x3421, 0x3425, 0x3023, 0x3027, 0x3423, 0x3427, 0x3221, 0x3225, 0x3621, 0x3625, 0x3223, 0x3227, 0x3623, 0x3627,
+    0x3120, 0x3124, 0x3520, 0x3524, 0x3122, 0x3126, 0x3522, 0x3526, 0x3320, 0x3324, 0x3720, 0x3724, 0x3322, 0x3326, 0x3722, 0x3726,
+    0x3121, 0x3125, 0x3521, 0x3525, 0x3123, 0x3127, 0x3523, 0x3527, 0x3321, 0x3325, 0x3721, 0x3725, 0x3323, 0x3327, 0x3723, 0x3727,
+    0x7020, 0x7024, 0x7420, 0x7424, 0x7022, 0x7026, 0x7422, 0x7426, 0x7220, 0x7224, 0x7620, 0x7624, 0x7222, 0x7226, 0x7622, 0x7626,
+    0x7021, 0x7025, 0x7421, 0x7425, 0x7023, 0x7027, 0x7423, 0x7427, 0x7221, 0x7225, 0x7621, 0x7625, 0x7223, 0x7227, 0x7623, 0x7627,
+    0x7120, 0x7124, 0x7520, 0x7524, 0x7122, 0x7126, 0x7522, 0x7526, 0x7320, 0x7324, 0x7720, 0x7724, 0x7322, 0x7326, 0x7722, 0x7726,
+    0x7121, 0x7125, 0x7521, 0x7525, 0x7123, 0x7127, 0x7523, 0x7527, 0x7321, 0x7325, 0x7721, 0x7725, 0x7323, 0x7327, 0x7723, 0x7727,
+    0x3060, 0x3064, 0x3460, 0x3464, 0x3062, 0x3066, 0x3462, 0x3466, 0x3260, 0x3264, 0x3660, 0x3664, 0x3262, 0x3266, 0x3662, 0x3666,
+    0x3061, 0x3065, 0x3461, 0x3465, 0x3063, 0x3067, 0x3463, 0x3467, 0x3261, 0x3265, 0x3661, 0x3665, 0x3263, 0x3267, 0x3663, 0x3667,
+    0x3160, 0x3164, 0x3560, 0x3564, 0x3162, 0x3166, 0x3562, 0x3566, 0x3360, 0x3364, 0x3760, 0x3764, 0x3362, 0x3366, 0x3762, 0x3766,
+    0x3161, 0x3165, 0x3561, 0x3565, 0x3163, 0x3167, 0x3563, 0x3567, 0x3361, 0x3365, 0x3761, 0x3765, 0x3363, 0x3367, 0x3763, 0x3767,
+    0x7060, 0x7064, 0x7460, 0x7464, 0x7062, 0x7066, 0x7462, 0x7466, 0x7260, 0x7264, 0x7660, 0x7664, 0x7262, 0x7266, 0x7662, 0x7666,
+    0x7061, 0x7065, 0x7461, 0x7465, 0x7063, 0x7067, 0x7463, 0x7467, 0x7261, 0x7265, 0x7661, 0x7665, 0x7263, 0x7267, 0x7663, 0x7667,
+    0x7160, 0x7164, 0x7560, 0x7564, 0x7162, 0x7166, 0x7562, 0x7566, 0x7360, 0x7364, 0x7760, 0x7764, 0x7362, 0x7366, 0x7762, 0x7766,
+    0x7161, 0x7165, 0x7561, 0x7565, 0x7163, 0x7167, 0x7563, 0x7567, 0x7361, 0x7365, 0x7761, 0x7765, 0x7363, 0x7367, 0x7763, 0x7767,
+    0x0010, 0x0014, 0x0410, 0x0414, 0x0012, 0x0016, 0x0412, 0x0416, 0x0210, 0x0214, 0x0610, 0x0614, 0x0212, 0x0216, 0x0612, 0x0616,
+    0x0011, 0x0015, 0x0411, 0x0415, 0x0013, 0x0017, 0x0413, 0x0417, 0x0211, 0x0215, 0x0611, 0x0615, 0x0213, 0x0217, 0x0613, 0x0617,
+    0x0110, 0x0114, 0x0510, 0x0514, 0x0112, 0x0116, 0x0512, 0x0516, 0x0310, 0x0314, 0x0710, 0x0714, 0x0312, 0x0316, 0x0712, 0x0716,
+    0x0111, 0x0115, 0x0511, 0x0515, 0x0113, 0x0117, 0x0513, 0x0517, 0x0311, 0x0315, 0x0711, 0x0715, 0x0313, 0x0317, 0x0713, 0x0717,
+    0x4010, 0x4014, 0x4410, 0x4414, 0x4012, 0x4016, 0x4412, 0x4416, 0x4210, 0x4214, 0x4610, 0x4614, 0x4212, 0x4216, 0x4612, 0x4616,
+    0x4011, 0x4015, 0x4411, 0x4415, 0x4013, 0x4017, 0x4413, 0x4417, 0x4211, 0x4215, 0x4611, 0x4615, 0x4213, 0x4217, 0x4613, 0x4617,
+    0x4110, 0x4114, 0x4510, 0x4514, 0x4112, 0x4116, 0x4512, 0x4516, 0x4310, 0x4314, 0x4710, 0x4714, 0x4312, 0x4316, 0x4712, 0x4716,
+    0x4111, 0x4115, 0x4511, 0x4515, 0x4113, 0x4117, 0x4513, 0x4517, 0x4311, 0x4315, 0x4711, 0x4715, 0x4313, 0x4317, 0x4713, 0x4717,
+    0x0050, 0x0054, 0x0450, 0x0454, 0x0052, 0x0056, 0x0452, 0x0456, 0x0250, 0x0254, 0x0650, 0x0654, 0x0252, 0x0256, 0x0652, 0x0656,
+    0x0051, 0x0055, 0x0451, 0x0455, 0x0053, 0x0057, 0x0453, 0x0457, 0x0251, 0x0255, 0x0651, 0x0655, 0x0253, 0x0257, 0x0653, 0x0657,
+    0x0150, 0x0154, 0x0550, 0x0554, 0x0152, 0x0156, 0x0552, 0x0556, 0x0350, 0x0354, 0x0750, 0x0754, 0x0352, 0x0356, 0x0752, 0x0756,
+    0x0151, 0x0155, 0x0551, 0x0555, 0x0153, 0x0157, 0x0553, 0x0557, 0x0351, 0x0355, 0x0751, 0x0755, 0x0353, 0x0357, 0x0753, 0x0757,
+    0x4050, 0x4054, 0x4450, 0x4454, 0x4052, 0x4056, 0x4452, 0x4456, 0x4250, 0x4254, 0x4650, 0x4654, 0x4252, 0x4256, 0x4652, 0x4656,
+    0x4051, 0x4055, 0x4451, 0x4455, 0x4053, 0x4057, 0x4453, 0x4457, 0x4251, 0x4255, 0x4651, 0x4655, 0x4253, 0x4257, 0x4653, 0x4657,
+    0x4150, 0x4154, 0x4550, 0x4554, 0x4152, 0x4156, 0x4552, 0x4556, 0x4350, 0x4354, 0x4750, 0x4754, 0x4352, 0x4356, 0x4752, 0x4756,
+    0x4151, 0x4155, 0x4551, 0x4555, 0x4153, 0x4157, 0x4553, 0x4557, 0x4351, 0x4355, 0x4751, 0x4755, 0x4353, 0x4357, 0x4753, 0x4757,
+    0x2010, 0x2014, 0x2410, 0x2414, 0x2012, 0x2016, 0x2412, 0x2416, 0x2210, 0x2214, 0x2610, 0x2614, 0x2212, 0x2216, 0x2612, 0x2616,
+    0x2011, 0x2015, 0x2411, 0x2415, 0x2013, 0x2017, 0x2413, 0x2417, 0x2211, 0x2215, 0x2611, 0x2615, 0x2213, 0x2217, 0x2613, 0x2617,
+    0x2110, 0x2114, 0x2510, 0x2514, 0x2112, 0x2116, 0x2512, 0x2516, 0x2310, 0x2314, 0x2710, 0x2714, 0x2312, 0x2316, 0x2712, 0x2716,
+    0x2111, 0x2115, 0x2511, 0x2515, 0x2113, 0x2117, 0x2513, 0x2517, 0x2311, 0x2315, 0x2711, 0x2715, 0x2313, 0x2317, 0x2713, 0x2717,
+    0x6010, 0x6014, 0x6410, 0x6414, 0x6012, 0x6016, 0x6412, 0x6416, 0x6210, 0x6214, 0x6610, 0x6614, 0x6212, 0x6216, 0x6612, 0x6616,
+    0x6011, 0x6015, 0x6411, 0x6415, 0x6013, 0x6017, 0x6413, 0x6417, 0x6211, 0x6215, 0x6611, 0x6615, 0x6213, 0x6217, 0x6613, 0x6617,
+    0x6110, 0x6114, 0x6510, 0x6514, 0x6112, 0x6116, 0x6512, 0x6516, 0x6310, 0x6314, 0x6710, 0x6714, 0x6312, 0x6316, 0x6712, 0x6716,
+    0x6111, 0x6115, 0x6511, 0x6515, 0x6113, 0x6117, 0x6513, 0x6517, 0x6311, 0x6315, 0x6711, 0x6715, 0x6313, 0x6317, 0x6713, 0x6717,
+    0x2050, 0x2054, 0x2450, 0x2454, 0x2052, 0x2056, 0x2452, 0x2456, 0x2250, 0x2254, 0x2650, 0x2654, 0x2252, 0x2256, 0x2652, 0x2656,
+    0x2051, 0x2055, 0x2451, 0x2455, 0x2053, 0x2057, 0x2453, 0x2457, 0x2251, 0x2255, 0x2651, 0x2655, 0x2253, 0x2257, 0x2653, 0x2657,
+    0x2150, 0x2154, 0x2550, 0x2554, 0x2152, 0x2156, 0x2552, 0x2556, 0x2350, 0x2354, 0x2750, 0x2754, 0x2352, 0x2356, 0x2752, 0x2756,
+    0x2151, 0x2155, 0x2551, 0x2555, 0x2153, 0x2157, 0x2553, 0x2557, 0x2351, 0x2355, 0x2751, 0x2755, 0x2353, 0x2357, 0x2753, 0x2757,
+    0x6050, 0x6054, 0x6450, 0x6454, 0x6052, 0x6056, 0x6452, 0x6456, 0x6250, 0x6254, 0x6650, 0x6654, 0x6252, 0x6256, 0x6652, 0x6656,
+    0x6051, 0x6055, 0x6451, 0x6455, 0x6053, 0x6057, 0x6453, 0x6457, 0x6251, 0x6255, 0x6651, 0x6655, 0x6253, 0x6257, 0x6653, 0x6657,
+    0x6150, 0x6154, 0x6550, 0x6554, 0x6152, 0x6156, 0x6552, 0x6556, 0x6350, 0x6354, 0x6750, 0x6754, 0x6352, 0x6356, 0x6752, 0x6756,
+    0x6151, 0x6155, 0x6551, 0x6555, 0x6153, 0x6157, 0x6553, 0x6557, 0x6351, 0x6355, 0x6751, 0x6755, 0x6353, 0x6357, 0x6753, 0x6757,
+    0x0030, 0x0034, 0x0430, 0x0434, 0x0032, 0x0036, 0x0432, 0x0436, 0x0230, 0x0234, 0x0630, 0x0634, 0x0232, 0x0236, 0x0632, 0x0636,
+    0x0031, 0x0035, 0x0431, 0x0435, 0x0033, 0x0037, 0x0433, 0x0437, 0x0231, 0x0235, 0x0631, 0x0635, 0x0233, 0x0237, 0x0633, 0x0637,
+    0x0130, 0x0134, 0x0530, 0x0534, 0x0132, 0x0136, 0x0532, 0x0536, 0x0330, 0x0334, 0x0730, 0x0734, 0x0332, 0x0336, 0x0732, 0x0736,
+    0x0131, 0x0135, 0x0531, 0x0535, 0x0133, 0x0137, 0x0533, 0x0537, 0x0331, 0x0335, 0x0731, 0x0735, 0x0333, 0x0337, 0x0733, 0x0737,
+    0x4030, 0x4034, 0x4430, 0x4434, 0x4032, 0x4036, 0x4432, 0x4436, 0x4230, 0x4234, 0x4630, 0x4634, 0x4232, 0x4236, 0x4632, 0x4636,
+    0x4031, 0x4035, 0x4431, 0x4435, 0x4033, 0x4037, 0x4433, 0x4437, 0x4231, 0x4235, 0x4631, 0x4635, 0x4233, 0x4237, 0x4633, 0x4637,
+    0x4130, 0x4134, 0x4530, 0x4534, 0x4132, 0x4136, 0x4532, 0x4536, 0x4330, 0x4334, 0x4730, 0x4734, 0x4332, 0x4336, 0x4732, 0x4736,
+    0x4131, 0x4135, 0x4531, 0x4535, 0x4133, 0x4137, 0x4533, 0x4537, 0x4331, 0x4335, 0x4731, 0x4735, 0x4333, 0x4337, 0x4733, 0x4737,
+    0x0070, 0x0074, 0x0470, 0x0474, 0x0072, 0x0076, 0x0472, 0x0476, 0x0270, 0x0274, 0x0670, 0x0674, 0x0272, 0x0276, 0x0672, 0x0676,
+    0x0071, 0x0075, 0x0471, 0x0475, 0x0073, 0x0077, 0x0473, 0x0477, 0x0271, 0x0275, 0x0671, 0x0675, 0x0273, 0x0277, 0x0673, 0x0677,
+    0x0170, 0x0174, 0x0570, 0x0574, 0x0172, 0x0176, 0x0572, 0x0576, 0x0370, 0x0374, 0x0770, 0x0774, 0x0372, 0x0376, 0x0772, 0x0776,
+    0x0171, 0x0175, 0x0571, 0x0575, 0x0173, 0x0177, 0x0573, 0x0577, 0x0371, 0x0375, 0x0771, 0x0775, 0x0373, 0x0377, 0x0773, 0x0777,
+    0x4070, 0x4074, 0x4470, 0x4474, 0x4072, 0x4076, 0x4472, 0x4476, 0x4270, 0x4274, 0x4670, 0x4674, 0x4272, 0x4276, 0x4672, 0x4676,
+    0x4071, 0x4075, 0x4471, 0x4475, 0x4073, 0x4077, 0x4473, 0x4477, 0x4271, 0x4275, 0x4671, 0x4675, 0x4273, 0x4277, 0x4673, 0x4677,
+    0x4170, 0x4174, 0x4570, 0x4574, 0x4172, 0x4176, 0x4572, 0x4576, 0x4370, 0x4374, 0x4770, 0x4774, 0x4372, 0x4376, 0x4772, 0x4776,
+    0x4171, 0x4175, 0x4571, 0x4575, 0x4173, 0x4177, 0x4573, 0x4577, 0x4371, 0x4375, 0x4771, 0x4775, 0x4373, 0x4377, 0x4773, 0x4777,
+    0x2030, 0x2034, 0x2430, 0x2434, 0x2032, 0x2036, 0x2432, 0x2436, 0x2230, 0x2234, 0x2630, 0x2634, 0x2232, 0x2236, 0x2632, 0x2636,
+    0x2031, 0x2035, 0x2431, 0x2435, 0x2033, 0x2037, 0x2433, 0x2437, 0x2231, 0x2235, 0x2631, 0x2635, 0x2233, 0x2237, 0x2633, 0x2637,
+    0x2130, 0x2134, 0x2530, 0x2534, 0x2132, 0x2136, 0x2532, 0x2536, 0x2330, 0x2334, 0x2730, 0x2734, 0x2332, 0x2336, 0x2732, 0x2736,
+    0x2131, 0x2135, 0x2531, 0x2535, 0x2133, 0x2137, 0x2533, 0x2537, 0x2331, 0x2335, 0x2731, 0x2735, 0x2333, 0x2337, 0x2733, 0x2737,
+    0x6030, 0x6034, 0x6430, 0x6434, 0x6032, 0x6036, 0x6432, 0x6436, 0x6230, 0x6234, 0x6630, 0x6634, 0x6232, 0x6236, 0x6632, 0x6636,
+    0x6031, 0x6035, 0x6431, 0x6435, 0x6033, 0x6037, 0x6433, 0x6437, 0x6231, 0x6235, 0x6631, 0x6635, 0x6233, 0x6237, 0x6633, 0x6637,
+    0x6130, 0x6134, 0x6530, 0x6534, 0x6132, 0x6136, 0x6532, 0x6536, 0x6330, 0x6334, 0x6730, 0x6734, 0x6332, 0x6336, 0x6732, 0x6736,
+    0x6131, 0x6135, 0x6531, 0x6535, 0x6133, 0x6137, 0x6533, 0x6537, 0x6331, 0x6335, 0x6731, 0x6735, 0x6333, 0x6337, 0x6733, 0x6737,
+    0x2070, 0x2074, 0x2470, 0x2474, 0x2072, 0x2076, 0x2472, 0x2476, 0x2270, 0x2274, 0x2670, 0x2674, 0x2272, 0x2276, 0x2672, 0x2676,
+    0x2071, 0x2075, 0x2471, 0x2475, 0x2073, 0x2077, 0x2473, 0x2477, 0x2271, 0x2275, 0x2671, 0x2675, 0x2273, 0x2277, 0x2673, 0x2677,
+    0x2170, 0x2174, 0x2570, 0x2574, 0x2172, 0x2176, 0x2572, 0x2576, 0x2370, 0x2374, 0x2770, 0x2774, 0x2372, 0x2376, 0x2772, 0x2776,
+    0x2171, 0x2175, 0x2571, 0x2575, 0x2173, 0x2177, 0x2573, 0x2577, 0x2371, 0x2375, 0x2771, 0x2775, 0x2373, 0x2377, 0x2773, 0x2777,
+    0x6070, 0x6074, 0x6470, 0x6474, 0x6072, 0x6076, 0x6472, 0x6476, 0x6270, 0x6274, 0x6670, 0x6674, 0x6272, 0x6276, 0x6672, 0x6676,
+    0x6071, 0x6075, 0x6471, 0x6475, 0x6073, 0x6077, 0x6473, 0x6477, 0x6271, 0x6275, 0x6671, 0x6675, 0x6273, 0x6277, 0x6673, 0x6677,
+    0x6170, 0x6174, 0x6570, 0x6574, 0x6172, 0x6176, 0x6572, 0x6576, 0x6370, 0x6374, 0x6770, 0x6774, 0x6372, 0x6376, 0x6772, 0x6776,
+    0x6171, 0x6175, 0x6571, 0x6575, 0x6173, 0x6177, 0x6573, 0x6577, 0x6371, 0x6375, 0x6771, 0x6775, 0x6373, 0x6377, 0x6773, 0x6777,
+    0x1010, 0x1014, 0x1410, 0x1414, 0x1012, 0x1016, 0x1412, 0x1416, 0x1210, 0x1214, 0x1610, 0x1614, 0x1212, 0x1216, 0x1612, 0x1616,
+    0x1011, 0x1015, 0x1411, 0x1415, 0x1013, 0x1017, 0x1413, 0x1417, 0x1211, 0x1215, 0x1611, 0x1615, 0x1213, 0x1217, 0x1613, 0x1617,
+    0x1110, 0x1114, 0x1510, 0x1514, 0x1112, 0x1116, 0x1512, 0x1516, 0x1310, 0x1314, 0x1710, 0x1714, 0x1312, 0x1316, 0x1712, 0x1716,
+    0x1111, 0x1115, 0x1511, 0x1515, 0x1113, 0x1117, 0x1513, 0x1517, 0x1311, 0x1315, 0x1711, 0x1715, 0x1313, 0x1317, 0x1713, 0x1717,
+    0x5010, 0x5014, 0x5410, 0x5414, 0x5012, 0x5016, 0x5412, 0x5416, 0x5210, 0x5214, 0x5610, 0x5614, 0x5212, 0x5216, 0x5612, 0x5616,
+    0x5011, 0x5015, 0x5411, 0x5415, 0x5013, 0x5017, 0x5413, 0x5417, 0x5211, 0x5215, 0x5611, 0x5615, 0x5213, 0x5217, 0x5613, 0x5617,
+    0x5110, 0x5114, 0x5510, 0x5514, 0x5112, 0x5116, 0x5512, 0x5516, 0x5310, 0x5314, 0x5710, 0x5714, 0x5312, 0x5316, 0x5712, 0x5716,
+    0x5111, 0x5115, 0x5511, 0x5515, 0x5113, 0x5117, 0x5513, 0x5517, 0x5311, 0x5315, 0x5711, 0x5715, 0x5313, 0x5317, 0x5713, 0x5717,
+    0x1050, 0x1054, 0x1450, 0x1454, 0x1052, 0x1056, 0x1452, 0x1456, 0x1250, 0x1254, 0x1650, 0x1654, 0x1252, 0x1256, 0x1652, 0x1656,
+    0x1051, 0x1055, 0x1451, 0x1455, 0x1053, 0x1057, 0x1453, 0x1457, 0x1251, 0x1255, 0x1651, 0x1655, 0x1253, 0x1257, 0x1653, 0x1657,
+    0x1150, 0x1154, 0x1550, 0x1554, 0x1152, 0x1156, 0x1552, 0x1556, 0x1350, 0x1354, 0x1750, 0x1754, 0x1352, 0x1356, 0x1752, 0x1756,
+    0x1151, 0x1155, 0x1551, 0x1555, 0x1153, 0x1157, 0x1553, 0x1557, 0x1351, 0x1355, 0x1751, 0x1755, 0x1353, 0x1357, 0x1753, 0x1757,
+    0x5050, 0x5054, 0x5450, 0x5454, 0x5052, 0x5056, 0x5452, 0x5456, 0x5250, 0x5254, 0x5650, 0x5654, 0x5252, 0x5256, 0x5652, 0x5656,
+    0x5051, 0x5055, 0x5451, 0x5455, 0x5053, 0x5057, 0x5453, 0x5457, 0x5251, 0x5255, 0x5651, 0x5655, 0x5253, 0x5257, 0x5653, 0x5657,
+    0x5150, 0x5154, 0x5550, 0x5554, 0x5152, 0x5156, 0x5552, 0x5556, 0x5350, 0x5354, 0x5750, 0x5754, 0x5352, 0x5356, 0x5752, 0x5756,
+    0x5151, 0x5155, 0x5551, 0x5555, 0x5153, 0x5157, 0x5553, 0x5557, 0x5351, 0x5355, 0x5751, 0x5755, 0x5353, 0x5357, 0x5753, 0x5757,
+    0x3010, 0x3014, 0x3410, 0x3414, 0x3012, 0x3016, 0x3412, 0x3416, 0x3210, 0x3214, 0x3610, 0x3614, 0x3212, 0x3216, 0x3612, 0x3616,
+    0x3011, 0x3015, 0x3411, 0x3415, 0x3013, 0x3017, 0x3413, 0x3417, 0x3211, 0x3215, 0x3611, 0x3615, 0x3213, 0x3217, 0x3613, 0x3617,
+    0x3110, 0x3114, 0x3510, 0x3514, 0x3112, 0x3116, 0x3512, 0x3516, 0x3310, 0x3314, 0x3710, 0x3714, 0x3312, 0x3316, 0x3712, 0x3716,
+    0x3111, 0x3115, 0x3511, 0x3515, 0x3113, 0x3117, 0x3513, 0x3517, 0x3311, 0x3315, 0x3711, 0x3715, 0x3313, 0x3317, 0x3713, 0x3717,
+    0x7010, 0x7014, 0x7410, 0x7414, 0x7012, 0x7016, 0x7412, 0x7416, 0x7210, 0x7214, 0x7610, 0x7614, 0x7212, 0x7216, 0x7612, 0x7616,
+    0x7011, 0x7015, 0x7411, 0x7415, 0x7013, 0x7017, 0x7413, 0x7417, 0x7211, 0x7215, 0x7611, 0x7615, 0x7213, 0x7217, 0x7613, 0x7617,
+    0x7110, 0x7114, 0x7510, 0x7514, 0x7112, 0x7116, 0x7512, 0x7516, 0x7310, 0x7314, 0x7710, 0x7714, 0x7312, 0x7316, 0x7712, 0x7716,
+    0x7111, 0x7115, 0x7511, 0x7515, 0x7113, 0x7117, 0x7513, 0x7517, 0x7311, 0x7315, 0x7711, 0x7715, 0x7313, 0x7317, 0x7713, 0x7717,
+    0x3050, 0x3054, 0x3450, 0x3454, 0x3052, 0x3056, 0x3452, 0x3456, 0x3250, 0x3254, 0x3650, 0x3654, 0x3252, 0x3256, 0x3652, 0x3656,
+    0x3051, 0x3055, 0x3451, 0x3455, 0x3053, 0x3057, 0x3453, 0x3457, 0x3251, 0x3255, 0x3651, 0x3655, 0x3253, 0x3257, 0x3653, 0x3657,
+    0x3150, 0x3154, 0x3550, 0x3554, 0x3152, 0x3156, 0x3552, 0x3556, 0x3350, 0x3354, 0x3750, 0x3754, 0x3352, 0x3356, 0x3752, 0x3756,
+    0x3151, 0x3155, 0x3551, 0x3555, 0x3153, 0x3157, 0x3553, 0x3557, 0x3351, 0x3355, 0x3751, 0x3755, 0x3353, 0x3357, 0x3753, 0x3757,
+    0x7050, 0x7054, 0x7450, 0x7454, 0x7052, 0x7056, 0x7452, 0x7456, 0x7250, 0x7254, 0x7650, 0x7654, 0x7252, 0x7256, 0x7652, 0x7656,
+    0x7051, 0x7055, 0x7451, 0x7455, 0x7053, 0x7057, 0x7453, 0x7457, 0x7251, 0x7255, 0x7651, 0x7655, 0x7253, 0x7257, 0x7653, 0x7657,
+    0x7150, 0x7154, 0x7550, 0x7554, 0x7152, 0x7156, 0x7552, 0x7556, 0x7350, 0x7354, 0x7750, 0x7754, 0x7352, 0x7356, 0x7752, 0x7756,
+    0x7151, 0x7155, 0x7551, 0x7555, 0x7153, 0x7157, 0x7553, 0x7557, 0x7351, 0x7355, 0x7751, 0x7755, 0x7353, 0x7357, 0x7753, 0x7757,
+    0x1030, 0x1034, 0x1430, 0x1434, 0x1032, 0x1036, 0x1432, 0x1436, 0x1230, 0x1234, 0x1630, 0x1634, 0x1232, 0x1236, 0x1632, 0x1636,
+    0x1031, 0x1035, 0x1431, 0x1435, 0x1033, 0x1037, 0x1433, 0x1437, 0x1231, 0x1235, 0x1631, 0x1635, 0x1233, 0x1237, 0x1633, 0x1637,
+    0x1130, 0x1134, 0x1530, 0x1534, 0x1132, 0x1136, 0x1532, 0x1536, 0x1330, 0x1334, 0x1730, 0x1734, 0x1332, 0x1336, 0x1732, 0x1736,
+    0x1131, 0x1135, 0x1531, 0x1535, 0x1133, 0x1137, 0x1533, 0x1537, 0x1331, 0x1335, 0x1731, 0x1735, 0x1333, 0x1337, 0x1733, 0x1737,
+    0x5030, 0x5034, 0x5430, 0x5434, 0x5032, 0x5036, 0x5432, 0x5436, 0x5230, 0x5234, 0x5630, 0x5634, 0x5232, 0x5236, 0x5632, 0x5636,
+    0x5031, 0x5035, 0x5431, 0x5435, 0x5033, 0x5037, 0x5433, 0x5437, 0x5231, 0x5235, 0x5631, 0x5635, 0x5233, 0x5237, 0x5633, 0x5637,
+    0x5130, 0x5134, 0x5530, 0x5534, 0x5132, 0x5136, 0x5532, 0x5536, 0x5330, 0x5334, 0x5730, 0x5734, 0x5332, 0x5336, 0x5732, 0x5736,
+    0x5131, 0x5135, 0x5531, 0x5535, 0x5133, 0x5137, 0x5533, 0x5537, 0x5331, 0x5335, 0x5731, 0x5735, 0x5333, 0x5337, 0x5733, 0x5737,
+    0x1070, 0x1074, 0x1470, 0x1474, 0x1072, 0x1076, 0x1472, 0x1476, 0x1270, 0x1274, 0x1670, 0x1674, 0x1272, 0x1276, 0x1672, 0x1676,
+    0x1071, 0x1075, 0x1471, 0x1475, 0x1073, 0x1077, 0x1473, 0x1477, 0x1271, 0x1275, 0x1671, 0x1675, 0x1273, 0x1277, 0x1673, 0x1677,
+    0x1170, 0x1174, 0x1570, 0x1574, 0x1172, 0x1176, 0x1572, 0x1576, 0x1370, 0x1374, 0x1770, 0x1774, 0x1372, 0x1376, 0x1772, 0x1776,
+    0x1171, 0x1175, 0x1571, 0x1575, 0x1173, 0x1177, 0x1573, 0x1577, 0x1371, 0x1375, 0x1771, 0x1775, 0x1373, 0x1377, 0x1773, 0x1777,
+    0x5070, 0x5074, 0x5470, 0x5474, 0x5072, 0x5076, 0x5472, 0x5476, 0x5270, 0x5274, 0x5670, 0x5674, 0x5272, 0x5276, 0x5672, 0x5676,
+    0x5071, 0x5075, 0x5471, 0x5475, 0x5073, 0x5077, 0x5473, 0x5477, 0x5271, 0x5275, 0x5671, 0x5675, 0x5273, 0x5277, 0x5673, 0x5677,
+    0x5170, 0x5174, 0x5570, 0x5574, 0x5172, 0x5176, 0x5572, 0x5576, 0x5370, 0x5374, 0x5770, 0x5774, 0x5372, 0x5376, 0x5772, 0x5776,
+    0x5171, 0x5175, 0x5571, 0x5575, 0x5173, 0x5177, 0x5573, 0x5577, 0x5371, 0x5375, 0x5771, 0x5775, 0x5373, 0x5377, 0x5773, 0x5777,
+    0x3030, 0x3034, 0x3430, 0x3434, 0x3032, 0x3036, 0x3432, 0x3436, 0x3230, 0x3234, 0x3630, 0x3634, 0x3232, 0x3236, 0x3632, 0x3636,
+    0x3031, 0x3035, 0x3431, 0x3435, 0x3033, 0x3037, 0x3433, 0x3437, 0x3231, 0x3235, 0x3631, 0x3635, 0x3233, 0x3237, 0x3633, 0x3637,
+    0x3130, 0x3134, 0x3530, 0x3534, 0x3132, 0x3136, 0x3532, 0x3536, 0x3330, 0x3334, 0x3730, 0x3734, 0x3332, 0x3336, 0x3732, 0x3736,
+    0x3131, 0x3135, 0x3531, 0x3535, 0x3133, 0x3137, 0x3533, 0x3537, 0x3331, 0x3335, 0x3731, 0x3735, 0x3333, 0x3337, 0x3733, 0x3737,
+    0x7030, 0x7034, 0x7430, 0x7434, 0x7032, 0x7036, 0x7432, 0x7436, 0x7230, 0x7234, 0x7630, 0x7634, 0x7232, 0x7236, 0x7632, 0x7636,
+    0x7031, 0x7035, 0x7431, 0x7435, 0x7033, 0x7037, 0x7433, 0x7437, 0x7231, 0x7235, 0x7631, 0x7635, 0x7233, 0x7237, 0x7633, 0x7637,
+    0x7130, 0x7134, 0x7530, 0x7534, 0x7132, 0x7136, 0x7532, 0x7536, 0x7330, 0x7334, 0x7730, 0x7734, 0x7332, 0x7336, 0x7732, 0x7736,
+    0x7131, 0x7135, 0x7531, 0x7535, 0x7133, 0x7137, 0x7533, 0x7537, 0x7331, 0x7335, 0x7731, 0x7735, 0x7333, 0x7337, 0x7733, 0x7737,
+    0x3070, 0x3074, 0x3470, 0x3474, 0x3072, 0x3076, 0x3472, 0x3476, 0x3270, 0x3274, 0x3670, 0x3674, 0x3272, 0x3276, 0x3672, 0x3676,
+    0x3071, 0x3075, 0x3471, 0x3475, 0x3073, 0x3077, 0x3473, 0x3477, 0x3271, 0x3275, 0x3671, 0x3675, 0x3273, 0x3277, 0x3673, 0x3677,
+    0x3170, 0x3174, 0x3570, 0x3574, 0x3172, 0x3176, 0x3572, 0x3576, 0x3370, 0x3374, 0x3770, 0x3774, 0x3372, 0x3376, 0x3772, 0x3776,
+    0x3171, 0x3175, 0x3571, 0x3575, 0x3173, 0x3177, 0x3573, 0x3577, 0x3371, 0x3375, 0x3771, 0x3775, 0x3373, 0x3377, 0x3773, 0x3777,
+    0x7070, 0x7074, 0x7470, 0x7474, 0x7072, 0x7076, 0x7472, 0x7476, 0x7270, 0x7274, 0x7670, 0x7674, 0x7272, 0x7276, 0x7672, 0x7676,
+    0x7071, 0x7075, 0x7471, 0x7475, 0x7073, 0x7077, 0x7473, 0x7477, 0x7271, 0x7275, 0x7671, 0x7675, 0x7273, 0x7277, 0x7673, 0x7677,
+    0x7170, 0x7174, 0x7570, 0x7574, 0x7172, 0x7176, 0x7572, 0x7576, 0x7370, 0x7374, 0x7770, 0x7774, 0x7372, 0x7376, 0x7772, 0x7776,
+    0x7171, 0x7175, 0x7571, 0x7575, 0x7173, 0x7177, 0x7573, 0x7577, 0x7371, 0x7375, 0x7771, 0x7775, 0x7373, 0x7377, 0x7773, 0x7777,
+};
+
+// AC13 field without the M bit (see gillhamIndex), or AC12 field -> altitude in feet, or INVALID_ALTITUDE
+const int32_t gillham_altitude[4096] = {
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -1000,   -975,   -950,   -925,   -900,   -875,   -850,   -825,   -800,   -775,   -750,   -725,   -700,   -675,   -650,   -625,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+      -600,   -575,   -550,   -525,   -500,   -475,   -450,   -425,   -400,   -375,   -350,   -325,   -300,   -275,   -250,   -225,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+      -200,   -175,   -150,   -125,   -100,    -75,    -50,    -25,      0,     25,     50,     75,    100,    125,    150,    175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       200,    225,    250,    275,    300,    325,    350,    375,    400,    425,    450,    475,    500,    525,    550,    575,
+     -1200,  62700,   -300,  61800, 126700,  62800, 125800,  63700,    700,  60800,   -200,  61700, 124800,  64700, 125700,  63800,
+       600,    625,    650,    675,    700,    725,    750,    775,    800,    825,    850,    875,    900,    925,    950,    975,
+      2700,  58800,   1800,  59700, 122800,  66700, 123700,  65800,    800,  60700,   1700,  59800, 124700,  64800, 123800,  65700,
+      1000,   1025,   1050,   1075,   1100,   1125,   1150,   1175,   1200,   1225,   1250,   1275,   1300,   1325,   1350,   1375,
+      6700,  54800,   5800,  55700, 118800,  70700, 119700,  69800,   4800,  56700,   5700,  55800, 120700,  68800, 119800,  69700,
+      1400,   1425,   1450,   1475,   1500,   1525,   1550,   1575,   1600,   1625,   1650,   1675,   1700,   1725,   1750,   1775,
+      2800,  58700,   3700,  57800, 122700,  66800, 121800,  67700,   4700,  56800,   3800,  57700, 120800,  68700, 121700,  67800,
+      1800,   1825,   1850,   1875,   1900,   1925,   1950,   1975,   2000,   2025,   2050,   2075,   2100,   2125,   2150,   2175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+      2200,   2225,   2250,   2275,   2300,   2325,   2350,   2375,   2400,   2425,   2450,   2475,   2500,   2525,   2550,   2575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+      2600,   2625,   2650,   2675,   2700,   2725,   2750,   2775,   2800,   2825,   2850,   2875,   2900,   2925,   2950,   2975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+      3000,   3025,   3050,   3075,   3100,   3125,   3150,   3175,   3200,   3225,   3250,   3275,   3300,   3325,   3350,   3375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+      3400,   3425,   3450,   3475,   3500,   3525,   3550,   3575,   3600,   3625,   3650,   3675,   3700,   3725,   3750,   3775,
+     14700,  46800,  13800,  47700, 110800,  78700, 111700,  77800,  12800,  48700,  13700,  47800, 112700,  76800, 111800,  77700,
+      3800,   3825,   3850,   3875,   3900,   3925,   3950,   3975,   4000,   4025,   4050,   4075,   4100,   4125,   4150,   4175,
+     10800,  50700,  11700,  49800, 114700,  74800, 113800,  75700,  12700,  48800,  11800,  49700, 112800,  76700, 113700,  75800,
+      4200,   4225,   4250,   4275,   4300,   4325,   4350,   4375,   4400,   4425,   4450,   4475,   4500,   4525,   4550,   4575,
+      6800,  54700,   7700,  53800, 118700,  70800, 117800,  71700,   8700,  52800,   7800,  53700, 116800,  72700, 117700,  71800,
+      4600,   4625,   4650,   4675,   4700,   4725,   4750,   4775,   4800,   4825,   4850,   4875,   4900,   4925,   4950,   4975,
+     10700,  50800,   9800,  51700, 114800,  74700, 115700,  73800,   8800,  52700,   9700,  51800, 116700,  72800, 115800,  73700,
+      5000,   5025,   5050,   5075,   5100,   5125,   5150,   5175,   5200,   5225,   5250,   5275,   5300,   5325,   5350,   5375,
+     -1000,  62500,   -500,  62000, 126500,  63000, 126000,  63500,    500,  61000,      0,  61500, 125000,  64500, 125500,  64000,
+      5400,   5425,   5450,   5475,   5500,   5525,   5550,   5575,   5600,   5625,   5650,   5675,   5700,   5725,   5750,   5775,
+      2500,  59000,   2000,  59500, 123000,  66500, 123500,  66000,   1000,  60500,   1500,  60000, 124500,  65000, 124000,  65500,
+      5800,   5825,   5850,   5875,   5900,   5925,   5950,   5975,   6000,   6025,   6050,   6075,   6100,   6125,   6150,   6175,
+      6500,  55000,   6000,  55500, 119000,  70500, 119500,  70000,   5000,  56500,   5500,  56000, 120500,  69000, 120000,  69500,
+      6200,   6225,   6250,   6275,   6300,   6325,   6350,   6375,   6400,   6425,   6450,   6475,   6500,   6525,   6550,   6575,
+      3000,  58500,   3500,  58000, 122500,  67000, 122000,  67500,   4500,  57000,   4000,  57500, 121000,  68500, 121500,  68000,
+      6600,   6625,   6650,   6675,   6700,   6725,   6750,   6775,   6800,   6825,   6850,   6875,   6900,   6925,   6950,   6975,
+     -1100,  62600,   -400,  61900, 126600,  62900, 125900,  63600,    600,  60900,   -100,  61600, 124900,  64600, 125600,  63900,
+      7000,   7025,   7050,   7075,   7100,   7125,   7150,   7175,   7200,   7225,   7250,   7275,   7300,   7325,   7350,   7375,
+      2600,  58900,   1900,  59600, 122900,  66600, 123600,  65900,    900,  60600,   1600,  59900, 124600,  64900, 123900,  65600,
+      7400,   7425,   7450,   7475,   7500,   7525,   7550,   7575,   7600,   7625,   7650,   7675,   7700,   7725,   7750,   7775,
+      6600,  54900,   5900,  55600, 118900,  70600, 119600,  69900,   4900,  56600,   5600,  55900, 120600,  68900, 119900,  69600,
+      7800,   7825,   7850,   7875,   7900,   7925,   7950,   7975,   8000,   8025,   8050,   8075,   8100,   8125,   8150,   8175,
+      2900,  58600,   3600,  57900, 122600,  66900, 121900,  67600,   4600,  56900,   3900,  57600, 120900,  68600, 121600,  67900,
+      8200,   8225,   8250,   8275,   8300,   8325,   8350,   8375,   8400,   8425,   8450,   8475,   8500,   8525,   8550,   8575,
+     14500,  47000,  14000,  47500, 111000,  78500, 111500,  78000,  13000,  48500,  13500,  48000, 112500,  77000, 112000,  77500,
+      8600,   8625,   8650,   8675,   8700,   8725,   8750,   8775,   8800,   8825,   8850,   8875,   8900,   8925,   8950,   8975,
+     11000,  50500,  11500,  50000, 114500,  75000, 114000,  75500,  12500,  49000,  12000,  49500, 113000,  76500, 113500,  76000,
+      9000,   9025,   9050,   9075,   9100,   9125,   9150,   9175,   9200,   9225,   9250,   9275,   9300,   9325,   9350,   9375,
+      7000,  54500,   7500,  54000, 118500,  71000, 118000,  71500,   8500,  53000,   8000,  53500, 117000,  72500, 117500,  72000,
+      9400,   9425,   9450,   9475,   9500,   9525,   9550,   9575,   9600,   9625,   9650,   9675,   9700,   9725,   9750,   9775,
+     10500,  51000,  10000,  51500, 115000,  74500, 115500,  74000,   9000,  52500,   9500,  52000, 116500,  73000, 116000,  73500,
+      9800,   9825,   9850,   9875,   9900,   9925,   9950,   9975,  10000,  10025,  10050,  10075,  10100,  10125,  10150,  10175,
+     14600,  46900,  13900,  47600, 110900,  78600, 111600,  77900,  12900,  48600,  13600,  47900, 112600,  76900, 111900,  77600,
+     10200,  10225,  10250,  10275,  10300,  10325,  10350,  10375,  10400,  10425,  10450,  10475,  10500,  10525,  10550,  10575,
+     10900,  50600,  11600,  49900, 114600,  74900, 113900,  75600,  12600,  48900,  11900,  49600, 112900,  76600, 113600,  75900,
+     10600,  10625,  10650,  10675,  10700,  10725,  10750,  10775,  10800,  10825,  10850,  10875,  10900,  10925,  10950,  10975,
+      6900,  54600,   7600,  53900, 118600,  70900, 117900,  71600,   8600,  52900,   7900,  53600, 116900,  72600, 117600,  71900,
+     11000,  11025,  11050,  11075,  11100,  11125,  11150,  11175,  11200,  11225,  11250,  11275,  11300,  11325,  11350,  11375,
+     10600,  50900,   9900,  51600, 114900,  74600, 115600,  73900,   8900,  52600,   9600,  51900, 116600,  72900, 115900,  73600,
+     11400,  11425,  11450,  11475,  11500,  11525,  11550,  11575,  11600,  11625,  11650,  11675,  11700,  11725,  11750,  11775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     11800,  11825,  11850,  11875,  11900,  11925,  11950,  11975,  12000,  12025,  12050,  12075,  12100,  12125,  12150,  12175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     12200,  12225,  12250,  12275,  12300,  12325,  12350,  12375,  12400,  12425,  12450,  12475,  12500,  12525,  12550,  12575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     12600,  12625,  12650,  12675,  12700,  12725,  12750,  12775,  12800,  12825,  12850,  12875,  12900,  12925,  12950,  12975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     13000,  13025,  13050,  13075,  13100,  13125,  13150,  13175,  13200,  13225,  13250,  13275,  13300,  13325,  13350,  13375,
+     30700,  30800,  29800,  31700,  94800,  94700,  95700,  93800,  28800,  32700,  29700,  31800,  96700,  92800,  95800,  93700,
+     13400,  13425,  13450,  13475,  13500,  13525,  13550,  13575,  13600,  13625,  13650,  13675,  13700,  13725,  13750,  13775,
+     26800,  34700,  27700,  33800,  98700,  90800,  97800,  91700,  28700,  32800,  27800,  33700,  96800,  92700,  97700,  91800,
+     13800,  13825,  13850,  13875,  13900,  13925,  13950,  13975,  14000,  14025,  14050,  14075,  14100,  14125,  14150,  14175,
+     22800,  38700,  23700,  37800, 102700,  86800, 101800,  87700,  24700,  36800,  23800,  37700, 100800,  88700, 101700,  87800,
+     14200,  14225,  14250,  14275,  14300,  14325,  14350,  14375,  14400,  14425,  14450,  14475,  14500,  14525,  14550,  14575,
+     26700,  34800,  25800,  35700,  98800,  90700,  99700,  89800,  24800,  36700,  25700,  35800, 100700,  88800,  99800,  89700,
+     14600,  14625,  14650,  14675,  14700,  14725,  14750,  14775,  14800,  14825,  14850,  14875,  14900,  14925,  14950,  14975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     15000,  15025,  15050,  15075,  15100,  15125,  15150,  15175,  15200,  15225,  15250,  15275,  15300,  15325,  15350,  15375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     15400,  15425,  15450,  15475,  15500,  15525,  15550,  15575,  15600,  15625,  15650,  15675,  15700,  15725,  15750,  15775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     15800,  15825,  15850,  15875,  15900,  15925,  15950,  15975,  16000,  16025,  16050,  16075,  16100,  16125,  16150,  16175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     16200,  16225,  16250,  16275,  16300,  16325,  16350,  16375,  16400,  16425,  16450,  16475,  16500,  16525,  16550,  16575,
+     14800,  46700,  15700,  45800, 110700,  78800, 109800,  79700,  16700,  44800,  15800,  45700, 108800,  80700, 109700,  79800,
+     16600,  16625,  16650,  16675,  16700,  16725,  16750,  16775,  16800,  16825,  16850,  16875,  16900,  16925,  16950,  16975,
+     18700,  42800,  17800,  43700, 106800,  82700, 107700,  81800,  16800,  44700,  17700,  43800, 108700,  80800, 107800,  81700,
+     17000,  17025,  17050,  17075,  17100,  17125,  17150,  17175,  17200,  17225,  17250,  17275,  17300,  17325,  17350,  17375,
+     22700,  38800,  21800,  39700, 102800,  86700, 103700,  85800,  20800,  40700,  21700,  39800, 104700,  84800, 103800,  85700,
+     17400,  17425,  17450,  17475,  17500,  17525,  17550,  17575,  17600,  17625,  17650,  17675,  17700,  17725,  17750,  17775,
+     18800,  42700,  19700,  41800, 106700,  82800, 105800,  83700,  20700,  40800,  19800,  41700, 104800,  84700, 105700,  83800,
+     17800,  17825,  17850,  17875,  17900,  17925,  17950,  17975,  18000,  18025,  18050,  18075,  18100,  18125,  18150,  18175,
+     30500,  31000,  30000,  31500,  95000,  94500,  95500,  94000,  29000,  32500,  29500,  32000,  96500,  93000,  96000,  93500,
+     18200,  18225,  18250,  18275,  18300,  18325,  18350,  18375,  18400,  18425,  18450,  18475,  18500,  18525,  18550,  18575,
+     27000,  34500,  27500,  34000,  98500,  91000,  98000,  91500,  28500,  33000,  28000,  33500,  97000,  92500,  97500,  92000,
+     18600,  18625,  18650,  18675,  18700,  18725,  18750,  18775,  18800,  18825,  18850,  18875,  18900,  18925,  18950,  18975,
+     23000,  38500,  23500,  38000, 102500,  87000, 102000,  87500,  24500,  37000,  24000,  37500, 101000,  88500, 101500,  88000,
+     19000,  19025,  19050,  19075,  19100,  19125,  19150,  19175,  19200,  19225,  19250,  19275,  19300,  19325,  19350,  19375,
+     26500,  35000,  26000,  35500,  99000,  90500,  99500,  90000,  25000,  36500,  25500,  36000, 100500,  89000, 100000,  89500,
+     19400,  19425,  19450,  19475,  19500,  19525,  19550,  19575,  19600,  19625,  19650,  19675,  19700,  19725,  19750,  19775,
+     30600,  30900,  29900,  31600,  94900,  94600,  95600,  93900,  28900,  32600,  29600,  31900,  96600,  92900,  95900,  93600,
+     19800,  19825,  19850,  19875,  19900,  19925,  19950,  19975,  20000,  20025,  20050,  20075,  20100,  20125,  20150,  20175,
+     26900,  34600,  27600,  33900,  98600,  90900,  97900,  91600,  28600,  32900,  27900,  33600,  96900,  92600,  97600,  91900,
+     20200,  20225,  20250,  20275,  20300,  20325,  20350,  20375,  20400,  20425,  20450,  20475,  20500,  20525,  20550,  20575,
+     22900,  38600,  23600,  37900, 102600,  86900, 101900,  87600,  24600,  36900,  23900,  37600, 100900,  88600, 101600,  87900,
+     20600,  20625,  20650,  20675,  20700,  20725,  20750,  20775,  20800,  20825,  20850,  20875,  20900,  20925,  20950,  20975,
+     26600,  34900,  25900,  35600,  98900,  90600,  99600,  89900,  24900,  36600,  25600,  35900, 100600,  88900,  99900,  89600,
+     21000,  21025,  21050,  21075,  21100,  21125,  21150,  21175,  21200,  21225,  21250,  21275,  21300,  21325,  21350,  21375,
+     15000,  46500,  15500,  46000, 110500,  79000, 110000,  79500,  16500,  45000,  16000,  45500, 109000,  80500, 109500,  80000,
+     21400,  21425,  21450,  21475,  21500,  21525,  21550,  21575,  21600,  21625,  21650,  21675,  21700,  21725,  21750,  21775,
+     18500,  43000,  18000,  43500, 107000,  82500, 107500,  82000,  17000,  44500,  17500,  44000, 108500,  81000, 108000,  81500,
+     21800,  21825,  21850,  21875,  21900,  21925,  21950,  21975,  22000,  22025,  22050,  22075,  22100,  22125,  22150,  22175,
+     22500,  39000,  22000,  39500, 103000,  86500, 103500,  86000,  21000,  40500,  21500,  40000, 104500,  85000, 104000,  85500,
+     22200,  22225,  22250,  22275,  22300,  22325,  22350,  22375,  22400,  22425,  22450,  22475,  22500,  22525,  22550,  22575,
+     19000,  42500,  19500,  42000, 106500,  83000, 106000,  83500,  20500,  41000,  20000,  41500, 105000,  84500, 105500,  84000,
+     22600,  22625,  22650,  22675,  22700,  22725,  22750,  22775,  22800,  22825,  22850,  22875,  22900,  22925,  22950,  22975,
+     14900,  46600,  15600,  45900, 110600,  78900, 109900,  79600,  16600,  44900,  15900,  45600, 108900,  80600, 109600,  79900,
+     23000,  23025,  23050,  23075,  23100,  23125,  23150,  23175,  23200,  23225,  23250,  23275,  23300,  23325,  23350,  23375,
+     18600,  42900,  17900,  43600, 106900,  82600, 107600,  81900,  16900,  44600,  17600,  43900, 108600,  80900, 107900,  81600,
+     23400,  23425,  23450,  23475,  23500,  23525,  23550,  23575,  23600,  23625,  23650,  23675,  23700,  23725,  23750,  23775,
+     22600,  38900,  21900,  39600, 102900,  86600, 103600,  85900,  20900,  40600,  21600,  39900, 104600,  84900, 103900,  85600,
+     23800,  23825,  23850,  23875,  23900,  23925,  23950,  23975,  24000,  24025,  24050,  24075,  24100,  24125,  24150,  24175,
+     18900,  42600,  19600,  41900, 106600,  82900, 105900,  83600,  20600,  40900,  19900,  41600, 104900,  84600, 105600,  83900,
+     24200,  24225,  24250,  24275,  24300,  24325,  24350,  24375,  24400,  24425,  24450,  24475,  24500,  24525,  24550,  24575,
+      -800,  62300,   -700,  62200, 126300,  63200, 126200,  63300,    300,  61200,    200,  61300, 125200,  64300, 125300,  64200,
+     24600,  24625,  24650,  24675,  24700,  24725,  24750,  24775,  24800,  24825,  24850,  24875,  24900,  24925,  24950,  24975,
+      2300,  59200,   2200,  59300, 123200,  66300, 123300,  66200,   1200,  60300,   1300,  60200, 124300,  65200, 124200,  65300,
+     25000,  25025,  25050,  25075,  25100,  25125,  25150,  25175,  25200,  25225,  25250,  25275,  25300,  25325,  25350,  25375,
+      6300,  55200,   6200,  55300, 119200,  70300, 119300,  70200,   5200,  56300,   5300,  56200, 120300,  69200, 120200,  69300,
+     25400,  25425,  25450,  25475,  25500,  25525,  25550,  25575,  25600,  25625,  25650,  25675,  25700,  25725,  25750,  25775,
+      3200,  58300,   3300,  58200, 122300,  67200, 122200,  67300,   4300,  57200,   4200,  57300, 121200,  68300, 121300,  68200,
+     25800,  25825,  25850,  25875,  25900,  25925,  25950,  25975,  26000,  26025,  26050,  26075,  26100,  26125,  26150,  26175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     26200,  26225,  26250,  26275,  26300,  26325,  26350,  26375,  26400,  26425,  26450,  26475,  26500,  26525,  26550,  26575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     26600,  26625,  26650,  26675,  26700,  26725,  26750,  26775,  26800,  26825,  26850,  26875,  26900,  26925,  26950,  26975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     27000,  27025,  27050,  27075,  27100,  27125,  27150,  27175,  27200,  27225,  27250,  27275,  27300,  27325,  27350,  27375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     27400,  27425,  27450,  27475,  27500,  27525,  27550,  27575,  27600,  27625,  27650,  27675,  27700,  27725,  27750,  27775,
+     14300,  47200,  14200,  47300, 111200,  78300, 111300,  78200,  13200,  48300,  13300,  48200, 112300,  77200, 112200,  77300,
+     27800,  27825,  27850,  27875,  27900,  27925,  27950,  27975,  28000,  28025,  28050,  28075,  28100,  28125,  28150,  28175,
+     11200,  50300,  11300,  50200, 114300,  75200, 114200,  75300,  12300,  49200,  12200,  49300, 113200,  76300, 113300,  76200,
+     28200,  28225,  28250,  28275,  28300,  28325,  28350,  28375,  28400,  28425,  28450,  28475,  28500,  28525,  28550,  28575,
+      7200,  54300,   7300,  54200, 118300,  71200, 118200,  71300,   8300,  53200,   8200,  53300, 117200,  72300, 117300,  72200,
+     28600,  28625,  28650,  28675,  28700,  28725,  28750,  28775,  28800,  28825,  28850,  28875,  28900,  28925,  28950,  28975,
+     10300,  51200,  10200,  51300, 115200,  74300, 115300,  74200,   9200,  52300,   9300,  52200, 116300,  73200, 116200,  73300,
+     29000,  29025,  29050,  29075,  29100,  29125,  29150,  29175,  29200,  29225,  29250,  29275,  29300,  29325,  29350,  29375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     29400,  29425,  29450,  29475,  29500,  29525,  29550,  29575,  29600,  29625,  29650,  29675,  29700,  29725,  29750,  29775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     29800,  29825,  29850,  29875,  29900,  29925,  29950,  29975,  30000,  30025,  30050,  30075,  30100,  30125,  30150,  30175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     30200,  30225,  30250,  30275,  30300,  30325,  30350,  30375,  30400,  30425,  30450,  30475,  30500,  30525,  30550,  30575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     30600,  30625,  30650,  30675,  30700,  30725,  30750,  30775,  30800,  30825,  30850,  30875,  30900,  30925,  30950,  30975,
+      -900,  62400,   -600,  62100, 126400,  63100, 126100,  63400,    400,  61100,    100,  61400, 125100,  64400, 125400,  64100,
+     31000,  31025,  31050,  31075,  31100,  31125,  31150,  31175,  31200,  31225,  31250,  31275,  31300,  31325,  31350,  31375,
+      2400,  59100,   2100,  59400, 123100,  66400, 123400,  66100,   1100,  60400,   1400,  60100, 124400,  65100, 124100,  65400,
+     31400,  31425,  31450,  31475,  31500,  31525,  31550,  31575,  31600,  31625,  31650,  31675,  31700,  31725,  31750,  31775,
+      6400,  55100,   6100,  55400, 119100,  70400, 119400,  70100,   5100,  56400,   5400,  56100, 120400,  69100, 120100,  69400,
+     31800,  31825,  31850,  31875,  31900,  31925,  31950,  31975,  32000,  32025,  32050,  32075,  32100,  32125,  32150,  32175,
+      3100,  58400,   3400,  58100, 122400,  67100, 122100,  67400,   4400,  57100,   4100,  57400, 121100,  68400, 121400,  68100,
+     32200,  32225,  32250,  32275,  32300,  32325,  32350,  32375,  32400,  32425,  32450,  32475,  32500,  32525,  32550,  32575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     32600,  32625,  32650,  32675,  32700,  32725,  32750,  32775,  32800,  32825,  32850,  32875,  32900,  32925,  32950,  32975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     33000,  33025,  33050,  33075,  33100,  33125,  33150,  33175,  33200,  33225,  33250,  33275,  33300,  33325,  33350,  33375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     33400,  33425,  33450,  33475,  33500,  33525,  33550,  33575,  33600,  33625,  33650,  33675,  33700,  33725,  33750,  33775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     33800,  33825,  33850,  33875,  33900,  33925,  33950,  33975,  34000,  34025,  34050,  34075,  34100,  34125,  34150,  34175,
+     14400,  47100,  14100,  47400, 111100,  78400, 111400,  78100,  13100,  48400,  13400,  48100, 112400,  77100, 112100,  77400,
+     34200,  34225,  34250,  34275,  34300,  34325,  34350,  34375,  34400,  34425,  34450,  34475,  34500,  34525,  34550,  34575,
+     11100,  50400,  11400,  50100, 114400,  75100, 114100,  75400,  12400,  49100,  12100,  49400, 113100,  76400, 113400,  76100,
+     34600,  34625,  34650,  34675,  34700,  34725,  34750,  34775,  34800,  34825,  34850,  34875,  34900,  34925,  34950,  34975,
+      7100,  54400,   7400,  54100, 118400,  71100, 118100,  71400,   8400,  53100,   8100,  53400, 117100,  72400, 117400,  72100,
+     35000,  35025,  35050,  35075,  35100,  35125,  35150,  35175,  35200,  35225,  35250,  35275,  35300,  35325,  35350,  35375,
+     10400,  51100,  10100,  51400, 115100,  74400, 115400,  74100,   9100,  52400,   9400,  52100, 116400,  73100, 116100,  73400,
+     35400,  35425,  35450,  35475,  35500,  35525,  35550,  35575,  35600,  35625,  35650,  35675,  35700,  35725,  35750,  35775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     35800,  35825,  35850,  35875,  35900,  35925,  35950,  35975,  36000,  36025,  36050,  36075,  36100,  36125,  36150,  36175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     36200,  36225,  36250,  36275,  36300,  36325,  36350,  36375,  36400,  36425,  36450,  36475,  36500,  36525,  36550,  36575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     36600,  36625,  36650,  36675,  36700,  36725,  36750,  36775,  36800,  36825,  36850,  36875,  36900,  36925,  36950,  36975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     37000,  37025,  37050,  37075,  37100,  37125,  37150,  37175,  37200,  37225,  37250,  37275,  37300,  37325,  37350,  37375,
+     30300,  31200,  30200,  31300,  95200,  94300,  95300,  94200,  29200,  32300,  29300,  32200,  96300,  93200,  96200,  93300,
+     37400,  37425,  37450,  37475,  37500,  37525,  37550,  37575,  37600,  37625,  37650,  37675,  37700,  37725,  37750,  37775,
+     27200,  34300,  27300,  34200,  98300,  91200,  98200,  91300,  28300,  33200,  28200,  33300,  97200,  92300,  97300,  92200,
+     37800,  37825,  37850,  37875,  37900,  37925,  37950,  37975,  38000,  38025,  38050,  38075,  38100,  38125,  38150,  38175,
+     23200,  38300,  23300,  38200, 102300,  87200, 102200,  87300,  24300,  37200,  24200,  37300, 101200,  88300, 101300,  88200,
+     38200,  38225,  38250,  38275,  38300,  38325,  38350,  38375,  38400,  38425,  38450,  38475,  38500,  38525,  38550,  38575,
+     26300,  35200,  26200,  35300,  99200,  90300,  99300,  90200,  25200,  36300,  25300,  36200, 100300,  89200, 100200,  89300,
+     38600,  38625,  38650,  38675,  38700,  38725,  38750,  38775,  38800,  38825,  38850,  38875,  38900,  38925,  38950,  38975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     39000,  39025,  39050,  39075,  39100,  39125,  39150,  39175,  39200,  39225,  39250,  39275,  39300,  39325,  39350,  39375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     39400,  39425,  39450,  39475,  39500,  39525,  39550,  39575,  39600,  39625,  39650,  39675,  39700,  39725,  39750,  39775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     39800,  39825,  39850,  39875,  39900,  39925,  39950,  39975,  40000,  40025,  40050,  40075,  40100,  40125,  40150,  40175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     40200,  40225,  40250,  40275,  40300,  40325,  40350,  40375,  40400,  40425,  40450,  40475,  40500,  40525,  40550,  40575,
+     15200,  46300,  15300,  46200, 110300,  79200, 110200,  79300,  16300,  45200,  16200,  45300, 109200,  80300, 109300,  80200,
+     40600,  40625,  40650,  40675,  40700,  40725,  40750,  40775,  40800,  40825,  40850,  40875,  40900,  40925,  40950,  40975,
+     18300,  43200,  18200,  43300, 107200,  82300, 107300,  82200,  17200,  44300,  17300,  44200, 108300,  81200, 108200,  81300,
+     41000,  41025,  41050,  41075,  41100,  41125,  41150,  41175,  41200,  41225,  41250,  41275,  41300,  41325,  41350,  41375,
+     22300,  39200,  22200,  39300, 103200,  86300, 103300,  86200,  21200,  40300,  21300,  40200, 104300,  85200, 104200,  85300,
+     41400,  41425,  41450,  41475,  41500,  41525,  41550,  41575,  41600,  41625,  41650,  41675,  41700,  41725,  41750,  41775,
+     19200,  42300,  19300,  42200, 106300,  83200, 106200,  83300,  20300,  41200,  20200,  41300, 105200,  84300, 105300,  84200,
+     41800,  41825,  41850,  41875,  41900,  41925,  41950,  41975,  42000,  42025,  42050,  42075,  42100,  42125,  42150,  42175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     42200,  42225,  42250,  42275,  42300,  42325,  42350,  42375,  42400,  42425,  42450,  42475,  42500,  42525,  42550,  42575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     42600,  42625,  42650,  42675,  42700,  42725,  42750,  42775,  42800,  42825,  42850,  42875,  42900,  42925,  42950,  42975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     43000,  43025,  43050,  43075,  43100,  43125,  43150,  43175,  43200,  43225,  43250,  43275,  43300,  43325,  43350,  43375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     43400,  43425,  43450,  43475,  43500,  43525,  43550,  43575,  43600,  43625,  43650,  43675,  43700,  43725,  43750,  43775,
+     30400,  31100,  30100,  31400,  95100,  94400,  95400,  94100,  29100,  32400,  29400,  32100,  96400,  93100,  96100,  93400,
+     43800,  43825,  43850,  43875,  43900,  43925,  43950,  43975,  44000,  44025,  44050,  44075,  44100,  44125,  44150,  44175,
+     27100,  34400,  27400,  34100,  98400,  91100,  98100,  91400,  28400,  33100,  28100,  33400,  97100,  92400,  97400,  92100,
+     44200,  44225,  44250,  44275,  44300,  44325,  44350,  44375,  44400,  44425,  44450,  44475,  44500,  44525,  44550,  44575,
+     23100,  38400,  23400,  38100, 102400,  87100, 102100,  87400,  24400,  37100,  24100,  37400, 101100,  88400, 101400,  88100,
+     44600,  44625,  44650,  44675,  44700,  44725,  44750,  44775,  44800,  44825,  44850,  44875,  44900,  44925,  44950,  44975,
+     26400,  35100,  26100,  35400,  99100,  90400,  99400,  90100,  25100,  36400,  25400,  36100, 100400,  89100, 100100,  89400,
+     45000,  45025,  45050,  45075,  45100,  45125,  45150,  45175,  45200,  45225,  45250,  45275,  45300,  45325,  45350,  45375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     45400,  45425,  45450,  45475,  45500,  45525,  45550,  45575,  45600,  45625,  45650,  45675,  45700,  45725,  45750,  45775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     45800,  45825,  45850,  45875,  45900,  45925,  45950,  45975,  46000,  46025,  46050,  46075,  46100,  46125,  46150,  46175,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     46200,  46225,  46250,  46275,  46300,  46325,  46350,  46375,  46400,  46425,  46450,  46475,  46500,  46525,  46550,  46575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     46600,  46625,  46650,  46675,  46700,  46725,  46750,  46775,  46800,  46825,  46850,  46875,  46900,  46925,  46950,  46975,
+     15100,  46400,  15400,  46100, 110400,  79100, 110100,  79400,  16400,  45100,  16100,  45400, 109100,  80400, 109400,  80100,
+     47000,  47025,  47050,  47075,  47100,  47125,  47150,  47175,  47200,  47225,  47250,  47275,  47300,  47325,  47350,  47375,
+     18400,  43100,  18100,  43400, 107100,  82400, 107400,  82100,  17100,  44400,  17400,  44100, 108400,  81100, 108100,  81400,
+     47400,  47425,  47450,  47475,  47500,  47525,  47550,  47575,  47600,  47625,  47650,  47675,  47700,  47725,  47750,  47775,
+     22400,  39100,  22100,  39400, 103100,  86400, 103400,  86100,  21100,  40400,  21400,  40100, 104400,  85100, 104100,  85400,
+     47800,  47825,  47850,  47875,  47900,  47925,  47950,  47975,  48000,  48025,  48050,  48075,  48100,  48125,  48150,  48175,
+     19100,  42400,  19400,  42100, 106400,  83100, 106100,  83400,  20400,  41100,  20100,  41400, 105100,  84400, 105400,  84100,
+     48200,  48225,  48250,  48275,  48300,  48325,  48350,  48375,  48400,  48425,  48450,  48475,  48500,  48525,  48550,  48575,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     48600,  48625,  48650,  48675,  48700,  48725,  48750,  48775,  48800,  48825,  48850,  48875,  48900,  48925,  48950,  48975,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     49000,  49025,  49050,  49075,  49100,  49125,  49150,  49175,  49200,  49225,  49250,  49275,  49300,  49325,  49350,  49375,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     49400,  49425,  49450,  49475,  49500,  49525,  49550,  49575,  49600,  49625,  49650,  49675,  49700,  49725,  49750,  49775,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     49800,  49825,  49850,  49875,  49900,  49925,  49950,  49975,  50000,  50025,  50050,  50075,  50100,  50125,  50150,  50175,
+};
+
+// modeAToIndex(Mode A) -> Mode C (signed multiple of 100 ft), or INVALID_ALTITUDE
+const int16_t gillham_mode_a_to_c[4096] = {
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     -8,  -9999,   1263,  -9999,    623,  -9999,    632,  -9999,
+       -10,  -9999,   1265,  -9999,    625,  -9999,    630,  -9999,     -9,  -9999,   1264,  -9999,    624,  -9999,    631,  -9999,
+       -12,  -9999,   1267,  -9999,    627,  -9999,    628,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       -11,  -9999,   1266,  -9999,    626,  -9999,    629,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     23,  -9999,   1232,  -9999,    592,  -9999,    663,  -9999,
+        25,  -9999,   1230,  -9999,    590,  -9999,    665,  -9999,     24,  -9999,   1231,  -9999,    591,  -9999,    664,  -9999,
+        27,  -9999,   1228,  -9999,    588,  -9999,    667,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        26,  -9999,   1229,  -9999,    589,  -9999,    666,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,      3,  -9999,   1252,  -9999,    612,  -9999,    643,  -9999,
+         5,  -9999,   1250,  -9999,    610,  -9999,    645,  -9999,      4,  -9999,   1251,  -9999,    611,  -9999,    644,  -9999,
+         7,  -9999,   1248,  -9999,    608,  -9999,    647,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+         6,  -9999,   1249,  -9999,    609,  -9999,    646,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     12,  -9999,   1243,  -9999,    603,  -9999,    652,  -9999,
+        10,  -9999,   1245,  -9999,    605,  -9999,    650,  -9999,     11,  -9999,   1244,  -9999,    604,  -9999,    651,  -9999,
+         8,  -9999,   1247,  -9999,    607,  -9999,    648,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+         9,  -9999,   1246,  -9999,    606,  -9999,    649,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     -7,  -9999,   1262,  -9999,    622,  -9999,    633,  -9999,
+        -5,  -9999,   1260,  -9999,    620,  -9999,    635,  -9999,     -6,  -9999,   1261,  -9999,    621,  -9999,    634,  -9999,
+        -3,  -9999,   1258,  -9999,    618,  -9999,    637,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        -4,  -9999,   1259,  -9999,    619,  -9999,    636,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     22,  -9999,   1233,  -9999,    593,  -9999,    662,  -9999,
+        20,  -9999,   1235,  -9999,    595,  -9999,    660,  -9999,     21,  -9999,   1234,  -9999,    594,  -9999,    661,  -9999,
+        18,  -9999,   1237,  -9999,    597,  -9999,    658,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        19,  -9999,   1236,  -9999,    596,  -9999,    659,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,      2,  -9999,   1253,  -9999,    613,  -9999,    642,  -9999,
+         0,  -9999,   1255,  -9999,    615,  -9999,    640,  -9999,      1,  -9999,   1254,  -9999,    614,  -9999,    641,  -9999,
+        -2,  -9999,   1257,  -9999,    617,  -9999,    638,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        -1,  -9999,   1256,  -9999,    616,  -9999,    639,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     13,  -9999,   1242,  -9999,    602,  -9999,    653,  -9999,
+        15,  -9999,   1240,  -9999,    600,  -9999,    655,  -9999,     14,  -9999,   1241,  -9999,    601,  -9999,    654,  -9999,
+        17,  -9999,   1238,  -9999,    598,  -9999,    657,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        16,  -9999,   1239,  -9999,    599,  -9999,    656,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    303,  -9999,    952,  -9999,    312,  -9999,    943,  -9999,
+       305,  -9999,    950,  -9999,    310,  -9999,    945,  -9999,    304,  -9999,    951,  -9999,    311,  -9999,    944,  -9999,
+       307,  -9999,    948,  -9999,    308,  -9999,    947,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       306,  -9999,    949,  -9999,    309,  -9999,    946,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    272,  -9999,    983,  -9999,    343,  -9999,    912,  -9999,
+       270,  -9999,    985,  -9999,    345,  -9999,    910,  -9999,    271,  -9999,    984,  -9999,    344,  -9999,    911,  -9999,
+       268,  -9999,    987,  -9999,    347,  -9999,    908,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       269,  -9999,    986,  -9999,    346,  -9999,    909,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    292,  -9999,    963,  -9999,    323,  -9999,    932,  -9999,
+       290,  -9999,    965,  -9999,    325,  -9999,    930,  -9999,    291,  -9999,    964,  -9999,    324,  -9999,    931,  -9999,
+       288,  -9999,    967,  -9999,    327,  -9999,    928,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       289,  -9999,    966,  -9999,    326,  -9999,    929,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    283,  -9999,    972,  -9999,    332,  -9999,    923,  -9999,
+       285,  -9999,    970,  -9999,    330,  -9999,    925,  -9999,    284,  -9999,    971,  -9999,    331,  -9999,    924,  -9999,
+       287,  -9999,    968,  -9999,    328,  -9999,    927,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       286,  -9999,    969,  -9999,    329,  -9999,    926,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    302,  -9999,    953,  -9999,    313,  -9999,    942,  -9999,
+       300,  -9999,    955,  -9999,    315,  -9999,    940,  -9999,    301,  -9999,    954,  -9999,    314,  -9999,    941,  -9999,
+       298,  -9999,    957,  -9999,    317,  -9999,    938,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       299,  -9999,    956,  -9999,    316,  -9999,    939,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    273,  -9999,    982,  -9999,    342,  -9999,    913,  -9999,
+       275,  -9999,    980,  -9999,    340,  -9999,    915,  -9999,    274,  -9999,    981,  -9999,    341,  -9999,    914,  -9999,
+       277,  -9999,    978,  -9999,    338,  -9999,    917,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       276,  -9999,    979,  -9999,    339,  -9999,    916,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    293,  -9999,    962,  -9999,    322,  -9999,    933,  -9999,
+       295,  -9999,    960,  -9999,    320,  -9999,    935,  -9999,    294,  -9999,    961,  -9999,    321,  -9999,    934,  -9999,
+       297,  -9999,    958,  -9999,    318,  -9999,    937,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       296,  -9999,    959,  -9999,    319,  -9999,    936,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    282,  -9999,    973,  -9999,    333,  -9999,    922,  -9999,
+       280,  -9999,    975,  -9999,    335,  -9999,    920,  -9999,    281,  -9999,    974,  -9999,    334,  -9999,    921,  -9999,
+       278,  -9999,    977,  -9999,    337,  -9999,    918,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       279,  -9999,    976,  -9999,    336,  -9999,    919,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    143,  -9999,   1112,  -9999,    472,  -9999,    783,  -9999,
+       145,  -9999,   1110,  -9999,    470,  -9999,    785,  -9999,    144,  -9999,   1111,  -9999,    471,  -9999,    784,  -9999,
+       147,  -9999,   1108,  -9999,    468,  -9999,    787,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       146,  -9999,   1109,  -9999,    469,  -9999,    786,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    112,  -9999,   1143,  -9999,    503,  -9999,    752,  -9999,
+       110,  -9999,   1145,  -9999,    505,  -9999,    750,  -9999,    111,  -9999,   1144,  -9999,    504,  -9999,    751,  -9999,
+       108,  -9999,   1147,  -9999,    507,  -9999,    748,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       109,  -9999,   1146,  -9999,    506,  -9999,    749,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    132,  -9999,   1123,  -9999,    483,  -9999,    772,  -9999,
+       130,  -9999,   1125,  -9999,    485,  -9999,    770,  -9999,    131,  -9999,   1124,  -9999,    484,  -9999,    771,  -9999,
+       128,  -9999,   1127,  -9999,    487,  -9999,    768,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       129,  -9999,   1126,  -9999,    486,  -9999,    769,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    123,  -9999,   1132,  -9999,    492,  -9999,    763,  -9999,
+       125,  -9999,   1130,  -9999,    490,  -9999,    765,  -9999,    124,  -9999,   1131,  -9999,    491,  -9999,    764,  -9999,
+       127,  -9999,   1128,  -9999,    488,  -9999,    767,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       126,  -9999,   1129,  -9999,    489,  -9999,    766,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    142,  -9999,   1113,  -9999,    473,  -9999,    782,  -9999,
+       140,  -9999,   1115,  -9999,    475,  -9999,    780,  -9999,    141,  -9999,   1114,  -9999,    474,  -9999,    781,  -9999,
+       138,  -9999,   1117,  -9999,    477,  -9999,    778,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       139,  -9999,   1116,  -9999,    476,  -9999,    779,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    113,  -9999,   1142,  -9999,    502,  -9999,    753,  -9999,
+       115,  -9999,   1140,  -9999,    500,  -9999,    755,  -9999,    114,  -9999,   1141,  -9999,    501,  -9999,    754,  -9999,
+       117,  -9999,   1138,  -9999,    498,  -9999,    757,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       116,  -9999,   1139,  -9999,    499,  -9999,    756,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    133,  -9999,   1122,  -9999,    482,  -9999,    773,  -9999,
+       135,  -9999,   1120,  -9999,    480,  -9999,    775,  -9999,    134,  -9999,   1121,  -9999,    481,  -9999,    774,  -9999,
+       137,  -9999,   1118,  -9999,    478,  -9999,    777,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       136,  -9999,   1119,  -9999,    479,  -9999,    776,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    122,  -9999,   1133,  -9999,    493,  -9999,    762,  -9999,
+       120,  -9999,   1135,  -9999,    495,  -9999,    760,  -9999,    121,  -9999,   1134,  -9999,    494,  -9999,    761,  -9999,
+       118,  -9999,   1137,  -9999,    497,  -9999,    758,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       119,  -9999,   1136,  -9999,    496,  -9999,    759,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    152,  -9999,   1103,  -9999,    463,  -9999,    792,  -9999,
+       150,  -9999,   1105,  -9999,    465,  -9999,    790,  -9999,    151,  -9999,   1104,  -9999,    464,  -9999,    791,  -9999,
+       148,  -9999,   1107,  -9999,    467,  -9999,    788,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       149,  -9999,   1106,  -9999,    466,  -9999,    789,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    183,  -9999,   1072,  -9999,    432,  -9999,    823,  -9999,
+       185,  -9999,   1070,  -9999,    430,  -9999,    825,  -9999,    184,  -9999,   1071,  -9999,    431,  -9999,    824,  -9999,
+       187,  -9999,   1068,  -9999,    428,  -9999,    827,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       186,  -9999,   1069,  -9999,    429,  -9999,    826,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    163,  -9999,   1092,  -9999,    452,  -9999,    803,  -9999,
+       165,  -9999,   1090,  -9999,    450,  -9999,    805,  -9999,    164,  -9999,   1091,  -9999,    451,  -9999,    804,  -9999,
+       167,  -9999,   1088,  -9999,    448,  -9999,    807,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       166,  -9999,   1089,  -9999,    449,  -9999,    806,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    172,  -9999,   1083,  -9999,    443,  -9999,    812,  -9999,
+       170,  -9999,   1085,  -9999,    445,  -9999,    810,  -9999,    171,  -9999,   1084,  -9999,    444,  -9999,    811,  -9999,
+       168,  -9999,   1087,  -9999,    447,  -9999,    808,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       169,  -9999,   1086,  -9999,    446,  -9999,    809,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    153,  -9999,   1102,  -9999,    462,  -9999,    793,  -9999,
+       155,  -9999,   1100,  -9999,    460,  -9999,    795,  -9999,    154,  -9999,   1101,  -9999,    461,  -9999,    794,  -9999,
+       157,  -9999,   1098,  -9999,    458,  -9999,    797,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       156,  -9999,   1099,  -9999,    459,  -9999,    796,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    182,  -9999,   1073,  -9999,    433,  -9999,    822,  -9999,
+       180,  -9999,   1075,  -9999,    435,  -9999,    820,  -9999,    181,  -9999,   1074,  -9999,    434,  -9999,    821,  -9999,
+       178,  -9999,   1077,  -9999,    437,  -9999,    818,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       179,  -9999,   1076,  -9999,    436,  -9999,    819,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    162,  -9999,   1093,  -9999,    453,  -9999,    802,  -9999,
+       160,  -9999,   1095,  -9999,    455,  -9999,    800,  -9999,    161,  -9999,   1094,  -9999,    454,  -9999,    801,  -9999,
+       158,  -9999,   1097,  -9999,    457,  -9999,    798,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       159,  -9999,   1096,  -9999,    456,  -9999,    799,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    173,  -9999,   1082,  -9999,    442,  -9999,    813,  -9999,
+       175,  -9999,   1080,  -9999,    440,  -9999,    815,  -9999,    174,  -9999,   1081,  -9999,    441,  -9999,    814,  -9999,
+       177,  -9999,   1078,  -9999,    438,  -9999,    817,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       176,  -9999,   1079,  -9999,    439,  -9999,    816,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     63,  -9999,   1192,  -9999,    552,  -9999,    703,  -9999,
+        65,  -9999,   1190,  -9999,    550,  -9999,    705,  -9999,     64,  -9999,   1191,  -9999,    551,  -9999,    704,  -9999,
+        67,  -9999,   1188,  -9999,    548,  -9999,    707,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        66,  -9999,   1189,  -9999,    549,  -9999,    706,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     32,  -9999,   1223,  -9999,    583,  -9999,    672,  -9999,
+        30,  -9999,   1225,  -9999,    585,  -9999,    670,  -9999,     31,  -9999,   1224,  -9999,    584,  -9999,    671,  -9999,
+        28,  -9999,   1227,  -9999,    587,  -9999,    668,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        29,  -9999,   1226,  -9999,    586,  -9999,    669,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     52,  -9999,   1203,  -9999,    563,  -9999,    692,  -9999,
+        50,  -9999,   1205,  -9999,    565,  -9999,    690,  -9999,     51,  -9999,   1204,  -9999,    564,  -9999,    691,  -9999,
+        48,  -9999,   1207,  -9999,    567,  -9999,    688,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        49,  -9999,   1206,  -9999,    566,  -9999,    689,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     43,  -9999,   1212,  -9999,    572,  -9999,    683,  -9999,
+        45,  -9999,   1210,  -9999,    570,  -9999,    685,  -9999,     44,  -9999,   1211,  -9999,    571,  -9999,    684,  -9999,
+        47,  -9999,   1208,  -9999,    568,  -9999,    687,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        46,  -9999,   1209,  -9999,    569,  -9999,    686,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     62,  -9999,   1193,  -9999,    553,  -9999,    702,  -9999,
+        60,  -9999,   1195,  -9999,    555,  -9999,    700,  -9999,     61,  -9999,   1194,  -9999,    554,  -9999,    701,  -9999,
+        58,  -9999,   1197,  -9999,    557,  -9999,    698,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        59,  -9999,   1196,  -9999,    556,  -9999,    699,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     33,  -9999,   1222,  -9999,    582,  -9999,    673,  -9999,
+        35,  -9999,   1220,  -9999,    580,  -9999,    675,  -9999,     34,  -9999,   1221,  -9999,    581,  -9999,    674,  -9999,
+        37,  -9999,   1218,  -9999,    578,  -9999,    677,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        36,  -9999,   1219,  -9999,    579,  -9999,    676,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     53,  -9999,   1202,  -9999,    562,  -9999,    693,  -9999,
+        55,  -9999,   1200,  -9999,    560,  -9999,    695,  -9999,     54,  -9999,   1201,  -9999,    561,  -9999,    694,  -9999,
+        57,  -9999,   1198,  -9999,    558,  -9999,    697,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        56,  -9999,   1199,  -9999,    559,  -9999,    696,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     42,  -9999,   1213,  -9999,    573,  -9999,    682,  -9999,
+        40,  -9999,   1215,  -9999,    575,  -9999,    680,  -9999,     41,  -9999,   1214,  -9999,    574,  -9999,    681,  -9999,
+        38,  -9999,   1217,  -9999,    577,  -9999,    678,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        39,  -9999,   1216,  -9999,    576,  -9999,    679,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    232,  -9999,   1023,  -9999,    383,  -9999,    872,  -9999,
+       230,  -9999,   1025,  -9999,    385,  -9999,    870,  -9999,    231,  -9999,   1024,  -9999,    384,  -9999,    871,  -9999,
+       228,  -9999,   1027,  -9999,    387,  -9999,    868,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       229,  -9999,   1026,  -9999,    386,  -9999,    869,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    263,  -9999,    992,  -9999,    352,  -9999,    903,  -9999,
+       265,  -9999,    990,  -9999,    350,  -9999,    905,  -9999,    264,  -9999,    991,  -9999,    351,  -9999,    904,  -9999,
+       267,  -9999,    988,  -9999,    348,  -9999,    907,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       266,  -9999,    989,  -9999,    349,  -9999,    906,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    243,  -9999,   1012,  -9999,    372,  -9999,    883,  -9999,
+       245,  -9999,   1010,  -9999,    370,  -9999,    885,  -9999,    244,  -9999,   1011,  -9999,    371,  -9999,    884,  -9999,
+       247,  -9999,   1008,  -9999,    368,  -9999,    887,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       246,  -9999,   1009,  -9999,    369,  -9999,    886,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    252,  -9999,   1003,  -9999,    363,  -9999,    892,  -9999,
+       250,  -9999,   1005,  -9999,    365,  -9999,    890,  -9999,    251,  -9999,   1004,  -9999,    364,  -9999,    891,  -9999,
+       248,  -9999,   1007,  -9999,    367,  -9999,    888,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       249,  -9999,   1006,  -9999,    366,  -9999,    889,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    233,  -9999,   1022,  -9999,    382,  -9999,    873,  -9999,
+       235,  -9999,   1020,  -9999,    380,  -9999,    875,  -9999,    234,  -9999,   1021,  -9999,    381,  -9999,    874,  -9999,
+       237,  -9999,   1018,  -9999,    378,  -9999,    877,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       236,  -9999,   1019,  -9999,    379,  -9999,    876,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    262,  -9999,    993,  -9999,    353,  -9999,    902,  -9999,
+       260,  -9999,    995,  -9999,    355,  -9999,    900,  -9999,    261,  -9999,    994,  -9999,    354,  -9999,    901,  -9999,
+       258,  -9999,    997,  -9999,    357,  -9999,    898,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       259,  -9999,    996,  -9999,    356,  -9999,    899,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    242,  -9999,   1013,  -9999,    373,  -9999,    882,  -9999,
+       240,  -9999,   1015,  -9999,    375,  -9999,    880,  -9999,    241,  -9999,   1014,  -9999,    374,  -9999,    881,  -9999,
+       238,  -9999,   1017,  -9999,    377,  -9999,    878,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       239,  -9999,   1016,  -9999,    376,  -9999,    879,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    253,  -9999,   1002,  -9999,    362,  -9999,    893,  -9999,
+       255,  -9999,   1000,  -9999,    360,  -9999,    895,  -9999,    254,  -9999,   1001,  -9999,    361,  -9999,    894,  -9999,
+       257,  -9999,    998,  -9999,    358,  -9999,    897,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       256,  -9999,    999,  -9999,    359,  -9999,    896,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     72,  -9999,   1183,  -9999,    543,  -9999,    712,  -9999,
+        70,  -9999,   1185,  -9999,    545,  -9999,    710,  -9999,     71,  -9999,   1184,  -9999,    544,  -9999,    711,  -9999,
+        68,  -9999,   1187,  -9999,    547,  -9999,    708,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        69,  -9999,   1186,  -9999,    546,  -9999,    709,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    103,  -9999,   1152,  -9999,    512,  -9999,    743,  -9999,
+       105,  -9999,   1150,  -9999,    510,  -9999,    745,  -9999,    104,  -9999,   1151,  -9999,    511,  -9999,    744,  -9999,
+       107,  -9999,   1148,  -9999,    508,  -9999,    747,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       106,  -9999,   1149,  -9999,    509,  -9999,    746,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     83,  -9999,   1172,  -9999,    532,  -9999,    723,  -9999,
+        85,  -9999,   1170,  -9999,    530,  -9999,    725,  -9999,     84,  -9999,   1171,  -9999,    531,  -9999,    724,  -9999,
+        87,  -9999,   1168,  -9999,    528,  -9999,    727,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        86,  -9999,   1169,  -9999,    529,  -9999,    726,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     92,  -9999,   1163,  -9999,    523,  -9999,    732,  -9999,
+        90,  -9999,   1165,  -9999,    525,  -9999,    730,  -9999,     91,  -9999,   1164,  -9999,    524,  -9999,    731,  -9999,
+        88,  -9999,   1167,  -9999,    527,  -9999,    728,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        89,  -9999,   1166,  -9999,    526,  -9999,    729,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     73,  -9999,   1182,  -9999,    542,  -9999,    713,  -9999,
+        75,  -9999,   1180,  -9999,    540,  -9999,    715,  -9999,     74,  -9999,   1181,  -9999,    541,  -9999,    714,  -9999,
+        77,  -9999,   1178,  -9999,    538,  -9999,    717,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        76,  -9999,   1179,  -9999,    539,  -9999,    716,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    102,  -9999,   1153,  -9999,    513,  -9999,    742,  -9999,
+       100,  -9999,   1155,  -9999,    515,  -9999,    740,  -9999,    101,  -9999,   1154,  -9999,    514,  -9999,    741,  -9999,
+        98,  -9999,   1157,  -9999,    517,  -9999,    738,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        99,  -9999,   1156,  -9999,    516,  -9999,    739,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     82,  -9999,   1173,  -9999,    533,  -9999,    722,  -9999,
+        80,  -9999,   1175,  -9999,    535,  -9999,    720,  -9999,     81,  -9999,   1174,  -9999,    534,  -9999,    721,  -9999,
+        78,  -9999,   1177,  -9999,    537,  -9999,    718,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        79,  -9999,   1176,  -9999,    536,  -9999,    719,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,     93,  -9999,   1162,  -9999,    522,  -9999,    733,  -9999,
+        95,  -9999,   1160,  -9999,    520,  -9999,    735,  -9999,     94,  -9999,   1161,  -9999,    521,  -9999,    734,  -9999,
+        97,  -9999,   1158,  -9999,    518,  -9999,    737,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+        96,  -9999,   1159,  -9999,    519,  -9999,    736,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    223,  -9999,   1032,  -9999,    392,  -9999,    863,  -9999,
+       225,  -9999,   1030,  -9999,    390,  -9999,    865,  -9999,    224,  -9999,   1031,  -9999,    391,  -9999,    864,  -9999,
+       227,  -9999,   1028,  -9999,    388,  -9999,    867,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       226,  -9999,   1029,  -9999,    389,  -9999,    866,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    192,  -9999,   1063,  -9999,    423,  -9999,    832,  -9999,
+       190,  -9999,   1065,  -9999,    425,  -9999,    830,  -9999,    191,  -9999,   1064,  -9999,    424,  -9999,    831,  -9999,
+       188,  -9999,   1067,  -9999,    427,  -9999,    828,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       189,  -9999,   1066,  -9999,    426,  -9999,    829,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    212,  -9999,   1043,  -9999,    403,  -9999,    852,  -9999,
+       210,  -9999,   1045,  -9999,    405,  -9999,    850,  -9999,    211,  -9999,   1044,  -9999,    404,  -9999,    851,  -9999,
+       208,  -9999,   1047,  -9999,    407,  -9999,    848,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       209,  -9999,   1046,  -9999,    406,  -9999,    849,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    203,  -9999,   1052,  -9999,    412,  -9999,    843,  -9999,
+       205,  -9999,   1050,  -9999,    410,  -9999,    845,  -9999,    204,  -9999,   1051,  -9999,    411,  -9999,    844,  -9999,
+       207,  -9999,   1048,  -9999,    408,  -9999,    847,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       206,  -9999,   1049,  -9999,    409,  -9999,    846,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    222,  -9999,   1033,  -9999,    393,  -9999,    862,  -9999,
+       220,  -9999,   1035,  -9999,    395,  -9999,    860,  -9999,    221,  -9999,   1034,  -9999,    394,  -9999,    861,  -9999,
+       218,  -9999,   1037,  -9999,    397,  -9999,    858,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       219,  -9999,   1036,  -9999,    396,  -9999,    859,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    193,  -9999,   1062,  -9999,    422,  -9999,    833,  -9999,
+       195,  -9999,   1060,  -9999,    420,  -9999,    835,  -9999,    194,  -9999,   1061,  -9999,    421,  -9999,    834,  -9999,
+       197,  -9999,   1058,  -9999,    418,  -9999,    837,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       196,  -9999,   1059,  -9999,    419,  -9999,    836,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    213,  -9999,   1042,  -9999,    402,  -9999,    853,  -9999,
+       215,  -9999,   1040,  -9999,    400,  -9999,    855,  -9999,    214,  -9999,   1041,  -9999,    401,  -9999,    854,  -9999,
+       217,  -9999,   1038,  -9999,    398,  -9999,    857,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       216,  -9999,   1039,  -9999,    399,  -9999,    856,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+     -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,    202,  -9999,   1053,  -9999,    413,  -9999,    842,  -9999,
+       200,  -9999,   1055,  -9999,    415,  -9999,    840,  -9999,    201,  -9999,   1054,  -9999,    414,  -9999,    841,  -9999,
+       198,  -9999,   1057,  -9999,    417,  -9999,    838,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+       199,  -9999,   1056,  -9999,    416,  -9999,    839,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,  -9999,
+};
+
+// Mode C + 13 -> Mode A, or 0 if not a valid Mode C value
+const uint16_t gillham_mode_c_to_a[4096] = {
+    0x0000, 0x0040, 0x0060, 0x0020, 0x0030, 0x0010, 0x0410, 0x0430, 0x0420, 0x0460, 0x0440, 0x0640, 0x0660, 0x0620, 0x0630, 0x0610,
+    0x0210, 0x0230, 0x0220, 0x0260, 0x0240, 0x0340, 0x0360, 0x0320, 0x0330, 0x0310, 0x0710, 0x0730, 0x0720, 0x0760, 0x0740, 0x0540,
+    0x0560, 0x0520, 0x0530, 0x0510, 0x0110, 0x0130, 0x0120, 0x0160, 0x0140, 0x4140, 0x4160, 0x4120, 0x4130, 0x4110, 0x4510, 0x4530,
+    0x4520, 0x4560, 0x4540, 0x4740, 0x4760, 0x4720, 0x4730, 0x4710, 0x4310, 0x4330, 0x4320, 0x4360, 0x4340, 0x4240, 0x4260, 0x4220,
+    0x4230, 0x4210, 0x4610, 0x4630, 0x4620, 0x4660, 0x4640, 0x4440, 0x4460, 0x4420, 0x4430, 0x4410, 0x4010, 0x4030, 0x4020, 0x4060,
+    0x4040, 0x6040, 0x6060, 0x6020, 0x6030, 0x6010, 0x6410, 0x6430, 0x6420, 0x6460, 0x6440, 0x6640, 0x6660, 0x6620, 0x6630, 0x6610,
+    0x6210, 0x6230, 0x6220, 0x6260, 0x6240, 0x6340, 0x6360, 0x6320, 0x6330, 0x6310, 0x6710, 0x6730, 0x6720, 0x6760, 0x6740, 0x6540,
+    0x6560, 0x6520, 0x6530, 0x6510, 0x6110, 0x6130, 0x6120, 0x6160, 0x6140, 0x2140, 0x2160, 0x2120, 0x2130, 0x2110, 0x2510, 0x2530,
+    0x2520, 0x2560, 0x2540, 0x2740, 0x2760, 0x2720, 0x2730, 0x2710, 0x2310, 0x2330, 0x2320, 0x2360, 0x2340, 0x2240, 0x2260, 0x2220,
+    0x2230, 0x2210, 0x2610, 0x2630, 0x2620, 0x2660, 0x2640, 0x2440, 0x2460, 0x2420, 0x2430, 0x2410, 0x2010, 0x2030, 0x2020, 0x2060,
+    0x2040, 0x3040, 0x3060, 0x3020, 0x3030, 0x3010, 0x3410, 0x3430, 0x3420, 0x3460, 0x3440, 0x3640, 0x3660, 0x3620, 0x3630, 0x3610,
+    0x3210, 0x3230, 0x3220, 0x3260, 0x3240, 0x3340, 0x3360, 0x3320, 0x3330, 0x3310, 0x3710, 0x3730, 0x3720, 0x3760, 0x3740, 0x3540,
+    0x3560, 0x3520, 0x3530, 0x3510, 0x3110, 0x3130, 0x3120, 0x3160, 0x3140, 0x7140, 0x7160, 0x7120, 0x7130, 0x7110, 0x7510, 0x7530,
+    0x7520, 0x7560, 0x7540, 0x7740, 0x7760, 0x7720, 0x7730, 0x7710, 0x7310, 0x7330, 0x7320, 0x7360, 0x7340, 0x7240, 0x7260, 0x7220,
+    0x7230, 0x7210, 0x7610, 0x7630, 0x7620, 0x7660, 0x7640, 0x7440, 0x7460, 0x7420, 0x7430, 0x7410, 0x7010, 0x7030, 0x7020, 0x7060,
+    0x7040, 0x5040, 0x5060, 0x5020, 0x5030, 0x5010, 0x5410, 0x5430, 0x5420, 0x5460, 0x5440, 0x5640, 0x5660, 0x5620, 0x5630, 0x5610,
+    0x5210, 0x5230, 0x5220, 0x5260, 0x5240, 0x5340, 0x5360, 0x5320, 0x5330, 0x5310, 0x5710, 0x5730, 0x5720, 0x5760, 0x5740, 0x5540,
+    0x5560, 0x5520, 0x5530, 0x5510, 0x5110, 0x5130, 0x5120, 0x5160, 0x5140, 0x1140, 0x1160, 0x1120, 0x1130, 0x1110, 0x1510, 0x1530,
+    0x1520, 0x1560, 0x1540, 0x1740, 0x1760, 0x1720, 0x1730, 0x1710, 0x1310, 0x1330, 0x1320, 0x1360, 0x1340, 0x1240, 0x1260, 0x1220,
+    0x1230, 0x1210, 0x1610, 0x1630, 0x1620, 0x1660, 0x1640, 0x1440, 0x1460, 0x1420, 0x1430, 0x1410, 0x1010, 0x1030, 0x1020, 0x1060,
+    0x1040, 0x1044, 0x1064, 0x1024, 0x1034, 0x1014, 0x1414, 0x1434, 0x1424, 0x1464, 0x1444, 0x1644, 0x1664, 0x1624, 0x1634, 0x1614,
+    0x1214, 0x1234, 0x1224, 0x1264, 0x1244, 0x1344, 0x1364, 0x1324, 0x1334, 0x1314, 0x1714, 0x1734, 0x1724, 0x1764, 0x1744, 0x1544,
+    0x1564, 0x1524, 0x1534, 0x1514, 0x1114, 0x1134, 0x1124, 0x1164, 0x1144, 0x5144, 0x5164, 0x5124, 0x5134, 0x5114, 0x5514, 0x5534,
+    0x5524, 0x5564, 0x5544, 0x5744, 0x5764, 0x5724, 0x5734, 0x5714, 0x5314, 0x5334, 0x5324, 0x5364, 0x5344, 0x5244, 0x5264, 0x5224,
+    0x5234, 0x5214, 0x5614, 0x5634, 0x5624, 0x5664, 0x5644, 0x5444, 0x5464, 0x5424, 0x5434, 0x5414, 0x5014, 0x5034, 0x5024, 0x5064,
+    0x5044, 0x7044, 0x7064, 0x7024, 0x7034, 0x7014, 0x7414, 0x7434, 0x7424, 0x7464, 0x7444, 0x7644, 0x7664, 0x7624, 0x7634, 0x7614,
+    0x7214, 0x7234, 0x7224, 0x7264, 0x7244, 0x7344, 0x7364, 0x7324, 0x7334, 0x7314, 0x7714, 0x7734, 0x7724, 0x7764, 0x7744, 0x7544,
+    0x7564, 0x7524, 0x7534, 0x7514, 0x7114, 0x7134, 0x7124, 0x7164, 0x7144, 0x3144, 0x3164, 0x3124, 0x3134, 0x3114, 0x3514, 0x3534,
+    0x3524, 0x3564, 0x3544, 0x3744, 0x3764, 0x3724, 0x3734, 0x3714, 0x3314, 0x3334, 0x3324, 0x3364, 0x3344, 0x3244, 0x3264, 0x3224,
+    0x3234, 0x3214, 0x3614, 0x3634, 0x3624, 0x3664, 0x3644, 0x3444, 0x3464, 0x3424, 0x3434, 0x3414, 0x3014, 0x3034, 0x3024, 0x3064,
+    0x3044, 0x2044, 0x2064, 0x2024, 0x2034, 0x2014, 0x2414, 0x2434, 0x2424, 0x2464, 0x2444, 0x2644, 0x2664, 0x2624, 0x2634, 0x2614,
+    0x2214, 0x2234, 0x2224, 0x2264, 0x2244, 0x2344, 0x2364, 0x2324, 0x2334, 0x2314, 0x2714, 0x2734, 0x2724, 0x2764, 0x2744, 0x2544,
+    0x2564, 0x2524, 0x2534, 0x2514, 0x2114, 0x2134, 0x2124, 0x2164, 0x2144, 0x6144, 0x6164, 0x6124, 0x6134, 0x6114, 0x6514, 0x6534,
+    0x6524, 0x6564, 0x6544, 0x6744, 0x6764, 0x6724, 0x6734, 0x6714, 0x6314, 0x6334, 0x6324, 0x6364, 0x6344, 0x6244, 0x6264, 0x6224,
+    0x6234, 0x6214, 0x6614, 0x6634, 0x6624, 0x6664, 0x6644, 0x6444, 0x6464, 0x6424, 0x6434, 0x6414, 0x6014, 0x6034, 0x6024, 0x6064,
+    0x6044, 0x4044, 0x4064, 0x4024, 0x4034, 0x4014, 0x4414, 0x4434, 0x4424, 0x4464, 0x4444, 0x4644, 0x4664, 0x4624, 0x4634, 0x4614,
+    0x4214, 0x4234, 0x4224, 0x4264, 0x4244, 0x4344, 0x4364, 0x4324, 0x4334, 0x4314, 0x4714, 0x4734, 0x4724, 0x4764, 0x4744, 0x4544,
+    0x4564, 0x4524, 0x4534, 0x4514, 0x4114, 0x4134, 0x4124, 0x4164, 0x4144, 0x0144, 0x0164, 0x0124, 0x0134, 0x0114, 0x0514, 0x0534,
+    0x0524, 0x0564, 0x0544, 0x0744, 0x0764, 0x0724, 0x0734, 0x0714, 0x0314, 0x0334, 0x0324, 0x0364, 0x0344, 0x0244, 0x0264, 0x0224,
+    0x0234, 0x0214, 0x0614, 0x0634, 0x0624, 0x0664, 0x0644, 0x0444, 0x0464, 0x0424, 0x0434, 0x0414, 0x0014, 0x0034, 0x0024, 0x0064,
+    0x0044, 0x0046, 0x0066, 0x0026, 0x0036, 0x0016, 0x0416, 0x0436, 0x0426, 0x0466, 0x0446, 0x0646, 0x0666, 0x0626, 0x0636, 0x0616,
+    0x0216, 0x0236, 0x0226, 0x0266, 0x0246, 0x0346, 0x0366, 0x0326, 0x0336, 0x0316, 0x0716, 0x0736, 0x0726, 0x0766, 0x0746, 0x0546,
+    0x0566, 0x0526, 0x0536, 0x0516, 0x0116, 0x0136, 0x0126, 0x0166, 0x0146, 0x4146, 0x4166, 0x4126, 0x4136, 0x4116, 0x4516, 0x4536,
+    0x4526, 0x4566, 0x4546, 0x4746, 0x4766, 0x4726, 0x4736, 0x4716, 0x4316, 0x4336, 0x4326, 0x4366, 0x4346, 0x4246, 0x4266, 0x4226,
+    0x4236, 0x4216, 0x4616, 0x4636, 0x4626, 0x4666, 0x4646, 0x4446, 0x4466, 0x4426, 0x4436, 0x4416, 0x4016, 0x4036, 0x4026, 0x4066,
+    0x4046, 0x6046, 0x6066, 0x6026, 0x6036, 0x6016, 0x6416, 0x6436, 0x6426, 0x6466, 0x6446, 0x6646, 0x6666, 0x6626, 0x6636, 0x6616,
+    0x6216, 0x6236, 0x6226, 0x6266, 0x6246, 0x6346, 0x6366, 0x6326, 0x6336, 0x6316, 0x6716, 0x6736, 0x6726, 0x6766, 0x6746, 0x6546,
+    0x6566, 0x6526, 0x6536, 0x6516, 0x6116, 0x6136, 0x6126, 0x6166, 0x6146, 0x2146, 0x2166, 0x2126, 0x2136, 0x2116, 0x2516, 0x2536,
+    0x2526, 0x2566, 0x2546, 0x2746, 0x2766, 0x2726, 0x2736, 0x2716, 0x2316, 0x2336, 0x2326, 0x2366, 0x2346, 0x2246, 0x2266, 0x2226,
+    0x2236, 0x2216, 0x2616, 0x2636, 0x2626, 0x2666, 0x2646, 0x2446, 0x2466, 0x2426, 0x2436, 0x2416, 0x2016, 0x2036, 0x2026, 0x2066,
+    0x2046, 0x3046, 0x3066, 0x3026, 0x3036, 0x3016, 0x3416, 0x3436, 0x3426, 0x3466, 0x3446, 0x3646, 0x3666, 0x3626, 0x3636, 0x3616,
+    0x3216, 0x3236, 0x3226, 0x3266, 0x3246, 0x3346, 0x3366, 0x3326, 0x3336, 0x3316, 0x3716, 0x3736, 0x3726, 0x3766, 0x3746, 0x3546,
+    0x3566, 0x3526, 0x3536, 0x3516, 0x3116, 0x3136, 0x3126, 0x3166, 0x3146, 0x7146, 0x7166, 0x7126, 0x7136, 0x7116, 0x7516, 0x7536,
+    0x7526, 0x7566, 0x7546, 0x7746, 0x7766, 0x7726, 0x7736, 0x7716, 0x7316, 0x7336, 0x7326, 0x7366, 0x7346, 0x7246, 0x7266, 0x7226,
+    0x7236, 0x7216, 0x7616, 0x7636, 0x7626, 0x7666, 0x7646, 0x7446, 0x7466, 0x7426, 0x7436, 0x7416, 0x7016, 0x7036, 0x7026, 0x7066,
+    0x7046, 0x5046, 0x5066, 0x5026, 0x5036, 0x5016, 0x5416, 0x5436, 0x5426, 0x5466, 0x5446, 0x5646, 0x5666, 0x5626, 0x5636, 0x5616,
+    0x5216, 0x5236, 0x5226, 0x5266, 0x5246, 0x5346, 0x5366, 0x5326, 0x5336, 0x5316, 0x5716, 0x5736, 0x5726, 0x5766, 0x5746, 0x5546,
+    0x5566, 0x5526, 0x5536, 0x5516, 0x5116, 0x5136, 0x5126, 0x5166, 0x5146, 0x1146, 0x1166, 0x1126, 0x1136, 0x1116, 0x1516, 0x1536,
+    0x1526, 0x1566, 0x1546, 0x1746, 0x1766, 0x1726, 0x1736, 0x1716, 0x1316, 0x1336, 0x1326, 0x1366, 0x1346, 0x1246, 0x1266, 0x1226,
+    0x1236, 0x1216, 0x1616, 0x1636, 0x1626, 0x1666, 0x1646, 0x1446, 0x1466, 0x1426, 0x1436, 0x1416, 0x1016, 0x1036, 0x1026, 0x1066,
+    0x1046, 0x1042, 0x1062, 0x1022, 0x1032, 0x1012, 0x1412, 0x1432, 0x1422, 0x1462, 0x1442, 0x1642, 0x1662, 0x1622, 0x1632, 0x1612,
+    0x1212, 0x1232, 0x1222, 0x1262, 0x1242, 0x1342, 0x1362, 0x1322, 0x1332, 0x1312, 0x1712, 0x1732, 0x1722, 0x1762, 0x1742, 0x1542,
+    0x1562, 0x1522, 0x1532, 0x1512, 0x1112, 0x1132, 0x1122, 0x1162, 0x1142, 0x5142, 0x5162, 0x5122, 0x5132, 0x5112, 0x5512, 0x5532,
+    0x5522, 0x5562, 0x5542, 0x5742, 0x5762, 0x5722, 0x5732, 0x5712, 0x5312, 0x5332, 0x5322, 0x5362, 0x5342, 0x5242, 0x5262, 0x5222,
+    0x5232, 0x5212, 0x5612, 0x5632, 0x5622, 0x5662, 0x5642, 0x5442, 0x5462, 0x5422, 0x5432, 0x5412, 0x5012, 0x5032, 0x5022, 0x5062,
+    0x5042, 0x7042, 0x7062, 0x7022, 0x7032, 0x7012, 0x7412, 0x7432, 0x7422, 0x7462, 0x7442, 0x7642, 0x7662, 0x7622, 0x7632, 0x7612,
+    0x7212, 0x7232, 0x7222, 0x7262, 0x7242, 0x7342, 0x7362, 0x7322, 0x7332, 0x7312, 0x7712, 0x7732, 0x7722, 0x7762, 0x7742, 0x7542,
+    0x7562, 0x7522, 0x7532, 0x7512, 0x7112, 0x7132, 0x7122, 0x7162, 0x7142, 0x3142, 0x3162, 0x3122, 0x3132, 0x3112, 0x3512, 0x3532,
+    0x3522, 0x3562, 0x3542, 0x3742, 0x3762, 0x3722, 0x3732, 0x3712, 0x3312, 0x3332, 0x3322, 0x3362, 0x3342, 0x3242, 0x3262, 0x3222,
+    0x3232, 0x3212, 0x3612, 0x3632, 0x3622, 0x3662, 0x3642, 0x3442, 0x3462, 0x3422, 0x3432, 0x3412, 0x3012, 0x3032, 0x3022, 0x3062,
+    0x3042, 0x2042, 0x2062, 0x2022, 0x2032, 0x2012, 0x2412, 0x2432, 0x2422, 0x2462, 0x2442, 0x2642, 0x2662, 0x2622, 0x2632, 0x2612,
+    0x2212, 0x2232, 0x2222, 0x2262, 0x2242, 0x2342, 0x2362, 0x2322, 0x2332, 0x2312, 0x2712, 0x2732, 0x2722, 0x2762, 0x2742, 0x2542,
+    0x2562, 0x2522, 0x2532, 0x2512, 0x2112, 0x2132, 0x2122, 0x2162, 0x2142, 0x6142, 0x6162, 0x6122, 0x6132, 0x6112, 0x6512, 0x6532,
+    0x6522, 0x6562, 0x6542, 0x6742, 0x6762, 0x6722, 0x6732, 0x6712, 0x6312, 0x6332, 0x6322, 0x6362, 0x6342, 0x6242, 0x6262, 0x6222,
+    0x6232, 0x6212, 0x6612, 0x6632, 0x6622, 0x6662, 0x6642, 0x6442, 0x6462, 0x6422, 0x6432, 0x6412, 0x6012, 0x6032, 0x6022, 0x6062,
+    0x6042, 0x4042, 0x4062, 0x4022, 0x4032, 0x4012, 0x4412, 0x4432, 0x4422, 0x4462, 0x4442, 0x4642, 0x4662, 0x4622, 0x4632, 0x4612,
+    0x4212, 0x4232, 0x4222, 0x4262, 0x4242, 0x4342, 0x4362, 0x4322, 0x4332, 0x4312, 0x4712, 0x4732, 0x4722, 0x4762, 0x4742, 0x4542,
+    0x4562, 0x4522, 0x4532, 0x4512, 0x4112, 0x4132, 0x4122, 0x4162, 0x4142, 0x0142, 0x0162, 0x0122, 0x0132, 0x0112, 0x0512, 0x0532,
+    0x0522, 0x0562, 0x0542, 0x0742, 0x0762, 0x0722, 0x0732, 0x0712, 0x0312, 0x0332, 0x0322, 0x0362, 0x0342, 0x0242, 0x0262, 0x0222,
+    0x0232, 0x0212, 0x0612, 0x0632, 0x0622, 0x0662, 0x0642, 0x0442, 0x0462, 0x0422, 0x0432, 0x0412, 0x0012, 0x0032, 0x0022, 0x0062,
+    0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
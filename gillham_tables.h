@@ -0,0 +1,96 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// gillham_tables.h: Gillham / identity decoding lookup tables
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GILLHAM_TABLES_H
+#define GILLHAM_TABLES_H
+
+// The tables are generated by tools/gillham-tables.py into gillham_tables.c;
+// gillhamtests checks them against the bit-by-bit decoders.
+
+extern const uint16_t gillham_squawk[4096];
+extern const int32_t gillham_altitude[4096];
+extern const int16_t gillham_mode_a_to_c[4096];
+extern const uint16_t gillham_mode_c_to_a[4096];
+
+// Convert a 13-bit ID13 / AC13 field to a 12-bit table index by removing
+// the X / M bit (bit 6), which is not part of the Gillham code
+static inline unsigned gillhamIndex(unsigned field13)
+{
+    return ((field13 & 0x1F80) >> 1) | (field13 & 0x003F);
+}
+
+// In the squawk (identity) field bits are interleaved as follows in
+// (message bit 20 to bit 32):
+//
+// C1-A1-C2-A2-C4-A4-ZERO-B1-D1-B2-D2-B4-D4
+//
+// So every group of three bits A, B, C, D represent an integer from 0 to 7.
+//
+// The actual meaning is just 4 octal numbers, but we convert it into a hex
+// number tha happens to represent the four octal numbers.
+//
+// For more info: http://en.wikipedia.org/wiki/Gillham_code
+//
+static inline int decodeID13Field(int ID13Field)
+{
+    return gillham_squawk[gillhamIndex(ID13Field)];
+}
+
+// Decode the 13 bit AC altitude field (in DF 20 and others).
+// Returns the altitude, and set 'unit' to either UNIT_METERS or UNIT_FEET.
+static inline int decodeAC13Field(int AC13Field, altitude_unit_t *unit)
+{
+    if (AC13Field & 0x0040) {
+        *unit = UNIT_METERS;
+        // TODO: Implement altitude when meter unit is selected
+        return INVALID_ALTITUDE;
+    }
+
+    *unit = UNIT_FEET;
+    return gillham_altitude[gillhamIndex(AC13Field)];
+}
+
+// Decode the 12 bit AC altitude field (in DF 17 and others). This is the
+// AC13 field without the M bit, so it indexes the same table directly.
+static inline int decodeAC12Field(int AC12Field, altitude_unit_t *unit)
+{
+    *unit = UNIT_FEET;
+    return gillham_altitude[AC12Field & 0x0FFF];
+}
+
+// Given a mode A value (hex-encoded, 00:A4:A2:A1:00:B4:B2:B1:00:C4:C2:C1:00:D4:D2:D1)
+// return the mode C value (signed multiple of 100s of feet)
+// or INVALID_ALITITUDE if not a valid mode C value
+static inline int modeAToModeC(unsigned modeA)
+{
+    return gillham_mode_a_to_c[modeAToIndex(modeA)];
+}
+
+// Given a mode C value (signed multiple of 100s of feet)
+// return the mode A value, or 0 if not a valid mode C value
+static inline unsigned modeCToModeA(int modeC)
+{
+    modeC += 13;
+    if (modeC < 0 || modeC >= 4096)
+        return 0;
+
+    return gillham_mode_c_to_a[modeC];
+}
+
+#endif
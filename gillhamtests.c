@@ -0,0 +1,243 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// gillhamtests.c - tests for the Gillham / identity lookup tables
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+// The table-driven decoders are checked exhaustively against the original
+// bit-by-bit decoders, reproduced here.
+
+static int referenceID13Field(int ID13Field) {
+    int hexGillham = 0;
+
+    if (ID13Field & 0x1000) {hexGillham |= 0x0010;} // Bit 12 = C1
+    if (ID13Field & 0x0800) {hexGillham |= 0x1000;} // Bit 11 = A1
+    if (ID13Field & 0x0400) {hexGillham |= 0x0020;} // Bit 10 = C2
+    if (ID13Field & 0x0200) {hexGillham |= 0x2000;} // Bit  9 = A2
+    if (ID13Field & 0x0100) {hexGillham |= 0x0040;} // Bit  8 = C4
+    if (ID13Field & 0x0080) {hexGillham |= 0x4000;} // Bit  7 = A4
+  //if (ID13Field & 0x0040) {hexGillham |= 0x0800;} // Bit  6 = X  or M
+    if (ID13Field & 0x0020) {hexGillham |= 0x0100;} // Bit  5 = B1
+    if (ID13Field & 0x0010) {hexGillham |= 0x0001;} // Bit  4 = D1 or Q
+    if (ID13Field & 0x0008) {hexGillham |= 0x0200;} // Bit  3 = B2
+    if (ID13Field & 0x0004) {hexGillham |= 0x0002;} // Bit  2 = D2
+    if (ID13Field & 0x0002) {hexGillham |= 0x0400;} // Bit  1 = B4
+    if (ID13Field & 0x0001) {hexGillham |= 0x0004;} // Bit  0 = D4
+
+    return (hexGillham);
+}
+
+static int referenceModeAToModeC(unsigned int ModeA)
+{
+    unsigned int FiveHundreds = 0;
+    unsigned int OneHundreds  = 0;
+
+  if ((ModeA & 0xFFFF8889) != 0 ||         // check zero bits are zero, D1 set is illegal
+      (ModeA & 0x000000F0) == 0) { // C1,,C4 cannot be Zero
+      return INVALID_ALTITUDE;
+  }
+
+  if (ModeA & 0x0010) {OneHundreds ^= 0x007;} // C1
+  if (ModeA & 0x0020) {OneHundreds ^= 0x003;} // C2
+  if (ModeA & 0x0040) {OneHundreds ^= 0x001;} // C4
+
+  // Remove 7s from OneHundreds (Make 7->5, snd 5->7).
+  if ((OneHundreds & 5) == 5) {OneHundreds ^= 2;}
+
+  // Check for invalid codes, only 1 to 5 are valid
+  if (OneHundreds > 5) {
+      return INVALID_ALTITUDE;
+  }
+
+//if (ModeA & 0x0001) {FiveHundreds ^= 0x1FF;} // D1 never used for altitude
+  if (ModeA & 0x0002) {FiveHundreds ^= 0x0FF;} // D2
+  if (ModeA & 0x0004) {FiveHundreds ^= 0x07F;} // D4
+
+  if (ModeA & 0x1000) {FiveHundreds ^= 0x03F;} // A1
+  if (ModeA & 0x2000) {FiveHundreds ^= 0x01F;} // A2
+  if (ModeA & 0x4000) {FiveHundreds ^= 0x00F;} // A4
+
+  if (ModeA & 0x0100) {FiveHundreds ^= 0x007;} // B1
+  if (ModeA & 0x0200) {FiveHundreds ^= 0x003;} // B2
+  if (ModeA & 0x0400) {FiveHundreds ^= 0x001;} // B4
+
+  // Correct order of OneHundreds.
+  if (FiveHundreds & 1) {OneHundreds = 6 - OneHundreds;}
+
+  return ((FiveHundreds * 5) + OneHundreds - 13);
+}
+
+static int referenceAC13Field(int AC13Field, altitude_unit_t *unit) {
+    int m_bit  = AC13Field & 0x0040; // set = meters, clear = feet
+    int q_bit  = AC13Field & 0x0010; // set = 25 ft encoding, clear = Gillham Mode C encoding
+
+    if (!m_bit) {
+        *unit = UNIT_FEET;
+        if (q_bit) {
+            // N is the 11 bit integer resulting from the removal of bit Q and M
+            int n = ((AC13Field & 0x1F80) >> 2) |
+                    ((AC13Field & 0x0020) >> 1) |
+                     (AC13Field & 0x000F);
+            // The final altitude is resulting number multiplied by 25, minus 1000.
+            return ((n * 25) - 1000);
+        } else {
+            // N is an 11 bit Gillham coded altitude
+            int n = referenceModeAToModeC(referenceID13Field(AC13Field) & 0x7777);
+            if (n < -12) {
+                return INVALID_ALTITUDE;
+            }
+
+            return (100 * n);
+        }
+    } else {
+        *unit = UNIT_METERS;
+        // TODO: Implement altitude when meter unit is selected
+        return INVALID_ALTITUDE;
+    }
+}
+
+static int referenceAC12Field(int AC12Field, altitude_unit_t *unit) {
+    int q_bit  = AC12Field & 0x10; // Bit 48 = Q
+
+    *unit = UNIT_FEET;
+    if (q_bit) {
+        /// N is the 11 bit integer resulting from the removal of bit Q at bit 4
+        int n = ((AC12Field & 0x0FE0) >> 1) |
+                 (AC12Field & 0x000F);
+        // The final altitude is the resulting number multiplied by 25, minus 1000.
+        return ((n * 25) - 1000);
+    } else {
+        // Make N a 13 bit Gillham coded altitude by inserting M=0 at bit 6
+        int n = ((AC12Field & 0x0FC0) << 1) |
+                 (AC12Field & 0x003F);
+        n = referenceModeAToModeC(referenceID13Field(n) & 0x7777);
+        if (n < -12) {
+            return INVALID_ALTITUDE;
+        }
+
+        return (100 * n);
+    }
+}
+
+static int testID13() {
+    int ok = 1;
+    for (int field = 0; field < 8192; ++field) {
+        int expected = referenceID13Field(field);
+        int got = decodeID13Field(field);
+        if (got != expected) {
+            fprintf(stderr, "testID13:     FAIL: decodeID13Field(0x%04x) = 0x%04x (expected 0x%04x)\n",
+                    (unsigned) field, (unsigned) got, (unsigned) expected);
+            ok = 0;
+        }
+    }
+    if (ok)
+        fprintf(stderr, "testID13:     PASS (all 8192 values)\n");
+    return ok;
+}
+
+static int testAC13() {
+    int ok = 1;
+    for (int field = 0; field < 8192; ++field) {
+        altitude_unit_t expectedUnit = UNIT_FEET, gotUnit = UNIT_FEET;
+        int expected = referenceAC13Field(field, &expectedUnit);
+        int got = decodeAC13Field(field, &gotUnit);
+        if (got != expected || gotUnit != expectedUnit) {
+            fprintf(stderr, "testAC13:     FAIL: decodeAC13Field(0x%04x) = %d/%d (expected %d/%d)\n",
+                    (unsigned) field, got, (int) gotUnit, expected, (int) expectedUnit);
+            ok = 0;
+        }
+    }
+    if (ok)
+        fprintf(stderr, "testAC13:     PASS (all 8192 values)\n");
+    return ok;
+}
+
+static int testAC12() {
+    int ok = 1;
+    for (int field = 0; field < 4096; ++field) {
+        altitude_unit_t expectedUnit = UNIT_METERS, gotUnit = UNIT_METERS;
+        int expected = referenceAC12Field(field, &expectedUnit);
+        int got = decodeAC12Field(field, &gotUnit);
+        if (got != expected || gotUnit != expectedUnit) {
+            fprintf(stderr, "testAC12:     FAIL: decodeAC12Field(0x%03x) = %d/%d (expected %d/%d)\n",
+                    (unsigned) field, got, (int) gotUnit, expected, (int) expectedUnit);
+            ok = 0;
+        }
+    }
+    if (ok)
+        fprintf(stderr, "testAC12:     PASS (all 4096 values)\n");
+    return ok;
+}
+
+// Mode A values outside the 12 octal digit bits are masked off by
+// modeAToIndex() before the lookup, as they always have been
+static int testModeAToModeC() {
+    int ok = 1;
+    for (unsigned modeA = 0; modeA < 65536; ++modeA) {
+        int expected = referenceModeAToModeC(modeA & 0x7777);
+        int got = modeAToModeC(modeA);
+        if (got != expected) {
+            fprintf(stderr, "testModeAToC: FAIL: modeAToModeC(0x%04x) = %d (expected %d)\n", modeA, got, expected);
+            ok = 0;
+        }
+    }
+    if (ok)
+        fprintf(stderr, "testModeAToC: PASS (all 65536 values)\n");
+    return ok;
+}
+
+static int testModeCToModeA() {
+    int ok = 1;
+    unsigned found = 0;
+    for (int modeC = -20; modeC < 4200; ++modeC) {
+        unsigned modeA = modeCToModeA(modeC);
+        if (modeA == 0)
+            continue;
+        ++found;
+        if (referenceModeAToModeC(modeA) != modeC) {
+            fprintf(stderr, "testModeCToA: FAIL: modeCToModeA(%d) = 0x%04x, which is Mode C %d\n",
+                    modeC, modeA, referenceModeAToModeC(modeA));
+            ok = 0;
+        }
+    }
+
+    // every valid Mode C value must map back
+    unsigned valid = 0;
+    for (unsigned i = 0; i < 4096; ++i) {
+        if (referenceModeAToModeC(indexToModeA(i)) != INVALID_ALTITUDE)
+            ++valid;
+    }
+    if (found != valid) {
+        fprintf(stderr, "testModeCToA: FAIL: %u Mode C values map to a Mode A value (expected %u)\n", found, valid);
+        ok = 0;
+    }
+
+    if (ok)
+        fprintf(stderr, "testModeCToA: PASS (%u Mode C values)\n", found);
+    return ok;
+}
+
+int main(int __attribute__ ((unused)) argc, char __attribute__ ((unused)) **argv) {
+    int ok = 1;
+    ok = testID13() && ok;
+    ok = testAC13() && ok;
+    ok = testAC12() && ok;
+    ok = testModeAToModeC() && ok;
+    ok = testModeCToModeA() && ok;
+    return ok ? 0 : 1;
+}
@@ -31,9 +31,15 @@
 
 // Maintain two tables and switch between them to age out entries.
 
-static uint32_t icao_filter_a[ICAO_FILTER_SIZE];
-static uint32_t icao_filter_b[ICAO_FILTER_SIZE];
-static uint32_t *icao_filter_active;
+// Entries may be tested concurrently by demodulator threads, and with
+// --io-thread they are added by both the demodulator thread and the I/O
+// thread (for network input), so they are accessed atomically (relaxed
+// ordering is enough, a stale answer is harmless) and new entries are
+// claimed with compare-and-swap.
+
+static atomic_uint icao_filter_a[ICAO_FILTER_SIZE];
+static atomic_uint icao_filter_b[ICAO_FILTER_SIZE];
+static _Atomic(atomic_uint *) icao_filter_active;
 
 #define EMPTY 0xFFFFFFFF
 
@@ -61,51 +67,59 @@ static uint32_t icaoHash(uint32_t a)
     return hash & (ICAO_FILTER_SIZE-1);
 }
 
+static inline uint32_t icaoFilterGet(atomic_uint *table, uint32_t h)
+{
+    return atomic_load_explicit(&table[h], memory_order_relaxed);
+}
+
+static void icaoFilterClear(atomic_uint *table)
+{
+    for (unsigned h = 0; h < ICAO_FILTER_SIZE; ++h)
+        atomic_store_explicit(&table[h], EMPTY, memory_order_relaxed);
+}
+
 void icaoFilterInit()
 {
-    memset(icao_filter_a, 0xFF, sizeof(icao_filter_a));
-    memset(icao_filter_b, 0xFF, sizeof(icao_filter_b));
-    icao_filter_active = icao_filter_a;
+    icaoFilterClear(icao_filter_a);
+    icaoFilterClear(icao_filter_b);
+    atomic_store_explicit(&icao_filter_active, icao_filter_a, memory_order_relaxed);
 }
 
 void icaoFilterAdd(uint32_t addr)
 {
+    atomic_uint *table = atomic_load_explicit(&icao_filter_active, memory_order_relaxed);
     uint32_t h, h0;
     h0 = h = icaoHash(addr);
-    while (icao_filter_active[h] != EMPTY && icao_filter_active[h] != addr) {
+    for (;;) {
+        uint32_t entry = icaoFilterGet(table, h);
+        if (entry == EMPTY && atomic_compare_exchange_strong_explicit(&table[h], &entry, addr, memory_order_relaxed, memory_order_relaxed))
+            return; // claimed an empty slot
+        if (entry == addr)
+            return; // already present (possibly added concurrently)
+
         h = (h+1) & (ICAO_FILTER_SIZE-1);
         if (h == h0) {
             fprintf(stderr, "ICAO hash table full, increase ICAO_FILTER_SIZE\n");
             return;
         }
     }
-    if (icao_filter_active[h] == EMPTY)
-        icao_filter_active[h] = addr;
 }
 
-int icaoFilterTest(uint32_t addr)
+static int icaoFilterTestTable(atomic_uint *table, uint32_t addr, uint32_t h0)
 {
-    uint32_t h, h0;
-
-    h0 = h = icaoHash(addr);
-    while (icao_filter_a[h] != EMPTY && icao_filter_a[h] != addr) {
-        h = (h+1) & (ICAO_FILTER_SIZE-1);
-        if (h == h0)
-            break;
-    }
-    if (icao_filter_a[h] == addr)
-        return 1;
-
-    h = h0;
-    while (icao_filter_b[h] != EMPTY && icao_filter_b[h] != addr) {
+    uint32_t h = h0, entry;
+    while ((entry = icaoFilterGet(table, h)) != EMPTY && entry != addr) {
         h = (h+1) & (ICAO_FILTER_SIZE-1);
         if (h == h0)
             break;
     }
-    if (icao_filter_b[h] == addr)
-        return 1;
+    return (entry == addr);
+}
 
-    return 0;
+int icaoFilterTest(uint32_t addr)
+{
+    uint32_t h0 = icaoHash(addr);
+    return icaoFilterTestTable(icao_filter_a, addr, h0) || icaoFilterTestTable(icao_filter_b, addr, h0);
 }
 
 // call this periodically:
@@ -115,12 +129,12 @@ void icaoFilterExpire()
     uint64_t now = mstime();
 
     if (now >= next_flip) {
-        if (icao_filter_active == icao_filter_a) {
-            memset(icao_filter_b, 0xFF, sizeof(icao_filter_b));
-            icao_filter_active = icao_filter_b;
+        if (atomic_load_explicit(&icao_filter_active, memory_order_relaxed) == icao_filter_a) {
+            icaoFilterClear(icao_filter_b);
+            atomic_store_explicit(&icao_filter_active, icao_filter_b, memory_order_relaxed);
         } else {
-            memset(icao_filter_a, 0xFF, sizeof(icao_filter_a));
-            icao_filter_active = icao_filter_a;
+            icaoFilterClear(icao_filter_a);
+            atomic_store_explicit(&icao_filter_active, icao_filter_a, memory_order_relaxed);
         }
         next_flip = now + MODES_ICAO_FILTER_TTL;
     }
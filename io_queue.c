@@ -0,0 +1,137 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// io_queue.c: Demodulator to I/O thread message queue
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+// The ring is indexed by free-running head/tail counters: the consumer owns
+// queue_head, the producer owns queue_tail, and each only reads the other's.
+// The mutex and condition variable are used only to put an idle consumer to
+// sleep; the producer touches them only when queue_sleeping is set.
+
+static struct modesMessage *queue_ring;       // ring of queued messages
+static unsigned queue_mask;                   // ring size - 1 (ring size is a power of two)
+static atomic_uint queue_head;                // index of the next message to get
+static atomic_uint queue_tail;                // index of the next message to put
+static atomic_bool queue_sleeping;            // true if the consumer is (about to be) waiting on queue_cond
+static atomic_bool queue_halted;              // true if the queue has been halted
+
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;   // mutex used with queue_cond
+static pthread_cond_t queue_cond = PTHREAD_COND_INITIALIZER;      // condition used to signal queue-not-empty
+
+bool io_queue_create(unsigned size)
+{
+    unsigned ring_size = 1;
+    while (ring_size < size)
+        ring_size <<= 1;
+
+    if (!(queue_ring = calloc(ring_size, sizeof(queue_ring[0])))) {
+        fprintf(stderr, "io_queue_create: out of memory\n");
+        return false;
+    }
+
+    queue_mask = ring_size - 1;
+    atomic_init(&queue_head, 0);
+    atomic_init(&queue_tail, 0);
+    atomic_init(&queue_sleeping, false);
+    atomic_init(&queue_halted, false);
+    return true;
+}
+
+void io_queue_destroy()
+{
+    free(queue_ring);
+    queue_ring = NULL;
+}
+
+bool io_queue_put(const struct modesMessage *mm, bool wait)
+{
+    unsigned tail = atomic_load_explicit(&queue_tail, memory_order_relaxed);
+
+    while (tail - atomic_load_explicit(&queue_head, memory_order_acquire) > queue_mask) {
+        // Full. This is only expected to happen persistently when reading
+        // from a file faster than realtime, so a simple poll is enough.
+        if (!wait || atomic_load(&queue_halted))
+            return false;
+
+        struct timespec slp = { 0, 1 * 1000 * 1000 };
+        nanosleep(&slp, NULL);
+    }
+
+    queue_ring[tail & queue_mask] = *mm;
+    atomic_store(&queue_tail, tail + 1);
+
+    // Pairs with the store to queue_sleeping in io_queue_wait: either the
+    // consumer sees the new tail before sleeping, or we see that it is
+    // sleeping and wake it.
+    if (atomic_load(&queue_sleeping)) {
+        pthread_mutex_lock(&queue_mutex);
+        pthread_cond_signal(&queue_cond);
+        pthread_mutex_unlock(&queue_mutex);
+    }
+
+    return true;
+}
+
+bool io_queue_get(struct modesMessage *mm)
+{
+    unsigned head = atomic_load_explicit(&queue_head, memory_order_relaxed);
+    if (head == atomic_load_explicit(&queue_tail, memory_order_acquire))
+        return false;
+
+    *mm = queue_ring[head & queue_mask];
+    atomic_store_explicit(&queue_head, head + 1, memory_order_release);
+    return true;
+}
+
+bool io_queue_wait(uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    get_deadline(timeout_ms, &deadline);
+
+    pthread_mutex_lock(&queue_mutex);
+    atomic_store(&queue_sleeping, true);
+
+    bool ready;
+    while (!(ready = (atomic_load(&queue_head) != atomic_load(&queue_tail))) && !atomic_load(&queue_halted)) {
+        int err = pthread_cond_timedwait(&queue_cond, &queue_mutex, &deadline);
+        if (err) {
+            if (err != ETIMEDOUT) {
+                fprintf(stderr, "io_queue_wait: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
+            }
+            break; // done waiting
+        }
+    }
+
+    atomic_store(&queue_sleeping, false);
+    pthread_mutex_unlock(&queue_mutex);
+    return ready || atomic_load(&queue_head) != atomic_load(&queue_tail);
+}
+
+void io_queue_halt()
+{
+    pthread_mutex_lock(&queue_mutex);
+    atomic_store(&queue_halted, true);
+    pthread_cond_broadcast(&queue_cond);
+    pthread_mutex_unlock(&queue_mutex);
+}
+
+bool io_queue_halted()
+{
+    return atomic_load(&queue_halted);
+}
@@ -0,0 +1,58 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// io_queue.h: Demodulator to I/O thread message queue
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef IO_QUEUE_H
+#define IO_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct modesMessage;
+
+// Single-producer, single-consumer queue of decoded messages. The
+// demodulator thread is the only producer, the I/O thread is the only
+// consumer; neither side takes a lock unless the consumer is asleep.
+
+// Create the queue with space for "size" messages (rounded up to a power of
+// two). Not threadsafe. Returns true on success.
+bool io_queue_create(unsigned size);
+
+// Free the queue. Not threadsafe.
+void io_queue_destroy();
+
+// Producer: copy a message onto the queue. If the queue is full and "wait"
+// is false, return false immediately; otherwise wait for space (or for
+// io_queue_halt()). Returns true if the message was queued.
+bool io_queue_put(const struct modesMessage *mm, bool wait);
+
+// Consumer: copy the oldest message off the queue into *mm.
+// Returns false if the queue is empty.
+bool io_queue_get(struct modesMessage *mm);
+
+// Consumer: wait up to timeout_ms for the queue to be non-empty.
+// Returns true if there is something to get.
+bool io_queue_wait(uint32_t timeout_ms);
+
+// Wake up any waiters and make io_queue_put() stop waiting for space.
+void io_queue_halt();
+
+// True if io_queue_halt() has been called.
+bool io_queue_halted();
+
+#endif
@@ -54,6 +54,8 @@
 
 /* for PRIX64 */
 #include <inttypes.h>
+/* for offsetof */
+#include <stddef.h>
 
 //
 // ===================== Mode S detection and decoding  ===================
@@ -81,100 +83,9 @@ int modesMessageLenByType(int type) {
 //
 //=========================================================================
 //
-// In the squawk (identity) field bits are interleaved as follows in
-// (message bit 20 to bit 32):
+// The ID13, AC13 and AC12 fields are decoded by table lookup,
+// see gillham_tables.h
 //
-// C1-A1-C2-A2-C4-A4-ZERO-B1-D1-B2-D2-B4-D4
-//
-// So every group of three bits A, B, C, D represent an integer from 0 to 7.
-//
-// The actual meaning is just 4 octal numbers, but we convert it into a hex
-// number tha happens to represent the four octal numbers.
-//
-// For more info: http://en.wikipedia.org/wiki/Gillham_code
-//
-static int decodeID13Field(int ID13Field) {
-    int hexGillham = 0;
-
-    if (ID13Field & 0x1000) {hexGillham |= 0x0010;} // Bit 12 = C1
-    if (ID13Field & 0x0800) {hexGillham |= 0x1000;} // Bit 11 = A1
-    if (ID13Field & 0x0400) {hexGillham |= 0x0020;} // Bit 10 = C2
-    if (ID13Field & 0x0200) {hexGillham |= 0x2000;} // Bit  9 = A2
-    if (ID13Field & 0x0100) {hexGillham |= 0x0040;} // Bit  8 = C4
-    if (ID13Field & 0x0080) {hexGillham |= 0x4000;} // Bit  7 = A4
-  //if (ID13Field & 0x0040) {hexGillham |= 0x0800;} // Bit  6 = X  or M
-    if (ID13Field & 0x0020) {hexGillham |= 0x0100;} // Bit  5 = B1
-    if (ID13Field & 0x0010) {hexGillham |= 0x0001;} // Bit  4 = D1 or Q
-    if (ID13Field & 0x0008) {hexGillham |= 0x0200;} // Bit  3 = B2
-    if (ID13Field & 0x0004) {hexGillham |= 0x0002;} // Bit  2 = D2
-    if (ID13Field & 0x0002) {hexGillham |= 0x0400;} // Bit  1 = B4
-    if (ID13Field & 0x0001) {hexGillham |= 0x0004;} // Bit  0 = D4
-
-    return (hexGillham);
-}
-
-//
-//=========================================================================
-//
-// Decode the 13 bit AC altitude field (in DF 20 and others).
-// Returns the altitude, and set 'unit' to either UNIT_METERS or UNIT_FEET.
-//
-static int decodeAC13Field(int AC13Field, altitude_unit_t *unit) {
-    int m_bit  = AC13Field & 0x0040; // set = meters, clear = feet
-    int q_bit  = AC13Field & 0x0010; // set = 25 ft encoding, clear = Gillham Mode C encoding
-
-    if (!m_bit) {
-        *unit = UNIT_FEET;
-        if (q_bit) {
-            // N is the 11 bit integer resulting from the removal of bit Q and M
-            int n = ((AC13Field & 0x1F80) >> 2) |
-                    ((AC13Field & 0x0020) >> 1) |
-                     (AC13Field & 0x000F);
-            // The final altitude is resulting number multiplied by 25, minus 1000.
-            return ((n * 25) - 1000);
-        } else {
-            // N is an 11 bit Gillham coded altitude
-            int n = modeAToModeC(decodeID13Field(AC13Field));
-            if (n < -12) {
-                return INVALID_ALTITUDE;
-            }
-
-            return (100 * n);
-        }
-    } else {
-        *unit = UNIT_METERS;
-        // TODO: Implement altitude when meter unit is selected
-        return INVALID_ALTITUDE;
-    }
-}
-
-//
-//=========================================================================
-//
-// Decode the 12 bit AC altitude field (in DF 17 and others).
-//
-static int decodeAC12Field(int AC12Field, altitude_unit_t *unit) {
-    int q_bit  = AC12Field & 0x10; // Bit 48 = Q
-
-    *unit = UNIT_FEET;
-    if (q_bit) {
-        /// N is the 11 bit integer resulting from the removal of bit Q at bit 4
-        int n = ((AC12Field & 0x0FE0) >> 1) |
-                 (AC12Field & 0x000F);
-        // The final altitude is the resulting number multiplied by 25, minus 1000.
-        return ((n * 25) - 1000);
-    } else {
-        // Make N a 13 bit Gillham coded altitude by inserting M=0 at bit 6
-        int n = ((AC12Field & 0x0FC0) << 1) |
-                 (AC12Field & 0x003F);
-        n = modeAToModeC(decodeID13Field(n));
-        if (n < -12) {
-            return INVALID_ALTITUDE;
-        }
-
-        return (100 * n);
-    }
-}
 
 //
 //=========================================================================
@@ -247,9 +158,10 @@ static bool isShortPIMessage(const unsigned char *msg)
     return (df == 11); // assume IID==0
 }
 
-#define UNCHECKED_SYNDROME 0xFFFFFFFFU
-
-static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t *short_syndrome, uint32_t *long_syndrome)
+// Try to correct a message to a valid DF11/17/18. Fills in ctx->corrected
+// (the message after any correction), the syndromes it computed, the
+// correction applied, and the number of CRC computations made.
+static void correctMessage(const unsigned char *in, struct score_context *ctx)
 {
     // Possible DF values of the first byte of a message that could be a valid DF11/17/18
     // message after correction. See tools/df-correction-arrays.py for generator code.
@@ -264,8 +176,15 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         0x00060000, 0x066f0006, 0x6fff066f
     };
 
+    unsigned char *out = ctx->corrected;
+    uint32_t *short_syndrome = &ctx->short_syndrome;
+    uint32_t *long_syndrome = &ctx->long_syndrome;
+
     *short_syndrome = UNCHECKED_SYNDROME;
     *long_syndrome = UNCHECKED_SYNDROME;
+    ctx->ei = NULL;
+    ctx->crc_ops = 0;
+    ctx->corrections = -1;
 
     // Try to correct, including corrections to the initial 5 bit DF field
     // that determines message format
@@ -278,26 +197,43 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
     // (DF17 could be corrected to DF18 or vice versa), but it does disable the CPU hungry part of it.
     const unsigned fix_df_bits = (Modes.fix_df ? Modes.nfix_crc : 0);
 
+    const bool try_long = (df_correctable_long[fix_df_bits] & df_bit) != 0;
+    const bool try_short = (df_correctable_short[fix_df_bits] & df_bit) != 0;
+
+    if (try_long && try_short) {
+        // The short message is a prefix of the long one, so get both syndromes from one pass
+        modesChecksumBoth(in, short_syndrome, long_syndrome);
+        ctx->crc_ops += 2;
+    }
+
     struct errorinfo *long_ei = NULL;
-    if (df_correctable_long[fix_df_bits] & df_bit) {
-        *long_syndrome = modesChecksum(in, MODES_LONG_MSG_BITS);
+    if (try_long) {
+        if (*long_syndrome == UNCHECKED_SYNDROME) {
+            *long_syndrome = modesChecksum(in, MODES_LONG_MSG_BITS);
+            ++ctx->crc_ops;
+        }
         if (isLongPIMessage(in) && *long_syndrome == 0) {
             // DF17/18 message with correct checksum
             memcpy(out, in, MODES_LONG_MSG_BYTES);
-            return 0;
+            ctx->corrections = 0;
+            return;
         }
 
         long_ei = modesChecksumDiagnose(*long_syndrome, MODES_LONG_MSG_BITS);
     }
 
     struct errorinfo *short_ei = NULL;
-    if (df_correctable_short[fix_df_bits] & df_bit) {
-        *short_syndrome = modesChecksum(in, MODES_SHORT_MSG_BITS);
+    if (try_short) {
+        if (*short_syndrome == UNCHECKED_SYNDROME) {
+            *short_syndrome = modesChecksum(in, MODES_SHORT_MSG_BITS);
+            ++ctx->crc_ops;
+        }
         if (isShortPIMessage(in) && (*short_syndrome & 0xFFFF80) == 0) {
             // DF11 message with correct checksum
             // (low 7 bits may be IID)
             memcpy(out, in, MODES_SHORT_MSG_BYTES);
-            return 0;
+            ctx->corrections = 0;
+            return;
         }
 
         short_ei = modesChecksumDiagnose(*short_syndrome, MODES_SHORT_MSG_BITS); // assume IID == 0
@@ -317,7 +253,9 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         modesChecksumFix(out, long_ei);
         if (isLongPIMessage(out)) {
             // valid DF17/18 message after corrections
-            return long_errors;
+            ctx->ei = long_ei;
+            ctx->corrections = long_errors;
+            return;
         }
     }
 
@@ -327,7 +265,9 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         modesChecksumFix(out, short_ei);
         if (isShortPIMessage(out)) {
             // valid DF11 message after corrections
-            return short_errors;
+            ctx->ei = short_ei;
+            ctx->corrections = short_errors;
+            return;
         }
     }
 
@@ -336,28 +276,53 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         modesChecksumFix(out, long_ei);
         if (isLongPIMessage(out)) {
             // valid DF17/18 message after corrections
-            return long_errors;
+            ctx->ei = long_ei;
+            ctx->corrections = long_errors;
+            return;
         }
     }
 
     // Nothing more to try, we can't correct this one further
     memcpy(out, in, MODES_LONG_MSG_BYTES);
-    return -1;
+}
+
+// Fill in the short syndrome of the corrected message if correctMessage() didn't
+static uint32_t contextShortSyndrome(struct score_context *ctx)
+{
+    if (ctx->short_syndrome == UNCHECKED_SYNDROME) {
+        ctx->short_syndrome = modesChecksum(ctx->corrected, MODES_SHORT_MSG_BITS);
+        ++ctx->crc_ops;
+    }
+    return ctx->short_syndrome;
+}
+
+// Fill in the long syndrome of the corrected message if correctMessage() didn't
+static uint32_t contextLongSyndrome(struct score_context *ctx)
+{
+    if (ctx->long_syndrome == UNCHECKED_SYNDROME) {
+        ctx->long_syndrome = modesChecksum(ctx->corrected, MODES_LONG_MSG_BITS);
+        ++ctx->crc_ops;
+    }
+    return ctx->long_syndrome;
 }
 
 // Score how plausible this ModeS message looks.
 // The more positive, the more reliable the message is.
-score_rank scoreModesMessage(const unsigned char *uncorrected)
+score_rank scoreModesMessage(const unsigned char *uncorrected, struct score_context *ctx)
 {
+    struct score_context local_ctx;
+    if (!ctx)
+        ctx = &local_ctx;
+
     // This is a "valid" DF0 message, but it's not useful; we discard these messages
     static const unsigned char all_zeros[MODES_SHORT_MSG_BYTES] = { 0, 0, 0, 0, 0, 0, 0 };
     if (!memcmp(all_zeros, uncorrected, sizeof(all_zeros)))
         return SR_ALL_ZEROS;
 
     // try to produce a corrected DF11/17/18, including correcting the DF bits
-    unsigned char corrected[14];
-    uint32_t short_syndrome, long_syndrome;
-    int corrections = correctMessage(uncorrected, corrected, &short_syndrome, &long_syndrome);
+    correctMessage(uncorrected, ctx);
+    const unsigned char *corrected = ctx->corrected;
+    int corrections = ctx->corrections;
 
     unsigned df = getbits(corrected, 1, 5); // Downlink Format
     switch (df) {
@@ -365,9 +330,7 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
     case 4:  // surveillance, altitude reply
     case 5:  // surveillance, altitude reply
         {
-            if (short_syndrome == UNCHECKED_SYNDROME)
-                short_syndrome = modesChecksum(corrected, MODES_SHORT_MSG_BITS);
-            bool recent = icaoFilterTest(short_syndrome);
+            bool recent = icaoFilterTest(contextShortSyndrome(ctx));
             return recent ? SR_UNRELIABLE_KNOWN : SR_UNRELIABLE_UNKNOWN;
         }
 
@@ -375,9 +338,7 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
     case 20: // Comm-B, altitude reply
     case 21: // Comm-B, identity reply
         {
-            if (long_syndrome == UNCHECKED_SYNDROME)
-                long_syndrome = modesChecksum(corrected, MODES_LONG_MSG_BITS);
-            bool recent = icaoFilterTest(long_syndrome);
+            bool recent = icaoFilterTest(contextLongSyndrome(ctx));
             return recent ? SR_UNRELIABLE_KNOWN : SR_UNRELIABLE_UNKNOWN;
         }
 
@@ -392,9 +353,7 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
         {
             if (!Modes.enable_df24)
                 return SR_UNCORRECTABLE;
-            if (long_syndrome == UNCHECKED_SYNDROME)
-                long_syndrome = modesChecksum(corrected, MODES_LONG_MSG_BITS);
-            bool recent = icaoFilterTest(long_syndrome);
+            bool recent = icaoFilterTest(contextLongSyndrome(ctx));
             return recent ? SR_UNRELIABLE_KNOWN : SR_UNRELIABLE_UNKNOWN;
         }
 
@@ -402,9 +361,7 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
         {
             // DF11 All-call reply
             uint32_t addr = getbits(corrected, 9, 32);
-            if (short_syndrome == UNCHECKED_SYNDROME)
-                short_syndrome = modesChecksum(corrected, MODES_SHORT_MSG_BITS);
-            uint32_t iid = short_syndrome & 0x7F;
+            uint32_t iid = contextShortSyndrome(ctx) & 0x7F;
             bool recent = icaoFilterTest(addr);
 
             switch (corrections) {
@@ -507,6 +464,7 @@ static const char *score_to_string(score_rank score)
 }
 
 static void decodeExtendedSquitter(struct modesMessage *mm);
+static void decodeModesFields(struct modesMessage *mm);
 
 //
 //=========================================================================
@@ -517,11 +475,15 @@ static void decodeExtendedSquitter(struct modesMessage *mm);
 // return 0 if all OK
 // <0 if it's a bad message
 //
-int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
+int decodeModesMessage(struct modesMessage *mm, const unsigned char *in, const struct score_context *scored)
 {
+    struct score_context ctx;
+
     // score the message if needed (it might be coming off the network)
-    if (mm->score == SR_NOT_SET)
-        mm->score = scoreModesMessage(in);
+    if (mm->score == SR_NOT_SET) {
+        mm->score = scoreModesMessage(in, &ctx);
+        scored = &ctx;
+    }
 
     if (mm->score < SR_UNKNOWN_THRESHOLD)
         return -1;
@@ -531,23 +493,26 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
     // Preserve the original uncorrected copy for later forwarding
     memcpy(mm->verbatim, in, MODES_LONG_MSG_BYTES);
 
-    // Apply corrections to our local copy
-    uint32_t short_syndrome, long_syndrome;
-    int corrections = correctMessage(in, mm->msg, &short_syndrome, &long_syndrome);
+    // Apply corrections to our local copy, reusing the work done while
+    // scoring if we have it
+    if (scored != &ctx) {
+        if (scored)
+            ctx = *scored;
+        else
+            correctMessage(in, &ctx);
+    }
+
+    memcpy(mm->msg, ctx.corrected, MODES_LONG_MSG_BYTES);
+    int corrections = ctx.corrections;
     const unsigned char *msg = mm->msg;
 
     // Get the message type ASAP as other operations depend on this
     mm->msgtype         = getbits(msg, 1, 5); // Downlink Format
     mm->msgbits         = modesMessageLenByType(mm->msgtype);
-    if (mm->msgtype & 16) {
-        if (long_syndrome == UNCHECKED_SYNDROME)
-            long_syndrome = modesChecksum(mm->msg, MODES_LONG_MSG_BITS);
-        mm->crc = long_syndrome;
-    } else {
-        if (short_syndrome == UNCHECKED_SYNDROME)
-            short_syndrome = modesChecksum(mm->msg, MODES_SHORT_MSG_BITS);
-        mm->crc = short_syndrome;
-    }
+    if (mm->msgtype & 16)
+        mm->crc = contextLongSyndrome(&ctx);
+    else
+        mm->crc = contextShortSyndrome(&ctx);
 
     mm->correctedbits   = corrections > 0 ? corrections : 0;
     mm->addr            = 0;
@@ -618,13 +583,42 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
         return -2;
     }
 
-    // decode the bulk of the message
-
     // AA (Address announced)
     if (mm->msgtype == 11 || mm->msgtype == 17 || mm->msgtype == 18) {
         mm->AA = mm->addr = getbits(msg, 9, 32);
     }
 
+    // decode the bulk of the message, unless all we are going to do with it
+    // is forward it
+    if (!Modes.forward_only)
+        decodeModesFields(mm);
+
+    if (!mm->correctedbits && (mm->msgtype == 17 || (mm->msgtype == 11 && mm->IID == 0))) {
+        // DF17 ADS-B or DF11 acquisition squitter. Mark as known Mode-S source
+        icaoFilterAdd(mm->addr);
+    }
+    if (!mm->correctedbits && mm->msgtype == 18 && (!Modes.forward_only || getbits(msg, 6, 8) == 0)) {
+        // Mark as known ADS-B (NT) source. Without the ES decoding we can
+        // only be sure that AA is an ICAO address when CF=0
+        icaoFilterAdd(mm->addr | ICAO_FILTER_ADSB_NT);
+    }
+
+    // MLAT overrides all other sources
+    if (mm->remote && mm->timestampMsg == MAGIC_MLAT_TIMESTAMP)
+        mm->source = SOURCE_MLAT;
+
+    // all done
+    return 0;
+}
+
+//
+// Extract and decode everything but the address from a message that
+// decodeModesMessage() has already validated
+//
+static void decodeModesFields(struct modesMessage *mm)
+{
+    const unsigned char *msg = mm->msg;
+
     // AC (Altitude Code)
     if (mm->msgtype == 0 || mm->msgtype == 4 || mm->msgtype == 16 || mm->msgtype == 20) {
         mm->AC = getbits(msg, 20, 32);
@@ -730,7 +724,8 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
     // MB (messsage, Comm-B)
     if (mm->msgtype == 20 || mm->msgtype == 21) {
         memcpy(mm->MB, &msg[4], 7);
-        decodeCommB(mm);
+        // classified later, by tracking (see trackUpdateFromMessage)
+        mm->commb_format = COMMB_NOT_DECODED;
     }
 
     // MD (message, Comm-D)
@@ -777,22 +772,6 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
         else
             mm->airground = AG_UNCERTAIN;
     }
-
-    if (!mm->correctedbits && (mm->msgtype == 17 || (mm->msgtype == 11 && mm->IID == 0))) {
-        // DF17 ADS-B or DF11 acquisition squitter. Mark as known Mode-S source
-        icaoFilterAdd(mm->addr);
-    }
-    if (!mm->correctedbits && mm->msgtype == 18) {
-         // Mark as known ADS-B (NT) source
-       icaoFilterAdd(mm->addr | ICAO_FILTER_ADSB_NT);
-    }
-
-    // MLAT overrides all other sources
-    if (mm->remote && mm->timestampMsg == MAGIC_MLAT_TIMESTAMP)
-        mm->source = SOURCE_MLAT;
-
-    // all done
-    return 0;
 }
 
 static void decodeESIdentAndCategory(struct modesMessage *mm)
@@ -1060,7 +1039,7 @@ static void decodeESAirbornePosition(struct modesMessage *mm, int check_imf)
             //   400648 (BAE ATP) - Atlantic Airlines
             // altitude == 0, longitude == 0, type == 15 and zeros in latitude LSB.
             // Can alternate with valid reports having type == 14
-            Modes.stats_current.cpr_filtered++;
+            mm->cpr_filtered = 1;
         } else {
             // Otherwise, assume it's valid.
             mm->cpr_valid = 1;
@@ -2261,6 +2240,44 @@ void displayModesMessage(struct modesMessage *mm) {
     fflush(stdout);
 }
 
+//
+// With --forward-only, decodeModesMessage() skips decodeModesFields().
+// To report what that saves, one message in every FORWARD_ONLY_SAMPLE_INTERVAL
+// of each DF has a copy of it fully decoded anyway, and the CPU time taken
+// is scaled up and counted towards that DF.
+//
+#define FORWARD_ONLY_SAMPLE_INTERVAL 64
+
+static void sampleSkippedFields(const struct modesMessage *mm)
+{
+    static unsigned countdown[32];
+
+    if (mm->msgtype < 0 || mm->msgtype >= 32)
+        return; // Mode A/C, there was nothing to skip
+
+    if (countdown[mm->msgtype]--)
+        return;
+    countdown[mm->msgtype] = FORWARD_ONLY_SAMPLE_INTERVAL - 1;
+
+    struct modesMessage copy = *mm;
+    struct timespec start, overhead = { 0, 0 }, taken = { 0, 0 };
+
+    // the clock reads cost more than decoding a short message, so time an
+    // empty interval too and take that off
+    start_cpu_timing(&start);
+    end_cpu_timing(&start, &overhead);
+
+    start_cpu_timing(&start);
+    decodeModesFields(&copy);
+    if (copy.msgtype == 20 || copy.msgtype == 21)
+        decodeCommB(&copy, NULL);
+    end_cpu_timing(&start, &taken);
+
+    int64_t ns = (int64_t) (taken.tv_sec - overhead.tv_sec) * 1000000000 + (taken.tv_nsec - overhead.tv_nsec);
+    if (ns > 0)
+        Modes.stats_current.decode_cpu_saved_by_df[mm->msgtype] += (uint64_t) ns * FORWARD_ONLY_SAMPLE_INTERVAL;
+}
+
 //
 //=========================================================================
 //
@@ -2279,6 +2296,24 @@ void useModesMessage(struct modesMessage *mm) {
         ++Modes.stats_current.messages_by_df[mm->msgtype];
     }
 
+    if (Modes.forward_only) {
+        // Nothing here needs the message fields, pass it straight on to the
+        // raw / Beast outputs (and to stdout, if that only wants the raw message).
+        // Without an aircraft record the outputs fall back on the ICAO filter
+        // to decide whether an unreliable message may be forwarded.
+        sampleSkippedFields(mm);
+        if (!Modes.quiet && (Modes.raw || Modes.onlyaddr) && (!Modes.show_only || mm->addr == Modes.show_only)) {
+            displayModesMessage(mm);
+        }
+        if (Modes.net) {
+            modesQueueOutput(mm, NULL);
+        }
+        return;
+    }
+    if (mm->cpr_filtered) {
+        ++Modes.stats_current.cpr_filtered;
+    }
+
     // Track aircraft state
     a = trackUpdateFromMessage(mm);
 
@@ -2293,6 +2328,60 @@ void useModesMessage(struct modesMessage *mm) {
     }
 }
 
+//
+// Clear a message left over from an earlier batch so that it can be reused.
+//
+// The integrity/accuracy, operational status, nav and MRAR fields at the
+// end of the message are only ever written for DF17/18 (by the extended
+// squitter decoder, and by tracking when it fills in ADS-B v0 accuracy)
+// and DF20/21 (by the Comm-B decoder). For every other DF they are still
+// zero and are left alone.
+//
+static void resetBatchMessage(struct modesMessage *mm)
+{
+    switch (mm->msgtype) {
+    case 17:
+    case 18:
+    case 20:
+    case 21:
+        memset(mm, 0, sizeof(*mm));
+        break;
+
+    default:
+        memset(mm, 0, offsetof(struct modesMessage, accuracy));
+        break;
+    }
+}
+
+void decodeModesBatch(const struct modesFrame *frames, unsigned count, int remote, struct modesMessage *mm, int *results)
+{
+    for (unsigned i = 0; i < count; ++i) {
+        const struct modesFrame *f = &frames[i];
+        struct modesMessage *m = &mm[i];
+
+        resetBatchMessage(m);
+        m->remote = remote;
+        m->timestampMsg = f->timestampMsg;
+        m->sysTimestampMsg = f->sysTimestampMsg;
+        m->signalLevel = f->signalLevel;
+
+        if (f->len == MODEAC_MSG_BYTES) {
+            decodeModeAMessage(m, (f->msg[0] << 8) | f->msg[1]);
+            results[i] = 0;
+        } else {
+            results[i] = decodeModesMessage(m, f->msg, NULL);
+        }
+    }
+}
+
+void useModesBatch(struct modesMessage *mm, const int *results, unsigned count)
+{
+    for (unsigned i = 0; i < count; ++i) {
+        if (results[i] >= 0)
+            useModesMessage(&mm[i]);
+    }
+}
+
 //
 // ===================== Mode S detection and decoding  ===================
 //
@@ -79,12 +79,50 @@ typedef enum {
     SR_DF17_KNOWN,                // DF17,               no errors,  known aircraft
 } score_rank;
 
+// The CRC and error correction work done while scoring a message, kept so
+// that decodeModesMessage() can reuse it rather than repeat it.
+struct score_context {
+    unsigned char corrected[MODES_LONG_MSG_BYTES]; // message after error correction (if any)
+    int corrections;                // number of bits corrected, or -1 if not correctable
+    struct errorinfo *ei;           // the correction that was applied, or NULL
+    uint32_t short_syndrome;        // 56-bit CRC syndrome, or UNCHECKED_SYNDROME if not computed
+    uint32_t long_syndrome;         // 112-bit CRC syndrome, or UNCHECKED_SYNDROME if not computed
+    unsigned crc_ops;               // number of CRC syndromes computed while scoring
+};
+
+#define UNCHECKED_SYNDROME 0xFFFFFFFFU
+
 int modesMessageLenByType(int type);
-score_rank scoreModesMessage(const unsigned char *msg);
-int decodeModesMessage (struct modesMessage *mm, const unsigned char *msg);
+
+// Score a message. If ctx is not NULL, it is filled in for a later
+// decodeModesMessage() of the same message.
+score_rank scoreModesMessage(const unsigned char *msg, struct score_context *ctx);
+
+// Decode a message. If ctx is not NULL, it must be the context from
+// scoring this same message (with mm->score set to the resulting score).
+int decodeModesMessage (struct modesMessage *mm, const unsigned char *msg, const struct score_context *ctx);
 void displayModesMessage(struct modesMessage *mm);
 void useModesMessage    (struct modesMessage *mm);
 
+// A raw Mode S or Mode A/C frame waiting to be decoded by decodeModesBatch()
+struct modesFrame {
+    uint64_t      timestampMsg;                 // Timestamp of the message (12MHz clock)
+    uint64_t      sysTimestampMsg;              // Timestamp of the message (system time)
+    double        signalLevel;                  // RSSI, in the range [0..1], as a fraction of full-scale power
+    unsigned      len;                          // MODEAC_MSG_BYTES, MODES_SHORT_MSG_BYTES or MODES_LONG_MSG_BYTES
+    unsigned char msg[MODES_LONG_MSG_BYTES];
+};
+
+// Decode count frames into mm[0..count-1], storing the decodeModesMessage()
+// result for each frame in results[] (Mode A/C frames always give 0).
+// The messages must either be all-zero or be left over from an earlier
+// decodeModesBatch() / useModesBatch(); they are only cleared as far
+// as the message previously held there can have dirtied them.
+void decodeModesBatch(const struct modesFrame *frames, unsigned count, int remote, struct modesMessage *mm, int *results);
+
+// Pass each successfully decoded message of a batch on to useModesMessage(), in order
+void useModesBatch(struct modesMessage *mm, const int *results, unsigned count);
+
 // datafield extraction helpers
 
 // The first bit (MSB of the first byte) is numbered 1, for consistency
@@ -397,6 +397,26 @@ static void completeWrite(struct net_writer *writer, void *endptr) {
     }
 }
 
+//
+// Should an unreliable message be kept off the raw and Beast cooked outputs?
+// Normally the aircraft record decides. A Mode S message may have no record
+// (with --forward-only, or when --track-max has been reached); pass it on
+// only if its address has been confirmed by a reliable DF11/DF17/DF18 (i.e.
+// it is in the ICAO filter), which is what the tracker's reliability check
+// mostly amounts to. Mode A/C messages never have a record.
+//
+static int isUnreliable(struct modesMessage *mm, struct aircraft *a) {
+    if (mm->reliable)
+        return 0;
+    if (a)
+        return !a->reliable;
+    if (mm->msgtype != 32) {
+        uint32_t addr = mm->addr & 0xFFFFFF;
+        return !icaoFilterTest(mm->msgtype == 18 ? (addr | ICAO_FILTER_ADSB_NT) : addr);
+    }
+    return 0;
+}
+
 //
 //=========================================================================
 //
@@ -431,7 +451,7 @@ static void modesSendBeastCookedOutput(struct modesMessage *mm, struct aircraft
         return;
 
     // Don't forward unreliable messages
-    if ((a && !a->reliable) && !mm->reliable)
+    if (isUnreliable(mm, a))
         return;
 
     writeBeastMessage(&Modes.beast_cooked_out, mm->timestampMsg, mm->signalLevel, mm->msg, mm->msgbits / 8);
@@ -518,7 +538,7 @@ static void modesSendRawOutput(struct modesMessage *mm, struct aircraft *a) {
         return;
 
     // Don't forward unreliable messages
-    if ((a && !a->reliable) && !mm->reliable)
+    if (isUnreliable(mm, a))
         return;
 
     int msgLen = mm->msgbits / 8;
@@ -858,7 +878,7 @@ static void modesSendStratuxOutput(struct modesMessage *mm, struct aircraft *a)
             mm->metype,
             mm->mesub,
             mm->signalLevel, // what precision and range is needed for RSSI?
-            sdrGetGainDb(sdrGetGain()),
+            sdrGetGainDb(atomic_load_explicit(&Modes.sdr_gain, memory_order_relaxed)),
             is_mlat_str);
 
     //// callsign
@@ -1225,13 +1245,72 @@ static int handleBeastCommand(struct client *c, char *p) {
     return 0;
 }
 
+//
+//=========================================================================
+//
+// Remote Mode S / Mode A/C messages are not decoded one at a time as they are
+// parsed out of a client's buffer. Instead the raw frames are collected here
+// and decoded together (and handed to tracking together) once the buffer has
+// been scanned, or the batch fills up.
+//
+#define REMOTE_BATCH_SIZE 64
+
+static struct {
+    unsigned count;
+    struct modesFrame frames[REMOTE_BATCH_SIZE];
+    struct modesMessage messages[REMOTE_BATCH_SIZE];
+    int results[REMOTE_BATCH_SIZE];
+} remoteBatch;
+
+static void flushRemoteBatch(void)
+{
+    if (!remoteBatch.count)
+        return;
+
+    decodeModesBatch(remoteBatch.frames, remoteBatch.count, 1 /* remote */, remoteBatch.messages, remoteBatch.results);
+
+    for (unsigned i = 0; i < remoteBatch.count; ++i) {
+        int result = remoteBatch.results[i];
+
+        if (remoteBatch.frames[i].len == MODEAC_MSG_BYTES) {
+            Modes.stats_current.remote_received_modeac++;
+        } else {
+            Modes.stats_current.remote_received_modes++;
+            if (result == -1)
+                Modes.stats_current.remote_rejected_unknown_icao++;
+            else if (result < 0)
+                Modes.stats_current.remote_rejected_bad++;
+            else
+                Modes.stats_current.remote_accepted[remoteBatch.messages[i].correctedbits]++;
+        }
+    }
+
+    useModesBatch(remoteBatch.messages, remoteBatch.results, remoteBatch.count);
+    remoteBatch.count = 0;
+}
+
+// Return the next free frame in the batch; it is only added to the batch
+// once the caller has filled it in and called commitRemoteFrame()
+static struct modesFrame *nextRemoteFrame(void)
+{
+    if (remoteBatch.count == REMOTE_BATCH_SIZE)
+        flushRemoteBatch();
+    return &remoteBatch.frames[remoteBatch.count];
+}
+
+static void commitRemoteFrame(void)
+{
+    ++remoteBatch.count;
+}
+
 //
 //=========================================================================
 //
 // This function decodes a Beast binary format message
 //
-// The message is passed to the higher level layers, so it feeds
-// the selected screen output, the network output and so forth.
+// Mode S and Mode A/C messages are added to the pending batch, and are
+// passed to the higher level layers (the selected screen output, the
+// network output and so forth) when the batch is flushed.
 //
 // If the message looks invalid it is silently discarded.
 //
@@ -1243,10 +1322,7 @@ static int decodeBinMessage(struct client *c, char *p) {
     int  j;
     char ch;
     unsigned char msg[MODES_LONG_MSG_BYTES + 7];
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
     MODES_NOTUSED(c);
-    memset(&mm, 0, sizeof(mm));
 
     ch = *p++; /// Get the message type
 
@@ -1269,6 +1345,8 @@ static int decodeBinMessage(struct client *c, char *p) {
         lon = ieee754_binary32_le_to_float(msg + 8);
         alt = ieee754_binary32_le_to_float(msg + 12);
 
+        // messages before this one must see the old receiver position
+        flushRemoteBatch();
         handle_radarcape_position(lat, lon, alt);
     } else {
         // Ignore this.
@@ -1276,53 +1354,31 @@ static int decodeBinMessage(struct client *c, char *p) {
     }
 
     if (msgLen) {
-        mm = zeroMessage;
-
-        // Mark messages received over the internet as remote so that we don't try to
-        // pass them off as being received by this instance when forwarding them
-        mm.remote      =    1;
+        struct modesFrame *f = nextRemoteFrame();
 
         // Grab the timestamp (big endian format)
-        mm.timestampMsg = 0;
+        f->timestampMsg = 0;
         for (j = 0; j < 6; j++) {
             ch = *p++;
-            mm.timestampMsg = mm.timestampMsg << 8 | (ch & 255);
+            f->timestampMsg = f->timestampMsg << 8 | (ch & 255);
             if (0x1A == ch) {p++;}
         }
 
         // record reception time as the time we read it.
-        mm.sysTimestampMsg = mstime();
+        f->sysTimestampMsg = mstime();
 
         ch = *p++;  // Grab the signal level
-        mm.signalLevel = ((unsigned char)ch / 255.0);
-        mm.signalLevel = mm.signalLevel * mm.signalLevel;
+        f->signalLevel = ((unsigned char)ch / 255.0);
+        f->signalLevel = f->signalLevel * f->signalLevel;
         if (0x1A == ch) {p++;}
 
         for (j = 0; j < msgLen; j++) { // and the data
-            msg[j] = ch = *p++;
+            f->msg[j] = ch = *p++;
             if (0x1A == ch) {p++;}
         }
 
-        if (msgLen == MODEAC_MSG_BYTES) { // ModeA or ModeC
-            Modes.stats_current.remote_received_modeac++;
-            decodeModeAMessage(&mm, ((msg[0] << 8) | msg[1]));
-        } else {
-            int result;
-
-            Modes.stats_current.remote_received_modes++;
-            result = decodeModesMessage(&mm, msg);
-            if (result < 0) {
-                if (result == -1)
-                    Modes.stats_current.remote_rejected_unknown_icao++;
-                else
-                    Modes.stats_current.remote_rejected_bad++;
-                return 0;
-            } else {
-                Modes.stats_current.remote_accepted[mm.correctedbits]++;
-            }
-        }
-
-        useModesMessage(&mm);
+        f->len = msgLen;
+        commitRemoteFrame();
     }
     return (0);
 }
@@ -1374,8 +1430,9 @@ static bool signalFromHex(const char *hex, double *signal)
 // This function decodes a string representing message in raw hex format
 // like: *8D4B969699155600E87406F5B69F; The string is null-terminated.
 //
-// The message is passed to the higher level layers, so it feeds
-// the selected screen output, the network output and so forth.
+// The message is added to the pending batch, and is passed to the higher
+// level layers (the selected screen output, the network output and so
+// forth) when the batch is flushed.
 //
 // If the message looks invalid it is silently discarded.
 //
@@ -1384,17 +1441,11 @@ static bool signalFromHex(const char *hex, double *signal)
 //
 static int decodeHexMessage(struct client *c, char *hex) {
     int l = strlen(hex), j;
-    unsigned char msg[MODES_LONG_MSG_BYTES];
-    struct modesMessage mm;
-    static struct modesMessage zeroMessage;
+    struct modesFrame *f = nextRemoteFrame();
 
     MODES_NOTUSED(c);
-    mm = zeroMessage;
-
-    // Mark messages received over the internet as remote so that we don't try to
-    // pass them off as being received by this instance when forwarding them
-    mm.remote      =    1;
-    mm.signalLevel =    0;
+    f->timestampMsg = 0;
+    f->signalLevel = 0;
 
     // Remove spaces on the left and on the right
     while(l && isspace(hex[l-1])) {
@@ -1418,9 +1469,9 @@ static int decodeHexMessage(struct client *c, char *hex) {
             // [l-1]     ';'
             if (l < 18)
                 return 0; // truncated
-            if (!timestampFromHex(hex + 1, &mm.timestampMsg))
+            if (!timestampFromHex(hex + 1, &f->timestampMsg))
                 return 0; // malformed timestamp
-            if (!signalFromHex(hex + 13, &mm.signalLevel))
+            if (!signalFromHex(hex + 13, &f->signalLevel))
                 return 0; // malformed signal level
             hex += 15;
             l -= 16;
@@ -1434,7 +1485,7 @@ static int decodeHexMessage(struct client *c, char *hex) {
             // [l-1]     ';'
             if (l < 16)
                 return 0; // truncated
-            if (!timestampFromHex(hex + 1, &mm.timestampMsg))
+            if (!timestampFromHex(hex + 1, &f->timestampMsg))
                 return 0; // malformed timestamp
             hex += 13;
             l -= 14;
@@ -1469,32 +1520,14 @@ static int decodeHexMessage(struct client *c, char *hex) {
         int low  = hexDigitVal(hex[j+1]);
 
         if (high == -1 || low == -1) return 0;
-        msg[j/2] = (high << 4) | low;
+        f->msg[j/2] = (high << 4) | low;
     }
 
     // record reception time as the time we read it.
-    mm.sysTimestampMsg = mstime();
-
-    if (l == (MODEAC_MSG_BYTES * 2)) {  // ModeA or ModeC
-        Modes.stats_current.remote_received_modeac++;
-        decodeModeAMessage(&mm, ((msg[0] << 8) | msg[1]));
-    } else {       // Assume ModeS
-        int result;
-
-        Modes.stats_current.remote_received_modes++;
-        result = decodeModesMessage(&mm, msg);
-        if (result < 0) {
-            if (result == -1)
-                Modes.stats_current.remote_rejected_unknown_icao++;
-            else
-                Modes.stats_current.remote_rejected_bad++;
-            return 0;
-        } else {
-            Modes.stats_current.remote_accepted[mm.correctedbits]++;
-        }
-    }
+    f->sysTimestampMsg = mstime();
 
-    useModesMessage(&mm);
+    f->len = l / 2;
+    commitRemoteFrame();
     return (0);
 }
 
@@ -1832,18 +1865,18 @@ char *generateAircraftJson(const char *url_path, int *len) {
             p = safe_snprintf(p, end, ",\"gva\":%u", a->gva);
         if (trackDataValid(&a->sda_valid))
             p = safe_snprintf(p, end, ",\"sda\":%u", a->sda);
-        if (trackDataValid(&a->mrar_source_valid))
-            p = safe_snprintf(p, end, ",\"mrar_source\":\"%s\"", mrar_source_enum_string(a->mrar_source));
-        if (trackDataValid(&a->wind_valid))
-            p = safe_snprintf(p, end, ",\"wind_speed\":%.0f,\"wind_dir\":%.1f", a->wind_speed, a->wind_dir);
-        if (trackDataValid(&a->temperature_valid))
-            p = safe_snprintf(p, end, ",\"temperature\":%.2f", a->temperature);
-        if (trackDataValid(&a->pressure_valid))
-            p = safe_snprintf(p, end, ",\"pressure\":%.0f", a->pressure);
-        if (trackDataValid(&a->turbulence_valid))
-            p = safe_snprintf(p, end, ",\"turbulence\":\"%s\"", hazard_enum_string(a->turbulence));
-        if (trackDataValid(&a->humidity_valid))
-            p = safe_snprintf(p, end, ",\"humidity\":%.1f", a->humidity);
+        if (trackDataValid(&a->mrar->mrar_source_valid))
+            p = safe_snprintf(p, end, ",\"mrar_source\":\"%s\"", mrar_source_enum_string(a->mrar->mrar_source));
+        if (trackDataValid(&a->mrar->wind_valid))
+            p = safe_snprintf(p, end, ",\"wind_speed\":%.0f,\"wind_dir\":%.1f", a->mrar->wind_speed, a->mrar->wind_dir);
+        if (trackDataValid(&a->mrar->temperature_valid))
+            p = safe_snprintf(p, end, ",\"temperature\":%.2f", a->mrar->temperature);
+        if (trackDataValid(&a->mrar->pressure_valid))
+            p = safe_snprintf(p, end, ",\"pressure\":%.0f", a->mrar->pressure);
+        if (trackDataValid(&a->mrar->turbulence_valid))
+            p = safe_snprintf(p, end, ",\"turbulence\":\"%s\"", hazard_enum_string(a->mrar->turbulence));
+        if (trackDataValid(&a->mrar->humidity_valid))
+            p = safe_snprintf(p, end, ",\"humidity\":%.1f", a->mrar->humidity);
         if (a->modeA_hit)
             p = safe_snprintf(p, end, ",\"modea\":true");
         if (a->modeC_hit)
@@ -1892,16 +1925,20 @@ static char * appendStatsJson(char *p,
         p = safe_snprintf(p, end,
                            ",\"local\":{\"samples_processed\":%llu"
                            ",\"samples_dropped\":%llu"
+                           ",\"messages_dropped\":%u"
                            ",\"modeac\":%u"
                            ",\"modes\":%u"
                            ",\"bad\":%u"
-                           ",\"unknown_icao\":%u",
+                           ",\"unknown_icao\":%u"
+                           ",\"crc_saved\":%u",
                            (unsigned long long)st->samples_processed,
                            (unsigned long long)st->samples_dropped,
+                           st->messages_dropped,
                            st->demod_modeac,
                            st->demod_preambles,
                            st->demod_rejected_bad,
-                           st->demod_rejected_unknown_icao);
+                           st->demod_rejected_unknown_icao,
+                           st->demod_crc_saved);
 
         for (i=0; i <= Modes.nfix_crc; ++i) {
             if (i == 0) p = safe_snprintf(p, end, ",\"accepted\":[%u", st->demod_accepted[i]);
@@ -1917,6 +1954,42 @@ static char * appendStatsJson(char *p,
         if (st->peak_signal_power > 0)
             p = safe_snprintf(p, end, ",\"peak_signal\":%.1f", 10 * log10(st->peak_signal_power));
 
+        p = safe_snprintf(p, end,
+                           ",\"fifo\":{\"buffers\":%u"
+                           ",\"high_water\":%u"
+                           ",\"overruns\":%u"
+                           ",\"drop_events\":%u}",
+                           Modes.fifo_buffers,
+                           st->fifo_high_water,
+                           st->fifo_overruns,
+                           st->drop_events);
+        if (st->block_latency_max > 0)
+            p = safe_snprintf(p, end,
+                               ",\"block_latency\":{\"p50\":%.1f,\"p90\":%.1f,\"p99\":%.1f,\"max\":%.1f}",
+                               block_latency_percentile(st, 50),
+                               block_latency_percentile(st, 90),
+                               block_latency_percentile(st, 99),
+                               st->block_latency_max / 1000.0);
+
+        for (unsigned r = 0; Modes.receiver_count && r <= Modes.receiver_count; ++r) {
+            p = safe_snprintf(p, end,
+                               "%s{\"id\":%u"
+                               ",\"name\":\"%s\""
+                               ",\"samples_processed\":%llu"
+                               ",\"samples_dropped\":%llu"
+                               ",\"accepted\":%u"
+                               ",\"duplicates\":%u}",
+                               r == 0 ? ",\"receivers\":[" : ",",
+                               r,
+                               jsonEscapeString(receiverName(r)),
+                               (unsigned long long)st->receiver_samples_processed[r],
+                               (unsigned long long)st->receiver_samples_dropped[r],
+                               st->receiver_accepted[r],
+                               st->receiver_duplicates[r]);
+            if (r == Modes.receiver_count)
+                p = safe_snprintf(p, end, "]");
+        }
+
         p = safe_snprintf(p, end, ",\"strong_signals\":%u", st->strong_signal_count);
         if (st->sdr_gain >= 0)
             p = safe_snprintf(p, end, ",\"gain_db\":%.1f", sdrGetGainDb(st->sdr_gain));
@@ -1965,7 +2038,10 @@ static char * appendStatsJson(char *p,
                       ",\"cpu\":{\"demod\":%llu,\"reader\":%llu,\"background\":%llu}"
                       ",\"tracks\":{\"all\":%u"
                       ",\"single_message\":%u"
-                      ",\"unreliable\":%u}"
+                      ",\"unreliable\":%u"
+                      ",\"alloc_failures\":%u"
+                      ",\"slab_capacity\":%u"
+                      ",\"slab_used\":%u}"
                       ",\"messages\":%u",
                       st->cpr_surface,
                       st->cpr_airborne,
@@ -1988,8 +2064,34 @@ static char * appendStatsJson(char *p,
                       st->unique_aircraft,
                       st->single_message_aircraft,
                       st->unreliable_aircraft,
+                      st->aircraft_alloc_failures,
+                      st->aircraft_slab_capacity,
+                      st->aircraft_slab_used,
                       st->messages_total);
 
+    bool any_threads = false;
+    for (i = 0; i < STATS_THREAD_COUNT; ++i) {
+        const struct thread_stats *t = &st->threads[i];
+        if (!t->valid)
+            continue;
+
+        p = safe_snprintf(p, end,
+                          "%s\"%s\":{\"cpu\":%llu"
+                          ",\"voluntary_switches\":%llu"
+                          ",\"involuntary_switches\":%llu",
+                          any_threads ? "," : ",\"threads\":{",
+                          stats_thread_name(i),
+                          (unsigned long long) t->cpu.tv_sec * 1000ULL + t->cpu.tv_nsec / 1000000,
+                          (unsigned long long) t->voluntary_switches,
+                          (unsigned long long) t->involuntary_switches);
+        if (t->migrations_valid)
+            p = safe_snprintf(p, end, ",\"migrations\":%llu", (unsigned long long) t->migrations);
+        p = safe_snprintf(p, end, "}");
+        any_threads = true;
+    }
+    if (any_threads)
+        p = safe_snprintf(p, end, "}");
+
     for (i = 0; i < 32; ++i) {
         if (i == 0)
             p = safe_snprintf(p, end, ",\"messages_by_df\":[%u", st->messages_by_df[i]);
@@ -1998,6 +2100,16 @@ static char * appendStatsJson(char *p,
     }
     p = safe_snprintf(p, end, "]");
 
+    if (Modes.forward_only) {
+        for (i = 0; i < 32; ++i) {
+            if (i == 0)
+                p = safe_snprintf(p, end, ",\"cpu_saved_by_df\":[%.3f", st->decode_cpu_saved_by_df[i] / 1e6);
+            else
+                p = safe_snprintf(p, end, ",%.3f", st->decode_cpu_saved_by_df[i] / 1e6);
+        }
+        p = safe_snprintf(p, end, "]");
+    }
+
     if (st->adaptive_valid) {
         p = safe_snprintf(p, end,
                           ",\"adaptive\":"
@@ -2216,6 +2328,13 @@ void writeJsonToFile(const char *file, char * (*generator) (const char *,int*))
 }
 
 
+// Close a client, first decoding and using whatever was already parsed out
+// of its buffer into the remote batch
+static void flushAndCloseClient(struct client *c) {
+    flushRemoteBatch();
+    modesCloseClient(c);
+}
+
 //
 //=========================================================================
 //
@@ -2258,7 +2377,7 @@ static void modesReadFromClient(struct client *c) {
         }
 
         if (nread == 0) { // End of file
-            modesCloseClient(c);
+            flushAndCloseClient(c);
             return;
         }
 
@@ -2272,7 +2391,7 @@ static void modesReadFromClient(struct client *c) {
         }
 
         if (nread < 0) { // Other errors
-            modesCloseClient(c);
+            flushAndCloseClient(c);
             return;
         }
 
@@ -2333,7 +2452,7 @@ static void modesReadFromClient(struct client *c) {
 
                 // Have a 0x1a followed by 1/2/3/4/5 - pass message to handler.
                 if (c->service->read_handler(c, som + 1)) {
-                    modesCloseClient(c);
+                    flushAndCloseClient(c);
                     return;
                 }
 
@@ -2376,7 +2495,7 @@ static void modesReadFromClient(struct client *c) {
 
                 // Have a 0x1a followed by 1 - pass message to handler.
                 if (c->service->read_handler(c, som + 1)) {
-                    modesCloseClient(c);
+                    flushAndCloseClient(c);
                     return;
                 }
 
@@ -2398,7 +2517,7 @@ static void modesReadFromClient(struct client *c) {
             while (som < eod && (p = strstr(som, c->service->read_sep)) != NULL) { // end of first message if found
                 *p = '\0';                         // The handler expects null terminated strings
                 if (c->service->read_handler(c, som)) {         // Pass message to handler.
-                    modesCloseClient(c);           // Handler returns 1 on error to signal we .
+                    flushAndCloseClient(c);        // Handler returns 1 on error to signal we .
                     return;                        // should close the client connection
                 }
                 som = p + strlen(c->service->read_sep);               // Move to start of next message
@@ -2407,6 +2526,9 @@ static void modesReadFromClient(struct client *c) {
             break;
         }
 
+        // decode and use everything that was parsed out of this read
+        flushRemoteBatch();
+
         if (som > c->buf) {                        // We processed something - so
             c->buflen = eod - som;                 //     Update the unprocessed buffer length
             memmove(c->buf, som, c->buflen);       //     Move what's remaining to the start of the buffer
@@ -2511,24 +2633,24 @@ static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
         switch (mm->commb_format) {
         case COMMB_DATALINK_CAPS:
             // BDS 1,0: data link capability report
-            if (memcmp(mm->MB, a->fatsv_emitted_bds_10, 7) != 0) {
-                memcpy(a->fatsv_emitted_bds_10, mm->MB, 7);
+            if (memcmp(mm->MB, a->fatsv->emitted_bds_10, 7) != 0) {
+                memcpy(a->fatsv->emitted_bds_10, mm->MB, 7);
                 writeFATSVEventMessage(mm, "datalink_caps", mm->MB, 7);
             }
             break;
 
         case COMMB_ACAS_RA:
             // BDS 3,0: ACAS RA report
-            if (memcmp(mm->MB, a->fatsv_emitted_bds_30, 7) != 0) {
-                memcpy(a->fatsv_emitted_bds_30, mm->MB, 7);
+            if (memcmp(mm->MB, a->fatsv->emitted_bds_30, 7) != 0) {
+                memcpy(a->fatsv->emitted_bds_30, mm->MB, 7);
                 writeFATSVEventMessage(mm, "commb_acas_ra", mm->MB, 7);
             }
             break;
 
         case COMMB_GICB_CAPS:
             // BDS 1,7: common usage GICB capability report
-            if (memcmp(mm->MB, a->fatsv_emitted_bds_17, 7) != 0) {
-                memcpy(a->fatsv_emitted_bds_17, mm->MB, 7);
+            if (memcmp(mm->MB, a->fatsv->emitted_bds_17, 7) != 0) {
+                memcpy(a->fatsv->emitted_bds_17, mm->MB, 7);
                 writeFATSVEventMessage(mm, "gicb_caps", mm->MB, 7);
             }
             break;
@@ -2536,8 +2658,8 @@ static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
         case COMMB_UNKNOWN:
             // If enabled, upload raw unrecognized Comm-B messages
             // for server-side analysis
-            if (Modes.faup_upload_unknown_commb && memcmp(mm->MB, a->fatsv_emitted_unknown_commb, 7) != 0) {
-                memcpy(a->fatsv_emitted_unknown_commb, mm->MB, 7);
+            if (Modes.faup_upload_unknown_commb && memcmp(mm->MB, a->fatsv->emitted_unknown_commb, 7) != 0) {
+                memcpy(a->fatsv->emitted_unknown_commb, mm->MB, 7);
                 writeFATSVEventMessage(mm, "unknown_commb", mm->MB, 7);
             }
             break;
@@ -2551,14 +2673,14 @@ static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
     case 17:
     case 18:
         // DF 17/18: extended squitter
-        if (mm->metype == 28 && mm->mesub == 2 && memcmp(mm->ME, &a->fatsv_emitted_es_acas_ra, 7) != 0) {
+        if (mm->metype == 28 && mm->mesub == 2 && memcmp(mm->ME, &a->fatsv->emitted_es_acas_ra, 7) != 0) {
             // type 28 subtype 2: ACAS RA report
             // first byte has the type/subtype, remaining bytes match the BDS 3,0 format
-            memcpy(a->fatsv_emitted_es_acas_ra, mm->ME, 7);
+            memcpy(a->fatsv->emitted_es_acas_ra, mm->ME, 7);
             writeFATSVEventMessage(mm, "es_acas_ra", mm->ME, 7);
-        } else if (mm->metype == 31 && (mm->mesub == 0 || mm->mesub == 1) && memcmp(mm->ME, a->fatsv_emitted_es_status, 7) != 0) {
+        } else if (mm->metype == 31 && (mm->mesub == 0 || mm->mesub == 1) && memcmp(mm->ME, a->fatsv->emitted_es_status, 7) != 0) {
             // aircraft operational status
-            memcpy(a->fatsv_emitted_es_status, mm->ME, 7);
+            memcpy(a->fatsv->emitted_es_status, mm->ME, 7);
             writeFATSVEventMessage(mm, "es_op_status", mm->ME, 7);
         }
         break;
@@ -2691,38 +2813,38 @@ static void writeFATSV()
         // if it hasn't changed altitude, heading, or speed much,
         // don't update so often
         int changed =
-            (altValid && abs(a->altitude_baro - a->fatsv_emitted_altitude_baro) >= 50) ||
-            (trackDataValid(&a->altitude_geom_valid) && abs(a->altitude_geom - a->fatsv_emitted_altitude_geom) >= 50) ||
-            (trackDataValid(&a->baro_rate_valid) && abs(a->baro_rate - a->fatsv_emitted_baro_rate) > 500) ||
-            (trackDataValid(&a->geom_rate_valid) && abs(a->geom_rate - a->fatsv_emitted_geom_rate) > 500) ||
-            (trackDataValid(&a->track_valid) && heading_difference(a->track, a->fatsv_emitted_track) >= 2) ||
-            (trackDataValid(&a->track_rate_valid) && fabs(a->track_rate - a->fatsv_emitted_track_rate) >= 0.5) ||
-            (trackDataValid(&a->roll_valid) && fabs(a->roll - a->fatsv_emitted_roll) >= 5.0) ||
-            (trackDataValid(&a->mag_heading_valid) && heading_difference(a->mag_heading, a->fatsv_emitted_mag_heading) >= 2) ||
-            (trackDataValid(&a->true_heading_valid) && heading_difference(a->true_heading, a->fatsv_emitted_true_heading) >= 2) ||
-            (gsValid && fabs(a->gs - a->fatsv_emitted_gs) >= 25) ||
-            (trackDataValid(&a->ias_valid) && unsigned_difference(a->ias, a->fatsv_emitted_ias) >= 25) ||
-            (trackDataValid(&a->tas_valid) && unsigned_difference(a->tas, a->fatsv_emitted_tas) >= 25) ||
-            (trackDataValid(&a->mach_valid) && fabs(a->mach - a->fatsv_emitted_mach) >= 0.02);
+            (altValid && abs(a->altitude_baro - a->fatsv->emitted_altitude_baro) >= 50) ||
+            (trackDataValid(&a->altitude_geom_valid) && abs(a->altitude_geom - a->fatsv->emitted_altitude_geom) >= 50) ||
+            (trackDataValid(&a->baro_rate_valid) && abs(a->baro_rate - a->fatsv->emitted_baro_rate) > 500) ||
+            (trackDataValid(&a->geom_rate_valid) && abs(a->geom_rate - a->fatsv->emitted_geom_rate) > 500) ||
+            (trackDataValid(&a->track_valid) && heading_difference(a->track, a->fatsv->emitted_track) >= 2) ||
+            (trackDataValid(&a->track_rate_valid) && fabs(a->track_rate - a->fatsv->emitted_track_rate) >= 0.5) ||
+            (trackDataValid(&a->roll_valid) && fabs(a->roll - a->fatsv->emitted_roll) >= 5.0) ||
+            (trackDataValid(&a->mag_heading_valid) && heading_difference(a->mag_heading, a->fatsv->emitted_mag_heading) >= 2) ||
+            (trackDataValid(&a->true_heading_valid) && heading_difference(a->true_heading, a->fatsv->emitted_true_heading) >= 2) ||
+            (gsValid && fabs(a->gs - a->fatsv->emitted_gs) >= 25) ||
+            (trackDataValid(&a->ias_valid) && unsigned_difference(a->ias, a->fatsv->emitted_ias) >= 25) ||
+            (trackDataValid(&a->tas_valid) && unsigned_difference(a->tas, a->fatsv->emitted_tas) >= 25) ||
+            (trackDataValid(&a->mach_valid) && fabs(a->mach - a->fatsv->emitted_mach) >= 0.02);
 
         int immediate =
-            (trackDataValid(&a->nav_altitude_mcp_valid) && abs(a->nav_altitude_mcp - a->fatsv_emitted_nav_altitude_mcp) > 50) ||
-            (trackDataValid(&a->nav_altitude_fms_valid) && abs(a->nav_altitude_fms - a->fatsv_emitted_nav_altitude_fms) > 50) ||
-            (trackDataValid(&a->nav_altitude_src_valid) && a->nav_altitude_src != a->fatsv_emitted_nav_altitude_src) ||
-            (trackDataValid(&a->nav_heading_valid) && heading_difference(a->nav_heading, a->fatsv_emitted_nav_heading) > 2) ||
-            (trackDataValid(&a->nav_modes_valid) && a->nav_modes != a->fatsv_emitted_nav_modes) ||
-            (trackDataValid(&a->nav_qnh_valid) && fabs(a->nav_qnh - a->fatsv_emitted_nav_qnh) > 0.8) || // 0.8 is the ES message resolution
-            (callsignValid && strcmp(a->callsign, a->fatsv_emitted_callsign) != 0) ||
-            (airgroundValid && a->airground == AG_AIRBORNE && a->fatsv_emitted_airground == AG_GROUND) ||
-            (airgroundValid && a->airground == AG_GROUND && a->fatsv_emitted_airground == AG_AIRBORNE) ||
-            (squawkValid && a->squawk != a->fatsv_emitted_squawk) ||
-            (trackDataValid(&a->emergency_valid) && a->emergency != a->fatsv_emitted_emergency) ||
-            (trackDataValid(&a->mrar_source_valid) && a->mrar_source_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->wind_valid) && a->wind_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->pressure_valid) && a->pressure_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->temperature_valid) && a->temperature_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->turbulence_valid) && a->turbulence_valid.updated > a->fatsv_last_emitted) ||
-            (trackDataValid(&a->humidity_valid) && a->humidity_valid.updated > a->fatsv_last_emitted);
+            (trackDataValid(&a->nav_altitude_mcp_valid) && abs(a->nav_altitude_mcp - a->fatsv->emitted_nav_altitude_mcp) > 50) ||
+            (trackDataValid(&a->nav_altitude_fms_valid) && abs(a->nav_altitude_fms - a->fatsv->emitted_nav_altitude_fms) > 50) ||
+            (trackDataValid(&a->nav_altitude_src_valid) && a->nav_altitude_src != a->fatsv->emitted_nav_altitude_src) ||
+            (trackDataValid(&a->nav_heading_valid) && heading_difference(a->nav_heading, a->fatsv->emitted_nav_heading) > 2) ||
+            (trackDataValid(&a->nav_modes_valid) && a->nav_modes != a->fatsv->emitted_nav_modes) ||
+            (trackDataValid(&a->nav_qnh_valid) && fabs(a->nav_qnh - a->fatsv->emitted_nav_qnh) > 0.8) || // 0.8 is the ES message resolution
+            (callsignValid && strcmp(a->callsign, a->fatsv->emitted_callsign) != 0) ||
+            (airgroundValid && a->airground == AG_AIRBORNE && a->fatsv->emitted_airground == AG_GROUND) ||
+            (airgroundValid && a->airground == AG_GROUND && a->fatsv->emitted_airground == AG_AIRBORNE) ||
+            (squawkValid && a->squawk != a->fatsv->emitted_squawk) ||
+            (trackDataValid(&a->emergency_valid) && a->emergency != a->fatsv->emitted_emergency) ||
+            (trackDataValid(&a->mrar->mrar_source_valid) && a->mrar->mrar_source_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->mrar->wind_valid) && a->mrar->wind_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->mrar->pressure_valid) && a->mrar->pressure_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->mrar->temperature_valid) && a->mrar->temperature_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->mrar->turbulence_valid) && a->mrar->turbulence_valid.updated > a->fatsv_last_emitted) ||
+            (trackDataValid(&a->mrar->humidity_valid) && a->mrar->humidity_valid.updated > a->fatsv_last_emitted);
 
         uint64_t minAge;
         double adjustedMinAge;
@@ -2766,28 +2888,28 @@ static void writeFATSV()
         int forceEmit = (now - a->fatsv_last_force_emit) > 600000;
 
         // these don't change often / at all, only emit when they change
-        if (forceEmit || a->addrtype != a->fatsv_emitted_addrtype) {
+        if (forceEmit || a->addrtype != a->fatsv->emitted_addrtype) {
             p = appendFATSV(p, end, "addrtype", "%s", addrtype_enum_string(a->addrtype));
         }
-        if (forceEmit || a->adsb_version != a->fatsv_emitted_adsb_version) {
+        if (forceEmit || a->adsb_version != a->fatsv->emitted_adsb_version) {
             p = appendFATSV(p, end, "adsb_version", "%d", a->adsb_version);
         }
-        if (forceEmit || a->category != a->fatsv_emitted_category) {
+        if (forceEmit || a->category != a->fatsv->emitted_category) {
             p = appendFATSV(p, end, "category", "%02X", a->category);
         }
-        if (trackDataValid(&a->nac_p_valid) && (forceEmit || a->nac_p != a->fatsv_emitted_nac_p)) {
+        if (trackDataValid(&a->nac_p_valid) && (forceEmit || a->nac_p != a->fatsv->emitted_nac_p)) {
             p = appendFATSVMeta(p, end, "nac_p",       a, &a->nac_p_valid,         "%u",       a->nac_p);
         }
-        if (trackDataValid(&a->nac_v_valid) && (forceEmit || a->nac_v != a->fatsv_emitted_nac_v)) {
+        if (trackDataValid(&a->nac_v_valid) && (forceEmit || a->nac_v != a->fatsv->emitted_nac_v)) {
             p = appendFATSVMeta(p, end, "nac_v",       a, &a->nac_v_valid,         "%u",       a->nac_v);
         }
-        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil != a->fatsv_emitted_sil)) {
+        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil != a->fatsv->emitted_sil)) {
             p = appendFATSVMeta(p, end, "sil",         a, &a->sil_valid,           "%u",       a->sil);
         }
-        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil_type != a->fatsv_emitted_sil_type)) {
+        if (trackDataValid(&a->sil_valid) && (forceEmit || a->sil_type != a->fatsv->emitted_sil_type)) {
             p = appendFATSVMeta(p, end, "sil_type",    a, &a->sil_valid,           "%s",       sil_type_enum_string(a->sil_type));
         }
-        if (trackDataValid(&a->nic_baro_valid) && (forceEmit || a->nic_baro != a->fatsv_emitted_nic_baro)) {
+        if (trackDataValid(&a->nic_baro_valid) && (forceEmit || a->nic_baro != a->fatsv->emitted_nic_baro)) {
             p = appendFATSVMeta(p, end, "nic_baro",    a, &a->nic_baro_valid,      "%u",       (unsigned) a->nic_baro);
         }
 
@@ -2828,13 +2950,13 @@ static void writeFATSV()
         p = appendFATSVMeta(p, end, "nav_modes",   a, &a->nav_modes_valid,      "{%s}", nav_modes_flags_string(a->nav_modes));
         p = appendFATSVMeta(p, end, "nav_qnh",     a, &a->nav_qnh_valid,        "%.1f", a->nav_qnh);
         p = appendFATSVMeta(p, end, "emergency",   a, &a->emergency_valid,      "%s",   emergency_enum_string(a->emergency));
-        p = appendFATSVMeta(p, end, "mrar_source", a, &a->mrar_source_valid,    "%s",   mrar_source_enum_string(a->mrar_source));
-        p = appendFATSVMeta(p, end, "wind_speed",  a, &a->wind_valid,           "%.0f", a->wind_speed);
-        p = appendFATSVMeta(p, end, "wind_dir",    a, &a->wind_valid,           "%.1f", a->wind_dir);
-        p = appendFATSVMeta(p, end, "temperature", a, &a->temperature_valid,    "%.2f", a->temperature);
-        p = appendFATSVMeta(p, end, "pressure",    a, &a->pressure_valid,       "%.0f", a->pressure);
-        p = appendFATSVMeta(p, end, "turbulence",  a, &a->turbulence_valid,     "%s",   hazard_enum_string(a->turbulence));
-        p = appendFATSVMeta(p, end, "humidity",    a, &a->humidity_valid,       "%.0f", a->humidity);
+        p = appendFATSVMeta(p, end, "mrar_source", a, &a->mrar->mrar_source_valid,    "%s",   mrar_source_enum_string(a->mrar->mrar_source));
+        p = appendFATSVMeta(p, end, "wind_speed",  a, &a->mrar->wind_valid,           "%.0f", a->mrar->wind_speed);
+        p = appendFATSVMeta(p, end, "wind_dir",    a, &a->mrar->wind_valid,           "%.1f", a->mrar->wind_dir);
+        p = appendFATSVMeta(p, end, "temperature", a, &a->mrar->temperature_valid,    "%.2f", a->mrar->temperature);
+        p = appendFATSVMeta(p, end, "pressure",    a, &a->mrar->pressure_valid,       "%.0f", a->mrar->pressure);
+        p = appendFATSVMeta(p, end, "turbulence",  a, &a->mrar->turbulence_valid,     "%s",   hazard_enum_string(a->mrar->turbulence));
+        p = appendFATSVMeta(p, end, "humidity",    a, &a->mrar->humidity_valid,       "%.0f", a->mrar->humidity);
 
         // if we didn't get anything interesting, bail out.
         // We don't need to do anything special to unwind prepareWrite().
@@ -2850,37 +2972,37 @@ static void writeFATSV()
         else
             fprintf(stderr, "fatsv: output too large (max %d, overran by %d)\n", TSV_MAX_PACKET_SIZE, (int) (p - end));
 
-        a->fatsv_emitted_altitude_baro = a->altitude_baro;
-        a->fatsv_emitted_altitude_geom = a->altitude_geom;
-        a->fatsv_emitted_baro_rate = a->baro_rate;
-        a->fatsv_emitted_geom_rate = a->geom_rate;
-        a->fatsv_emitted_gs = a->gs;
-        a->fatsv_emitted_ias = a->ias;
-        a->fatsv_emitted_tas = a->tas;
-        a->fatsv_emitted_mach = a->mach;
-        a->fatsv_emitted_track = a->track;
-        a->fatsv_emitted_track_rate = a->track_rate;
-        a->fatsv_emitted_roll = a->roll;
-        a->fatsv_emitted_mag_heading = a->mag_heading;
-        a->fatsv_emitted_true_heading = a->true_heading;
-        a->fatsv_emitted_airground = a->airground;
-        a->fatsv_emitted_nav_altitude_mcp = a->nav_altitude_mcp;
-        a->fatsv_emitted_nav_altitude_fms = a->nav_altitude_fms;
-        a->fatsv_emitted_nav_altitude_src = a->nav_altitude_src;
-        a->fatsv_emitted_nav_heading = a->nav_heading;
-        a->fatsv_emitted_nav_modes = a->nav_modes;
-        a->fatsv_emitted_nav_qnh = a->nav_qnh;
-        memcpy(a->fatsv_emitted_callsign, a->callsign, sizeof(a->fatsv_emitted_callsign));
-        a->fatsv_emitted_addrtype = a->addrtype;
-        a->fatsv_emitted_adsb_version = a->adsb_version;
-        a->fatsv_emitted_category = a->category;
-        a->fatsv_emitted_squawk = a->squawk;
-        a->fatsv_emitted_nac_p = a->nac_p;
-        a->fatsv_emitted_nac_v = a->nac_v;
-        a->fatsv_emitted_sil = a->sil;
-        a->fatsv_emitted_sil_type = a->sil_type;
-        a->fatsv_emitted_nic_baro = a->nic_baro;
-        a->fatsv_emitted_emergency = a->emergency;
+        a->fatsv->emitted_altitude_baro = a->altitude_baro;
+        a->fatsv->emitted_altitude_geom = a->altitude_geom;
+        a->fatsv->emitted_baro_rate = a->baro_rate;
+        a->fatsv->emitted_geom_rate = a->geom_rate;
+        a->fatsv->emitted_gs = a->gs;
+        a->fatsv->emitted_ias = a->ias;
+        a->fatsv->emitted_tas = a->tas;
+        a->fatsv->emitted_mach = a->mach;
+        a->fatsv->emitted_track = a->track;
+        a->fatsv->emitted_track_rate = a->track_rate;
+        a->fatsv->emitted_roll = a->roll;
+        a->fatsv->emitted_mag_heading = a->mag_heading;
+        a->fatsv->emitted_true_heading = a->true_heading;
+        a->fatsv->emitted_airground = a->airground;
+        a->fatsv->emitted_nav_altitude_mcp = a->nav_altitude_mcp;
+        a->fatsv->emitted_nav_altitude_fms = a->nav_altitude_fms;
+        a->fatsv->emitted_nav_altitude_src = a->nav_altitude_src;
+        a->fatsv->emitted_nav_heading = a->nav_heading;
+        a->fatsv->emitted_nav_modes = a->nav_modes;
+        a->fatsv->emitted_nav_qnh = a->nav_qnh;
+        memcpy(a->fatsv->emitted_callsign, a->callsign, sizeof(a->fatsv->emitted_callsign));
+        a->fatsv->emitted_addrtype = a->addrtype;
+        a->fatsv->emitted_adsb_version = a->adsb_version;
+        a->fatsv->emitted_category = a->category;
+        a->fatsv->emitted_squawk = a->squawk;
+        a->fatsv->emitted_nac_p = a->nac_p;
+        a->fatsv->emitted_nac_v = a->nac_v;
+        a->fatsv->emitted_sil = a->sil;
+        a->fatsv->emitted_sil_type = a->sil_type;
+        a->fatsv->emitted_nic_baro = a->nic_baro;
+        a->fatsv->emitted_emergency = a->emergency;
         a->fatsv_last_emitted = now;
         if (forceEmit) {
             a->fatsv_last_force_emit = now;
@@ -18,7 +18,11 @@ double last_tas_ts = 0;
 double last_mach = -1;
 double last_mach_ts = 0;
 
-double angle_difference(double h1, double h2)
+// The input is taken to come from a single aircraft
+static struct commb_history history;
+static bool use_history = true;
+
+static double angle_difference(double h1, double h2)
 {
     float delta = fabs(h1 - h2);
     if (delta > 180.0)
@@ -26,16 +30,13 @@ double angle_difference(double h1, double h2)
     return delta;
 }
 
-void process(double timestamp, const char *line, struct modesMessage *mm)
+static const char *format_name(commb_format_t format)
 {
-    decodeCommB(mm);
-
-    printf("line\t%s\tformat\t", line);
-
-    switch (mm->commb_format) {
-#define EMIT(x) case COMMB_ ## x: printf("%s", #x); break
+    switch (format) {
+#define EMIT(x) case COMMB_ ## x: return #x
         EMIT(UNKNOWN);
         EMIT(AMBIGUOUS);
+        EMIT(NOT_DECODED);
         EMIT(EMPTY_RESPONSE);
         EMIT(DATALINK_CAPS);
         EMIT(GICB_CAPS);
@@ -44,10 +45,22 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
         EMIT(VERTICAL_INTENT);
         EMIT(TRACK_TURN);
         EMIT(HEADING_SPEED);
+        EMIT(MRAR);
+        EMIT(AIRBORNE_POSITION);
 #undef EMIT
     default:
-        printf("%s", "UNHANDLED"); break;
+        return "UNHANDLED";
     }
+}
+
+static void process(double timestamp, const char *line, struct modesMessage *mm)
+{
+    mm->sysTimestampMsg = (uint64_t) (timestamp * 1000);
+    decodeCommB(mm, use_history ? &history : NULL);
+
+    printf("line\t%s\tformat\t", line);
+
+    printf("%s", format_name(mm->commb_format));
 
     int suspicious = 0;
     
@@ -96,16 +109,16 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
         last_gs_ts = timestamp;
     }
     if (mm->ias_valid) {
-        printf("\tias\t%d", mm->ias);
-        if ((timestamp - last_ias_ts) < 10.0 && abs(last_ias - mm->ias) > 50) {
+        printf("\tias\t%u", mm->ias);
+        if ((timestamp - last_ias_ts) < 10.0 && fabs(last_ias - mm->ias) > 50) {
             suspicious = 1;
         }
         last_ias = mm->ias;
         last_ias_ts = timestamp;
     }
     if (mm->tas_valid) {
-        printf("\ttas\t%d", mm->tas);
-        if ((timestamp - last_tas_ts) < 10.0 && abs(last_tas - mm->tas) > 50) {
+        printf("\ttas\t%u", mm->tas);
+        if ((timestamp - last_tas_ts) < 10.0 && fabs(last_tas - mm->tas) > 50) {
             suspicious = 1;
         }
         last_tas = mm->tas;
@@ -113,7 +126,7 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
     }
     if (mm->mach_valid) {
         printf("\tmach\t%.3f", mm->mach);
-        if ((timestamp - last_mach_ts) < 10.0 && abs(last_mach - mm->mach) > 0.1) {
+        if ((timestamp - last_mach_ts) < 10.0 && fabs(last_mach - mm->mach) > 0.1) {
             suspicious = 1;
         }
         last_mach = mm->mach;
@@ -127,11 +140,76 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
     printf("\n");
 }
 
+// Classify the same MB fields repeatedly for (at least) the given number of
+// seconds and report the rate. Only the MB field changes between messages,
+// so that the benchmark measures decodeCommB() rather than memory bandwidth.
+// Each pass is shifted later in time, so the history sees a continuous stream.
+static void benchmark(unsigned char (*mbs)[7], const uint64_t *times, unsigned count, double seconds)
+{
+    static struct modesMessage mmZero;
+    struct modesMessage mm = mmZero;
+    struct timespec start, end;
+    uint64_t classified = 0;
+    double elapsed;
+    unsigned formats[COMMB_AIRBORNE_POSITION + 1] = { 0 };
+
+    uint64_t span = times[count - 1] - times[0] + COMMB_HISTORY_REGISTER_TTL + 1;
+    uint64_t offset = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        for (unsigned i = 0; i < count; ++i) {
+            memcpy(mm.MB, mbs[i], sizeof(mm.MB));
+            mm.sysTimestampMsg = times[i] + offset;
+            decodeCommB(&mm, use_history ? &history : NULL);
+            ++formats[mm.commb_format];
+        }
+        classified += count;
+        offset += span;
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    } while (elapsed < seconds);
+
+    printf("%u distinct messages, %llu classifications in %.2fs: %.0f classifications/second\n",
+           count, (unsigned long long) classified, elapsed, classified / elapsed);
+    for (unsigned i = 0; i <= COMMB_AIRBORNE_POSITION; ++i) {
+        if (formats[i])
+            printf("  %-18s %5.1f%%\n", format_name(i), formats[i] * 100.0 / classified);
+    }
+}
+
+// Usage: decode_comm_b [--no-history] [--benchmark [seconds]] < input
+//
+// Each input line is a timestamp (in seconds) followed by the 14 hex
+// digits of a Comm-B MB field, all from the same aircraft. Without
+// --benchmark, the classification and decoded fields of each line are
+// printed. With --benchmark, all lines are loaded then classified
+// repeatedly, and the rate is reported. --no-history classifies each
+// message on its own, without the per-aircraft history.
 int main(int argc, char **argv)
 {
-    /* unused */ (void)argc;
-    /* unused */ (void)argv;
-    
+    bool benchmark_mode = false;
+    double benchmark_seconds = 5.0;
+    unsigned char (*mbs)[7] = NULL;
+    uint64_t *times = NULL;
+    unsigned count = 0, allocated = 0;
+
+    int argi = 1;
+    if (argi < argc && !strcmp(argv[argi], "--no-history")) {
+        use_history = false;
+        ++argi;
+    }
+    if (argi < argc && !strcmp(argv[argi], "--benchmark")) {
+        benchmark_mode = true;
+        if (++argi < argc)
+            benchmark_seconds = atof(argv[argi++]);
+    }
+    if (argi < argc) {
+        fprintf(stderr, "usage: %s [--no-history] [--benchmark [seconds]] < input\n", argv[0]);
+        return 1;
+    }
+
     char line[1024];
 
     while (fgets(line, sizeof(line), stdin)) {
@@ -162,11 +240,35 @@ int main(int argc, char **argv)
             mm.MB[i] = xvalue;
         }
 
-        process(timestamp, line, &mm);
+        if (benchmark_mode) {
+            if (count == allocated) {
+                allocated = allocated ? allocated * 2 : 1024;
+                if (!(mbs = realloc(mbs, allocated * sizeof(*mbs))) || !(times = realloc(times, allocated * sizeof(*times)))) {
+                    fprintf(stderr, "out of memory\n");
+                    return 1;
+                }
+            }
+            times[count] = (uint64_t) (timestamp * 1000);
+            memcpy(mbs[count++], mm.MB, sizeof(mm.MB));
+        } else {
+            process(timestamp, line, &mm);
+        }
         continue;
 
     bad:
         fprintf(stderr, "failed to scan line: %s", line);
         continue;
     }
+
+    if (benchmark_mode) {
+        if (!count) {
+            fprintf(stderr, "no messages to benchmark\n");
+            return 1;
+        }
+        benchmark(mbs, times, count, benchmark_seconds);
+        free(mbs);
+        free(times);
+    }
+
+    return 0;
 }
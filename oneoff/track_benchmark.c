@@ -0,0 +1,256 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// track_benchmark.c: benchmark for aircraft tracking with many aircraft
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Usage: track_benchmark <beast capture> [aircraft count...]
+//
+// Decodes all Mode S messages from a Beast-format capture, then for each
+// aircraft count (default 100, 1000, 10000) creates that many aircraft and
+// replays the messages through trackUpdateFromMessage(), with the addresses
+// spread across all of the aircraft, and reports messages/second.
+//
+// It then measures the cost of the once-a-second periodic work over the
+// resulting aircraft (trackPeriodicWork), over ten simulated minutes with
+// all aircraft refreshed every ten seconds, and of generating aircraft.json.
+//
+// Each count runs in a separate child process so that it starts with an
+// empty aircraft list.
+
+#include "../dump1090.h"
+
+#include <sys/wait.h>
+
+struct _Modes Modes;
+
+void receiverPositionChanged(float lat, float lon, float alt)
+{
+    /* nothing */
+    (void) lat;
+    (void) lon;
+    (void) alt;
+}
+
+static struct modesMessage *messages;
+static unsigned message_count;
+
+static bool load_capture(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+
+    unsigned allocated = 0;
+    int ch;
+    while ((ch = getc(f)) != EOF) {
+        if (ch != 0x1a)
+            continue;
+
+        unsigned len;
+        switch ((ch = getc(f))) {
+        case '1': len = 2; break;
+        case '2': len = MODES_SHORT_MSG_BYTES; break;
+        case '3': len = MODES_LONG_MSG_BYTES; break;
+        case '4': len = 14; break;
+        default: continue;
+        }
+
+        // 6 bytes timestamp, 1 byte signal, then the message; 0x1a is escaped by doubling
+        unsigned char frame[7 + MODES_LONG_MSG_BYTES];
+        unsigned i;
+        for (i = 0; i < 7 + len; ++i) {
+            int b = getc(f);
+            if (b == 0x1a && (b = getc(f)) != 0x1a)
+                break;
+            if (b == EOF)
+                break;
+            frame[i] = b;
+        }
+        if (i < 7 + len || ch == '1' || ch == '4')
+            continue; // truncated, or not Mode S
+
+        if (message_count == allocated) {
+            allocated = allocated ? allocated * 2 : 4096;
+            if (!(messages = realloc(messages, allocated * sizeof(*messages)))) {
+                fprintf(stderr, "out of memory\n");
+                return false;
+            }
+        }
+
+        struct modesMessage *mm = &messages[message_count];
+        memset(mm, 0, sizeof(*mm));
+        for (unsigned j = 0; j < 6; ++j)
+            mm->timestampMsg = (mm->timestampMsg << 8) | frame[j];
+        mm->signalLevel = (frame[6] / 255.0) * (frame[6] / 255.0);
+
+        if (decodeModesMessage(mm, frame + 7, NULL) < 0 || mm->addr == 0)
+            continue;
+
+        ++message_count;
+    }
+
+    fclose(f);
+    return true;
+}
+
+static double elapsed_since(const struct timespec *start)
+{
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static void create_aircraft(uint32_t base, unsigned aircraft_count, uint64_t now)
+{
+    for (unsigned i = 0; i < aircraft_count; ++i) {
+        struct modesMessage mm;
+        memset(&mm, 0, sizeof(mm));
+        mm.msgtype = 11;
+        mm.addr = base + i;
+        mm.addrtype = ADDR_ADSB_ICAO;
+        mm.sysTimestampMsg = now;
+        trackUpdateFromMessage(&mm);
+    }
+}
+
+static void replay(uint64_t now, uint64_t first_timestamp)
+{
+    for (unsigned i = 0; i < message_count; ++i) {
+        struct modesMessage mm = messages[i];
+        mm.sysTimestampMsg = now + (mm.timestampMsg - first_timestamp) / 12000;
+        trackUpdateFromMessage(&mm);
+    }
+}
+
+static void run(unsigned aircraft_count)
+{
+    const uint32_t base = 0x400000;
+    uint64_t now = mstime();
+    uint64_t first_timestamp = message_count ? messages[0].timestampMsg : 0;
+
+    // create the aircraft
+    create_aircraft(base, aircraft_count, now);
+
+    // spread the captured addresses over all the aircraft
+    for (unsigned i = 0; i < message_count; ++i) {
+        uint32_t a = messages[i].addr;
+        messages[i].addr = base + (a * 2654435761U) % aircraft_count;
+    }
+
+    struct timespec start;
+    uint64_t replayed = 0;
+    uint64_t sim_now = now;
+    double elapsed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    unsigned pass = 0;
+    do {
+        sim_now = now + (pass * 60000);
+        replay(sim_now, first_timestamp);
+        replayed += message_count;
+        ++pass;
+
+        elapsed = elapsed_since(&start);
+    } while (elapsed < 2.0);
+
+    unsigned tracked = 0;
+    for (struct aircraft *a = Modes.aircrafts; a; a = a->next)
+        ++tracked;
+
+    printf("%6u aircraft: %10.0f messages/second (%llu messages in %.2fs, %u aircraft tracked)\n",
+           aircraft_count, replayed / elapsed, (unsigned long long) replayed, elapsed, tracked);
+
+    sim_now += 60000;
+    double periodic = 0;
+    unsigned calls;
+    for (calls = 0; calls < 600; ++calls) {
+        if (calls % 10 == 0) {
+            // untimed: refresh everything so it stays tracked
+            replay(sim_now, first_timestamp);
+            create_aircraft(base, aircraft_count, sim_now);
+        }
+
+        sim_now += 1000;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        trackPeriodicWork(sim_now);
+        periodic += elapsed_since(&start);
+    }
+
+    printf("%6u aircraft: %10.1f us per periodic update\n", aircraft_count, periodic * 1e6 / calls);
+
+    calls = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        int len;
+        free(generateAircraftJson("/data/aircraft.json", &len));
+        ++calls;
+        elapsed = elapsed_since(&start);
+    } while (elapsed < 1.0);
+
+    printf("%6u aircraft: %10.1f us per aircraft.json\n", aircraft_count, elapsed * 1e6 / calls);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <beast capture> [aircraft count...]\n", argv[0]);
+        return 1;
+    }
+
+    Modes.nfix_crc = 1;
+    Modes.fix_df = 1;
+    Modes.quiet = 1;
+    modesChecksumInit(Modes.nfix_crc, NULL);
+    icaoFilterInit();
+    reset_stats(&Modes.stats_current);
+
+    if (!load_capture(argv[1]))
+        return 1;
+
+    if (!message_count) {
+        fprintf(stderr, "%s: no usable Mode S messages found\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(stderr, "%u messages loaded from %s\n", message_count, argv[1]);
+
+    static const unsigned default_counts[] = { 100, 1000, 10000 };
+    unsigned ncounts = (argc > 2 ? (unsigned) argc - 2 : 3);
+
+    for (unsigned i = 0; i < ncounts; ++i) {
+        unsigned count = (argc > 2 ? (unsigned) atoi(argv[i + 2]) : default_counts[i]);
+        if (!count)
+            continue;
+
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pid == 0) {
+            run(count);
+            fflush(stdout);
+            _exit(0);
+        }
+        waitpid(pid, NULL, 0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,389 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// receiver.c: additional receivers sharing one decoder and tracker
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <stdatomic.h>
+
+// Each additional receiver runs a reader thread (the SDR instance, filling
+// the receiver's FIFO) and a demodulator thread (demodulate2400Deferred on
+// each buffer). Demodulated buffers are put on a "done" ring, in sample
+// order, for the main thread to decode and deliver in receiversDeliver();
+// the main thread then returns them to the FIFO. The ring can't overflow, as
+// it holds as many entries as the FIFO has buffers.
+
+struct receiver {
+    char *spec;                    // --receiver argument
+    struct fifo *fifo;             // sample buffers from the SDR instance
+    struct sdr_instance *sdr;      // the SDR instance
+
+    pthread_t reader_thread;
+    pthread_t demod_thread;
+    bool threads_started;
+    atomic_bool reader_done;       // set when the reader thread has returned
+
+    pthread_mutex_t done_mutex;    // protects done_head and done_tail
+    struct mag_buf **done;         // demodulated buffers, indexed modulo done_size
+    unsigned done_size;
+    uint64_t done_head;            // next buffer to deliver
+    uint64_t done_tail;            // next free entry
+
+    unsigned last_message_end;     // demodulate2400DeliverReceiver state
+};
+
+// Index 0, the primary SDR, is unused
+static struct receiver receivers[MODES_MAX_RECEIVERS];
+static atomic_bool receivers_stopping;
+
+// Recently delivered messages, for cross-receiver duplicate suppression.
+// Open addressing with a short linear probe; entries older than the window
+// are free for reuse, and if none are, the oldest probed entry is replaced.
+#define DEDUP_TABLE_SIZE 4096
+#define DEDUP_PROBES 8
+
+struct dedup_entry {
+    uint64_t timestamp;            // sysTimestampMsg of the first copy
+    uint32_t hash;
+    unsigned char len;             // message length in bytes, 0 if unused
+    unsigned char receiver;        // receiver that delivered the first copy
+    unsigned char msg[MODES_LONG_MSG_BYTES];
+};
+
+static struct dedup_entry *dedup_table;
+
+bool receiverAdd(const char *spec)
+{
+    if (Modes.receiver_count + 1 >= MODES_MAX_RECEIVERS) {
+        fprintf(stderr, "--receiver: at most %d additional receivers are supported\n", MODES_MAX_RECEIVERS - 1);
+        return false;
+    }
+
+    char *copy = strdup(spec);
+    if (!copy) {
+        fprintf(stderr, "--receiver: out of memory\n");
+        return false;
+    }
+
+    receivers[++Modes.receiver_count].spec = copy;
+    return true;
+}
+
+const char *receiverName(unsigned id)
+{
+    if (id == 0)
+        return "primary";
+    if (id <= Modes.receiver_count)
+        return receivers[id].spec;
+    return "unknown";
+}
+
+bool receiversOpen(void)
+{
+    if (!Modes.receiver_count)
+        return true;
+
+    if (!(dedup_table = calloc(DEDUP_TABLE_SIZE, sizeof(*dedup_table)))) {
+        fprintf(stderr, "receiversOpen: out of memory\n");
+        return false;
+    }
+
+    for (unsigned id = 1; id <= Modes.receiver_count; ++id) {
+        struct receiver *r = &receivers[id];
+
+        if (!(r->fifo = fifo_create(Modes.fifo_buffers, Modes.fifo_block_samples + Modes.trailing_samples, Modes.trailing_samples))) {
+            fprintf(stderr, "receiver %u (%s): failed to create the sample FIFO\n", id, r->spec);
+            return false;
+        }
+
+        r->done_size = Modes.fifo_buffers;
+        if (!(r->done = calloc(r->done_size, sizeof(*r->done)))) {
+            fprintf(stderr, "receiversOpen: out of memory\n");
+            return false;
+        }
+        pthread_mutex_init(&r->done_mutex, NULL);
+        atomic_init(&r->reader_done, false);
+
+        if (!(r->sdr = sdrOpenInstance(r->spec, r->fifo)))
+            return false;
+    }
+
+    return true;
+}
+
+static void *receiverReaderThread(void *arg)
+{
+    unsigned id = (unsigned) (uintptr_t) arg;
+    struct receiver *r = &receivers[id];
+    char name[16];
+
+    snprintf(name, sizeof(name), "dump1090-sdr%u", id);
+    set_thread_name(name);
+    set_thread_scheduling(name, Modes.reader_cpus, Modes.reader_priority);
+    register_stats_thread(STATS_THREAD_READER);
+
+    sdrRunInstance(r->sdr);
+
+    if (!Modes.exit && !atomic_load(&receivers_stopping))
+        fprintf(stderr, "receiver %u (%s): stopped unexpectedly\n", id, r->spec);
+
+    atomic_store(&r->reader_done, true);
+    return NULL;
+}
+
+static void *receiverDemodThread(void *arg)
+{
+    unsigned id = (unsigned) (uintptr_t) arg;
+    struct receiver *r = &receivers[id];
+    struct demod_state state = { 0 };
+    char name[16];
+
+    snprintf(name, sizeof(name), "dump1090-demod%u", id);
+    set_thread_name(name);
+    set_thread_scheduling(name, Modes.demod_cpus, Modes.demod_priority);
+    register_stats_thread(STATS_THREAD_DEMOD_WORKERS);
+
+    for (;;) {
+        // check this first: if the reader was already done, an empty FIFO
+        // means there is nothing more to come
+        bool reader_done = atomic_load(&r->reader_done);
+        struct mag_buf *buf = fifo_dequeue(r->fifo, 100 /* milliseconds */);
+        if (!buf) {
+            if (reader_done || atomic_load(&receivers_stopping))
+                break;
+            continue;
+        }
+
+        if (!buf->stats)
+            buf->stats = malloc(sizeof(*buf->stats));
+
+        if (buf->stats) {
+            struct timespec start_time;
+
+            reset_stats(buf->stats);
+            add_block_latency(buf->stats, buf);
+            start_cpu_timing(&start_time);
+            demodulate2400Deferred(&state, buf);
+            end_cpu_timing(&start_time, &buf->stats->demod_cpu);
+        } else {
+            fprintf(stderr, "receiverDemodThread: out of memory allocating buffer stats\n");
+            buf->message_count = 0;
+        }
+
+        pthread_mutex_lock(&r->done_mutex);
+        r->done[r->done_tail++ % r->done_size] = buf;
+        pthread_mutex_unlock(&r->done_mutex);
+    }
+
+    free(state.candidates);
+    return NULL;
+}
+
+bool receiversStart(void)
+{
+    for (unsigned id = 1; id <= Modes.receiver_count; ++id) {
+        struct receiver *r = &receivers[id];
+        int err;
+
+        if ((err = pthread_create(&r->reader_thread, NULL, receiverReaderThread, (void *) (uintptr_t) id))) {
+            fprintf(stderr, "receiver %u (%s): pthread_create failed: %s\n", id, r->spec, strerror(err));
+            return false;
+        }
+
+        if ((err = pthread_create(&r->demod_thread, NULL, receiverDemodThread, (void *) (uintptr_t) id))) {
+            fprintf(stderr, "receiver %u (%s): pthread_create failed: %s\n", id, r->spec, strerror(err));
+            sdrStopInstance(r->sdr);
+            fifo_halt(r->fifo);
+            pthread_join(r->reader_thread, NULL);
+            return false;
+        }
+
+        r->threads_started = true;
+    }
+
+    return true;
+}
+
+// Deliver one demodulated buffer from receiver "id", then return it to the FIFO
+static void deliverBuffer(unsigned id, struct mag_buf *buf)
+{
+    struct receiver *r = &receivers[id];
+    struct timespec start_time;
+
+    start_cpu_timing(&start_time);
+    if (buf->stats)
+        add_stats(buf->stats, Modes.demod_stats, Modes.demod_stats);
+    demodulate2400DeliverReceiver(buf, id, &r->last_message_end);
+
+    Modes.demod_stats->samples_processed += buf->validLength - buf->overlap;
+    Modes.demod_stats->samples_dropped += buf->dropped;
+    Modes.demod_stats->receiver_samples_processed[id] += buf->validLength - buf->overlap;
+    Modes.demod_stats->receiver_samples_dropped[id] += buf->dropped;
+    if (buf->dropped)
+        ++Modes.demod_stats->drop_events;
+    end_cpu_timing(&start_time, &Modes.demod_stats->demod_cpu);
+
+    fifo_release(r->fifo, buf);
+}
+
+unsigned receiversDeliver(void)
+{
+    unsigned delivered = 0;
+
+    for (unsigned id = 1; id <= Modes.receiver_count; ++id) {
+        struct receiver *r = &receivers[id];
+        if (!r->done)
+            continue;
+
+        for (;;) {
+            struct mag_buf *buf = NULL;
+
+            pthread_mutex_lock(&r->done_mutex);
+            if (r->done_head != r->done_tail)
+                buf = r->done[r->done_head++ % r->done_size];
+            pthread_mutex_unlock(&r->done_mutex);
+
+            if (!buf)
+                break;
+
+            deliverBuffer(id, buf);
+            ++delivered;
+        }
+    }
+
+    return delivered;
+}
+
+void receiversStop(void)
+{
+    atomic_store(&receivers_stopping, true);
+
+    for (unsigned id = 1; id <= Modes.receiver_count; ++id) {
+        struct receiver *r = &receivers[id];
+        if (!r->threads_started)
+            continue;
+
+        sdrStopInstance(r->sdr);
+        fifo_halt(r->fifo);
+        pthread_join(r->reader_thread, NULL);
+        pthread_join(r->demod_thread, NULL);
+        r->threads_started = false;
+    }
+
+    // anything already demodulated is still worth having
+    receiversDeliver();
+}
+
+void receiversClose(void)
+{
+    for (unsigned id = 1; id <= Modes.receiver_count; ++id) {
+        struct receiver *r = &receivers[id];
+
+        sdrCloseInstance(r->sdr);
+        r->sdr = NULL;
+        fifo_destroy(r->fifo);
+        r->fifo = NULL;
+        if (r->done) {
+            free(r->done);
+            r->done = NULL;
+            pthread_mutex_destroy(&r->done_mutex);
+        }
+    }
+
+    free(dedup_table);
+    dedup_table = NULL;
+}
+
+void receiversTakeFifoStats(struct fifo_stats *stats)
+{
+    for (unsigned id = 1; id <= Modes.receiver_count; ++id) {
+        struct fifo_stats receiver_stats;
+
+        if (!receivers[id].fifo)
+            continue;
+
+        fifo_take_stats(receivers[id].fifo, &receiver_stats);
+        if (receiver_stats.high_water > stats->high_water)
+            stats->high_water = receiver_stats.high_water;
+        stats->overruns += receiver_stats.overruns;
+    }
+}
+
+// FNV-1a
+static uint32_t dedup_hash(const unsigned char *msg, unsigned len)
+{
+    uint32_t hash = 2166136261U;
+    for (unsigned i = 0; i < len; ++i) {
+        hash ^= msg[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+bool receiverDuplicate(const struct modesMessage *mm)
+{
+    unsigned len = mm->msgbits / 8;
+    unsigned id = mm->receiver;
+    uint64_t now = mm->sysTimestampMsg;
+
+    if (!dedup_table || len == 0 || len > MODES_LONG_MSG_BYTES || id >= MODES_MAX_RECEIVERS)
+        return false;
+
+    uint32_t hash = dedup_hash(mm->msg, len);
+    struct dedup_entry *victim = NULL;
+    bool victim_free = false;
+
+    for (unsigned probe = 0; probe < DEDUP_PROBES; ++probe) {
+        struct dedup_entry *entry = &dedup_table[(hash + probe) % DEDUP_TABLE_SIZE];
+
+        // receivers deliver in their own time, so timestamps can go either way
+        uint64_t age = (now > entry->timestamp) ? now - entry->timestamp : entry->timestamp - now;
+        bool live = entry->len && age <= Modes.receiver_dedup_window;
+
+        if (live && entry->hash == hash && entry->len == len && !memcmp(entry->msg, mm->msg, len)) {
+            if (entry->receiver != id) {
+                ++Modes.demod_stats->receiver_duplicates[id];
+                return true;
+            }
+
+            // repeated by the same aircraft, not heard twice: a new message
+            entry->timestamp = now;
+            ++Modes.demod_stats->receiver_accepted[id];
+            return false;
+        }
+
+        // replace the first free (or expired) entry, otherwise the oldest
+        if (!live) {
+            if (!victim_free) {
+                victim = entry;
+                victim_free = true;
+            }
+        } else if (!victim || (!victim_free && entry->timestamp < victim->timestamp)) {
+            victim = entry;
+        }
+    }
+
+    victim->timestamp = now;
+    victim->hash = hash;
+    victim->len = len;
+    victim->receiver = id;
+    memcpy(victim->msg, mm->msg, len);
+
+    ++Modes.demod_stats->receiver_accepted[id];
+    return false;
+}
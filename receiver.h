@@ -0,0 +1,77 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// receiver.h: additional receivers sharing one decoder and tracker
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_RECEIVER_H
+#define DUMP1090_RECEIVER_H
+
+#include <stdbool.h>
+
+// Besides the primary SDR (--device-type etc), dump1090 can read from up to
+// MODES_MAX_RECEIVERS-1 additional receivers given with --receiver. Each
+// additional receiver has its own FIFO, reader thread and demodulator thread;
+// the demodulated messages are decoded and tracked by the main thread, in
+// the same tracker and network outputs as the primary SDR's messages.
+//
+// Receivers are numbered from 0 (the primary SDR); this number is in
+// modesMessage.receiver. A message heard by more than one receiver within
+// Modes.receiver_dedup_window ms is passed on only once.
+//
+// Only the primary SDR provides Mode A/C, adaptive gain and 12MHz
+// timestamps (for MLAT); messages from additional receivers have no 12MHz
+// timestamp.
+
+struct modesMessage;
+struct fifo_stats;
+
+// Add an additional receiver described by "spec" ("<type>[,key=value...]",
+// see sdrOpenInstance). Called while parsing options, before anything is
+// opened. Returns false (having printed an error) if there are too many.
+bool receiverAdd(const char *spec);
+
+// Open all additional receivers. Returns false (having printed an error)
+// on failure.
+bool receiversOpen(void);
+
+// Start the reader and demodulator threads of all additional receivers.
+bool receiversStart(void);
+
+// On the main thread: decode and deliver everything the additional
+// receivers have demodulated so far, without waiting. Returns the number of
+// sample buffers delivered.
+unsigned receiversDeliver(void);
+
+// Stop the additional receivers' threads, then deliver anything they had
+// already demodulated.
+void receiversStop(void);
+
+// Close all additional receivers.
+void receiversClose(void);
+
+// Merge the additional receivers' FIFO stats into *stats, and reset them.
+void receiversTakeFifoStats(struct fifo_stats *stats);
+
+// On the main thread, for a message that passed CRC checks: return true if
+// another receiver already delivered the same message within the
+// deduplication window, so this copy should be discarded.
+bool receiverDuplicate(const struct modesMessage *mm);
+
+// Name of receiver "id", for display: "primary" or the --receiver spec
+const char *receiverName(unsigned id);
+
+#endif
@@ -0,0 +1,215 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// sample_memory.c: allocation of sample and magnitude buffers
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "sample_memory.h"
+#include "dsp/generated/starch.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <dirent.h>
+#endif
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#ifdef STARCH_ALIGNMENT
+_Static_assert(SAMPLE_ALIGNMENT % STARCH_ALIGNMENT == 0, "SAMPLE_ALIGNMENT must be a multiple of STARCH_ALIGNMENT");
+#endif
+
+static bool sample_hugepages;           // try to use huge pages
+static bool sample_lock;                // mlock() sample buffers
+static int sample_cpu = -1;             // place buffers on this CPU's NUMA node, -1 = the allocating thread's
+static size_t sample_hugepage_size;     // huge page size, if sample_hugepages is set
+static bool warned_hugetlb;             // already warned that explicit huge pages are unavailable
+static bool warned_mlock;               // already warned that mlock failed
+
+// Return the system's default huge page size, or 0 if it can't be found
+static size_t default_hugepage_size(void)
+{
+    FILE *f = fopen("/proc/meminfo", "r");
+    if (!f)
+        return 0;
+
+    char line[128];
+    size_t size = 0;
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long kb;
+        if (sscanf(line, "Hugepagesize: %lu kB", &kb) == 1) {
+            size = (size_t) kb * 1024;
+            break;
+        }
+    }
+
+    fclose(f);
+    return size;
+}
+
+void sample_memory_configure(bool hugepages, bool lock, int cpu)
+{
+    sample_hugepages = hugepages;
+    sample_lock = lock;
+    sample_cpu = cpu;
+
+    if (sample_hugepages && !(sample_hugepage_size = default_hugepage_size()))
+        sample_hugepage_size = 2 * 1024 * 1024;
+}
+
+// The size actually mapped for a buffer of "bytes" bytes
+static size_t sample_memory_size(size_t bytes)
+{
+    size_t granule = sample_hugepages ? sample_hugepage_size : (size_t) sysconf(_SC_PAGESIZE);
+    return (bytes + granule - 1) / granule * granule;
+}
+
+#if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind)
+#define SAMPLE_MPOL_PREFERRED 1     // from <numaif.h>, which would need libnuma
+
+// Return the NUMA node of "cpu" (from its nodeN entry in sysfs), or -1
+static int cpu_node(int cpu)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", cpu);
+
+    DIR *dir = opendir(path);
+    if (!dir)
+        return -1;
+
+    int node = -1;
+    struct dirent *entry;
+    while ((entry = readdir(dir))) {
+        if (sscanf(entry->d_name, "node%d", &node) == 1)
+            break;
+        node = -1;
+    }
+
+    closedir(dir);
+    return node;
+}
+
+// Ask for the memory to be placed on the NUMA node of sample_cpu, or of the
+// calling thread
+static void bind_local_node(void *buf, size_t bytes)
+{
+    unsigned cpu, node;
+    if (sample_cpu >= 0) {
+        int n = cpu_node(sample_cpu);
+        if (n < 0)
+            return;
+        node = n;
+    } else if (syscall(SYS_getcpu, &cpu, &node, NULL) < 0) {
+        return;
+    }
+    if (node >= 8 * sizeof(unsigned long))
+        return;
+
+    // If this fails (e.g. no NUMA support), the kernel's default first-touch
+    // placement puts the pages on the allocating thread's node instead
+    unsigned long nodemask = 1UL << node;
+    syscall(SYS_mbind, buf, bytes, SAMPLE_MPOL_PREFERRED, &nodemask, 8 * sizeof(nodemask) + 1, 0);
+}
+#else
+static void bind_local_node(void *buf, size_t bytes)
+{
+    (void) buf;
+    (void) bytes;
+}
+#endif
+
+void sample_memory_prepare(void *buf, size_t bytes)
+{
+#ifdef MADV_HUGEPAGE
+    if (sample_hugepages)
+        madvise(buf, bytes, MADV_HUGEPAGE);
+#endif
+
+    bind_local_node(buf, bytes);
+
+    if (sample_lock && mlock(buf, bytes) < 0 && !warned_mlock) {
+        fprintf(stderr, "sample_memory: could not lock sample buffers into memory: %s (check RLIMIT_MEMLOCK / ulimit -l)\n", strerror(errno));
+        warned_mlock = true;
+    }
+
+    // Fault the pages in now, on this thread, rather than in the sample loops
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    volatile uint8_t *p = buf;
+    for (size_t i = 0; i < bytes; i += page_size)
+        p[i] = p[i];
+}
+
+// Map anonymous memory aligned to "align" bytes (a power of two), so that
+// transparent huge pages can back all of it
+static void *map_aligned(size_t size, size_t align)
+{
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    if (align <= page_size) {
+        void *buf = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return (buf == MAP_FAILED) ? NULL : buf;
+    }
+
+    uint8_t *base = mmap(NULL, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return NULL;
+
+    // Trim the unaligned head and the unused tail
+    uint8_t *buf = (uint8_t *) (((uintptr_t) base + align - 1) & ~(uintptr_t) (align - 1));
+    if (buf > base)
+        munmap(base, buf - base);
+    if (buf + size < base + size + align)
+        munmap(buf + size, (base + size + align) - (buf + size));
+    return buf;
+}
+
+void *sample_memory_alloc(size_t bytes)
+{
+    size_t size = sample_memory_size(bytes);
+    void *buf = NULL;
+
+#ifdef MAP_HUGETLB
+    if (sample_hugepages) {
+        buf = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (buf == MAP_FAILED) {
+            if (!warned_hugetlb) {
+                fprintf(stderr, "sample_memory: no huge pages available (%s), using transparent huge pages instead (reserve some with vm.nr_hugepages)\n", strerror(errno));
+                warned_hugetlb = true;
+            }
+            buf = NULL;
+        }
+    }
+#endif
+
+    if (!buf && !(buf = map_aligned(size, sample_hugepages ? sample_hugepage_size : 0)))
+        return NULL;
+
+    sample_memory_prepare(buf, size);
+    return buf;
+}
+
+void sample_memory_free(void *buf, size_t bytes)
+{
+    if (buf)
+        munmap(buf, sample_memory_size(bytes));
+}
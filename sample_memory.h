@@ -0,0 +1,57 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// sample_memory.h: allocation of sample and magnitude buffers
+//
+// Copyright (c) 2020 FlightAware LLC
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef SAMPLE_MEMORY_H
+#define SAMPLE_MEMORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Sample buffers are aligned to at least this many bytes, so that the
+// aligned starch kernels can be used on them (checked against
+// STARCH_ALIGNMENT in sample_memory.c).
+#define SAMPLE_ALIGNMENT 64
+
+// Sample buffers are used continuously by the reader, conversion and
+// demodulator loops, so they are allocated with mmap rather than malloc:
+// they are page-aligned, placed on the NUMA node of the demodulator's CPU
+// (or of the allocating thread), and faulted in up front. Optionally they use huge pages (explicit huge
+// pages if any are reserved, otherwise transparent huge pages) and are
+// locked into memory.
+
+// Configure how sample buffers are allocated. Call this before allocating any.
+//   hugepages - back sample buffers with huge pages where possible
+//   lock      - lock sample buffers into memory with mlock()
+//   cpu       - place sample buffers on the NUMA node of this CPU, or -1 for
+//               the node of the thread that allocates them
+void sample_memory_configure(bool hugepages, bool lock, int cpu);
+
+// Allocate a zeroed sample buffer of at least "bytes" bytes, aligned to at
+// least SAMPLE_ALIGNMENT. Returns NULL on failure.
+void *sample_memory_alloc(size_t bytes);
+
+// Free a buffer returned by sample_memory_alloc; "bytes" must be the size
+// that was passed to sample_memory_alloc. Does nothing if buf is NULL.
+void sample_memory_free(void *buf, size_t bytes);
+
+// Apply the same placement (huge pages, NUMA node, locking, prefaulting) to
+// sample memory that was mapped some other way, e.g. the FIFO's mirrored ring.
+void sample_memory_prepare(void *buf, size_t bytes);
+
+#endif
@@ -51,6 +51,7 @@ typedef struct {
     int (*getmaxgain)();
     double (*getgaindb)(int);
     int (*setgain)(int);
+    const struct sdr_instance_ops *instances; // NULL if this type can't be an additional receiver
 } sdr_handler;
 
 static void noInitConfig()
@@ -118,27 +119,27 @@ static bool unsupportedOpen()
 
 static sdr_handler sdr_handlers[] = {
 #ifdef ENABLE_RTLSDR
-    { "rtlsdr", SDR_RTLSDR, rtlsdrInitConfig, rtlsdrShowHelp, rtlsdrHandleOption, rtlsdrOpen, rtlsdrRun, rtlsdrStop, rtlsdrClose, rtlsdrGetGain, rtlsdrGetMaxGain, rtlsdrGetGainDb, rtlsdrSetGain },
+    { "rtlsdr", SDR_RTLSDR, rtlsdrInitConfig, rtlsdrShowHelp, rtlsdrHandleOption, rtlsdrOpen, rtlsdrRun, rtlsdrStop, rtlsdrClose, rtlsdrGetGain, rtlsdrGetMaxGain, rtlsdrGetGainDb, rtlsdrSetGain, &rtlsdrInstanceOps },
 #endif
 
 #ifdef ENABLE_BLADERF
-    { "bladerf", SDR_BLADERF, bladeRFInitConfig, bladeRFShowHelp, bladeRFHandleOption, bladeRFOpen, bladeRFRun, noStop, bladeRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "bladerf", SDR_BLADERF, bladeRFInitConfig, bladeRFShowHelp, bladeRFHandleOption, bladeRFOpen, bladeRFRun, noStop, bladeRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain, NULL },
 #endif
 
 #ifdef ENABLE_HACKRF
-    { "hackrf", SDR_HACKRF, hackRFInitConfig, hackRFShowHelp, hackRFHandleOption, hackRFOpen, hackRFRun, noStop, hackRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "hackrf", SDR_HACKRF, hackRFInitConfig, hackRFShowHelp, hackRFHandleOption, hackRFOpen, hackRFRun, noStop, hackRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain, NULL },
 #endif
 #ifdef ENABLE_LIMESDR
-    { "limesdr", SDR_LIMESDR, limesdrInitConfig, limesdrShowHelp, limesdrHandleOption, limesdrOpen, limesdrRun, noStop, limesdrClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "limesdr", SDR_LIMESDR, limesdrInitConfig, limesdrShowHelp, limesdrHandleOption, limesdrOpen, limesdrRun, noStop, limesdrClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain, NULL },
 #endif
 #ifdef ENABLE_SOAPYSDR
-    { "soapy", SDR_SOAPYSDR, soapyInitConfig, soapyShowHelp, soapyHandleOption, soapyOpen, soapyRun, noStop, soapyClose, soapyGetGain, soapyGetMaxGain, soapyGetGainDb, soapySetGain },
+    { "soapy", SDR_SOAPYSDR, soapyInitConfig, soapyShowHelp, soapyHandleOption, soapyOpen, soapyRun, noStop, soapyClose, soapyGetGain, soapyGetMaxGain, soapyGetGainDb, soapySetGain, NULL },
 #endif
 
-    { "none", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, noOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
-    { "ifile", SDR_IFILE, ifileInitConfig, ifileShowHelp, ifileHandleOption, ifileOpen, ifileRun, noStop, ifileClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "none", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, noOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain, NULL },
+    { "ifile", SDR_IFILE, ifileInitConfig, ifileShowHelp, ifileHandleOption, ifileOpen, ifileRun, noStop, ifileClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain, &ifileInstanceOps },
 
-    { NULL, SDR_NONE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL } /* must come last */
+    { NULL, SDR_NONE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL } /* must come last */
 };
 
 void sdrInitConfig()
@@ -195,7 +196,7 @@ bool sdrHandleOption(int argc, char **argv, int *jptr)
 
 static sdr_handler *current_handler()
 {
-    static sdr_handler unsupported_handler = { "unsupported", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, unsupportedOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain };
+    static sdr_handler unsupported_handler = { "unsupported", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, unsupportedOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain, NULL };
 
     for (int i = 0; sdr_handlers[i].name; ++i) {
         if (Modes.sdr_type == sdr_handlers[i].sdr_type) {
@@ -215,6 +216,8 @@ bool sdrOpen()
 void sdrRun()
 {
     set_thread_name("dump1090-sdr");
+    set_thread_scheduling("dump1090-sdr", Modes.reader_cpus, Modes.reader_priority);
+    register_stats_thread(STATS_THREAD_READER);
 
     pthread_mutex_lock(&Modes.reader_cpu_mutex);
     Modes.reader_cpu_accumulator.tv_sec = 0;
@@ -277,3 +280,85 @@ int sdrSetGain(int step)
 }
 
 
+
+struct sdr_instance {
+    const struct sdr_instance_ops *ops;
+    void *state;
+};
+
+struct sdr_instance *sdrOpenInstance(const char *spec, struct fifo *fifo)
+{
+    const char *comma = strchr(spec, ',');
+    size_t type_len = comma ? (size_t) (comma - spec) : strlen(spec);
+    const char *args = comma ? comma + 1 : "";
+
+    sdr_handler *handler = NULL;
+    for (int i = 0; sdr_handlers[i].name; ++i) {
+        if (strlen(sdr_handlers[i].name) == type_len && !strncasecmp(sdr_handlers[i].name, spec, type_len)) {
+            handler = &sdr_handlers[i];
+            break;
+        }
+    }
+
+    if (!handler) {
+        fprintf(stderr, "receiver '%s': SDR type not recognized or not enabled in this build\n", spec);
+        return NULL;
+    }
+
+    if (!handler->instances) {
+        fprintf(stderr, "receiver '%s': SDR type '%s' can only be used as the primary SDR\n", spec, handler->name);
+        return NULL;
+    }
+
+    struct sdr_instance *sdr = calloc(1, sizeof(*sdr));
+    if (!sdr) {
+        fprintf(stderr, "receiver '%s': out of memory\n", spec);
+        return NULL;
+    }
+
+    sdr->ops = handler->instances;
+    if (!(sdr->state = sdr->ops->open(args, fifo))) {
+        free(sdr);
+        return NULL;
+    }
+
+    return sdr;
+}
+
+void sdrRunInstance(struct sdr_instance *sdr)
+{
+    sdr->ops->run(sdr->state);
+}
+
+void sdrStopInstance(struct sdr_instance *sdr)
+{
+    sdr->ops->stop(sdr->state);
+}
+
+void sdrCloseInstance(struct sdr_instance *sdr)
+{
+    if (!sdr)
+        return;
+
+    sdr->ops->close(sdr->state);
+    free(sdr);
+}
+
+bool sdrParseInstanceArgs(const char *args, bool (*handle)(void *ctx, const char *key, const char *value), void *ctx)
+{
+    char *copy = strdup(args);
+    if (!copy)
+        return false;
+
+    bool ok = true;
+    char *saveptr = NULL;
+    for (char *arg = strtok_r(copy, ",", &saveptr); arg && ok; arg = strtok_r(NULL, ",", &saveptr)) {
+        char *value = strchr(arg, '=');
+        if (value)
+            *value++ = 0;
+        ok = handle(ctx, arg, value ? value : "");
+    }
+
+    free(copy);
+    return ok;
+}
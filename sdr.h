@@ -23,6 +23,8 @@
 
 // Common interface to different SDR inputs.
 
+struct fifo;
+
 void sdrInitConfig();
 void sdrShowHelp();
 bool sdrHandleOption(int argc, char **argv, int *jptr);
@@ -42,4 +44,32 @@ void sdrMonitor();
 // Retrieve CPU stats and add new CPU time to *addTo
 void sdrUpdateCPUTime(struct timespec *addTo);
 
+// Additional receivers (--receiver, see receiver.h). Each is an independent
+// instance of an SDR type that supports it, delivering to its own FIFO. Gain
+// control, adaptive gain and reader CPU stats above apply only to the
+// primary SDR.
+
+// Per-type entry points for additional instances
+struct sdr_instance_ops {
+    void *(*open)(const char *args, struct fifo *fifo); // returns driver state, or NULL on failure
+    void (*run)(void *state);    // read samples into the FIFO until stopped (or EOF), on the reader thread
+    void (*stop)(void *state);   // make run() return soon; called from another thread
+    void (*close)(void *state);  // release everything open() allocated
+};
+
+struct sdr_instance;
+
+// Open an additional SDR instance described by "spec", which is an SDR type
+// optionally followed by driver arguments: "<type>[,key=value...]". Samples
+// go to "fifo". Returns NULL (having printed an error) on failure.
+struct sdr_instance *sdrOpenInstance(const char *spec, struct fifo *fifo);
+void sdrRunInstance(struct sdr_instance *sdr);
+void sdrStopInstance(struct sdr_instance *sdr);
+void sdrCloseInstance(struct sdr_instance *sdr);
+
+// Helper for drivers' ops->open: split "key=value,key=value" arguments and
+// call handle() on each pair (value is "" if there is no '='). Stops and
+// returns false if handle() returns false.
+bool sdrParseInstanceArgs(const char *args, bool (*handle)(void *ctx, const char *key, const char *value), void *ctx);
+
 #endif
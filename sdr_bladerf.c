@@ -365,13 +365,13 @@ static void *handle_bladerf_samples(struct bladerf *dev,
 
         if (outbuf && (overrun || (outbuf->validLength + samples_per_block > outbuf->totalLength))) {
             // discontinuity or buffer is full. Push the current buffer and get a new one
-            fifo_enqueue(outbuf);
+            fifo_enqueue(Modes.fifo, outbuf);
             outbuf = NULL;
         }
 
         if (!outbuf) {
             // need a new buffer
-            outbuf = fifo_acquire(/* don't wait */ 0);
+            outbuf = fifo_acquire(Modes.fifo, /* don't wait */ 0);
             if (!outbuf) {
                 // we have nowhere to put this data, drop it. nb: don't update nextTimestamp
                 overrun = true;
@@ -405,7 +405,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
 
     // push the final buffer, if any
     if (outbuf) {
-        fifo_enqueue(outbuf);
+        fifo_enqueue(Modes.fifo, outbuf);
     }
 
     first_buffer = false;
@@ -431,14 +431,14 @@ void bladeRFRun()
                                       &buffers,
                                       /* num_buffers */ transfers,
                                       BLADERF_FORMAT_SC16_Q11_META,
-                                      /* samples_per_buffer */ MODES_MAG_BUF_SAMPLES,
+                                      /* samples_per_buffer */ Modes.fifo_block_samples,
                                       /* num_transfers */ transfers,
                                       /* user_data */ NULL)) < 0) {
         fprintf(stderr, "bladerf_init_stream() failed: %s\n", bladerf_strerror(status));
         goto out;
     }
 
-    unsigned ms_per_transfer = 1000 * MODES_MAG_BUF_SAMPLES / Modes.sample_rate;
+    unsigned ms_per_transfer = 1000 * Modes.fifo_block_samples / Modes.sample_rate;
     if ((status = bladerf_set_stream_timeout(BladeRF.device, BLADERF_MODULE_RX, ms_per_transfer * (transfers + 2))) < 0) {
         fprintf(stderr, "bladerf_set_stream_timeout() failed: %s\n", bladerf_strerror(status));
         goto out;
@@ -126,6 +126,12 @@ bool hackRFOpen()
         return true;
     }
 
+    // libhackrf delivers fixed-size transfers of 256kB (128k samples)
+    if (Modes.fifo_block_samples < 131072) {
+        fprintf(stderr, "HackRF: --fifo-block-size must be at least 131072 samples\n");
+        return false;
+    }
+
     // Calculate sample rate and frequency deviation if ppm is specified
     if (HackRF.ppm != 0) {
         HackRF.rate = (uint32_t)((double)HackRF.rate * (1000000 - HackRF.ppm)/1000000+0.5);
@@ -230,7 +236,7 @@ static int handle_hackrf_samples(hackrf_transfer *transfer)
 
     unsigned samples_read = len / 2; // Drops any trailing odd sample, that's OK
 
-    struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
+    struct mag_buf *outbuf = fifo_acquire(Modes.fifo, 0 /* don't wait */);
     if (!outbuf) {
         // FIFO is full. Drop this block.
         dropped += samples_read;
@@ -268,7 +274,7 @@ static int handle_hackrf_samples(hackrf_transfer *transfer)
     outbuf->validLength = outbuf->overlap + to_convert;
 
     // Push to the demodulation thread
-    fifo_enqueue(outbuf);
+    fifo_enqueue(Modes.fifo, outbuf);
 
     return 0;
 }
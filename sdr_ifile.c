@@ -51,10 +51,13 @@
 #include "dump1090.h"
 #include "sdr_ifile.h"
 
-static struct {
+struct ifile_state {
     const char *filename;
     input_format_t input_format;
     bool throttle;
+    bool primary;                   // false for an additional receiver (--receiver)
+    struct fifo *fifo;              // where samples go
+    atomic_bool stop;               // set by ifileStopInstance
 
     int fd;
     unsigned bytes_per_sample;
@@ -62,19 +65,30 @@ static struct {
     char *readbuf;
     iq_convert_fn converter;
     struct converter_state *converter_state;
-} ifile;
+};
+
+// The primary SDR, configured by the command-line options
+static struct ifile_state ifile;
+
+static void ifile_init(struct ifile_state *state)
+{
+    state->filename = NULL;
+    state->input_format = INPUT_UC8;
+    state->throttle = false;
+    state->primary = false;
+    state->fifo = NULL;
+    atomic_init(&state->stop, false);
+    state->fd = -1;
+    state->bytes_per_sample = 0;
+    state->bufsize = 0;
+    state->readbuf = NULL;
+    state->converter = NULL;
+    state->converter_state = NULL;
+}
 
 void ifileInitConfig(void)
 {
-    ifile.filename = NULL;
-    ifile.input_format = INPUT_UC8;
-    ifile.throttle = false;
-    ifile.fd = -1;
-    ifile.bytes_per_sample = 0;
-    ifile.bufsize = 0;
-    ifile.readbuf = NULL;
-    ifile.converter = NULL;
-    ifile.converter_state = NULL;
+    ifile_init(&ifile);
 }
 
 void ifileShowHelp()
@@ -85,6 +99,24 @@ void ifileShowHelp()
     printf("--iformat <type>         set sample format (UC8, SC16, SC16Q11)\n");
     printf("--throttle               process samples at the original capture speed\n");
     printf("\n");
+    printf("      as an additional receiver: --receiver ifile,file=<path>[,format=<type>][,throttle]\n");
+    printf("\n");
+}
+
+static bool parse_input_format(const char *name, input_format_t *format)
+{
+    if (!strcasecmp(name, "uc8")) {
+        *format = INPUT_UC8;
+    } else if (!strcasecmp(name, "sc16")) {
+        *format = INPUT_SC16;
+    } else if (!strcasecmp(name, "sc16q11")) {
+        *format = INPUT_SC16Q11;
+    } else {
+        fprintf(stderr, "Input format '%s' not understood (supported values: UC8, SC16, SC16Q11)\n", name);
+        return false;
+    }
+
+    return true;
 }
 
 bool ifileHandleOption(int argc, char **argv, int *jptr)
@@ -97,18 +129,8 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
         ifile.filename = strdup(argv[++j]);
         Modes.sdr_type = SDR_IFILE;
     } else if (!strcmp(argv[j],"--iformat") && more) {
-        ++j;
-        if (!strcasecmp(argv[j], "uc8")) {
-            ifile.input_format = INPUT_UC8;
-        } else if (!strcasecmp(argv[j], "sc16")) {
-            ifile.input_format = INPUT_SC16;
-        } else if (!strcasecmp(argv[j], "sc16q11")) {
-            ifile.input_format = INPUT_SC16Q11;
-        } else {
-            fprintf(stderr, "Input format '%s' not understood (supported values: UC8, SC16, SC16Q11)\n",
-                    argv[j]);
+        if (!parse_input_format(argv[++j], &ifile.input_format))
             return false;
-        }
     } else if (!strcmp(argv[j],"--throttle")) {
         ifile.throttle = true;
     } else {
@@ -119,65 +141,74 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
     return true;
 }
 
+static void ifile_close(struct ifile_state *state);
+
 //
 //=========================================================================
 //
 // This is used when --ifile is specified in order to read data from file
 // instead of using an RTLSDR device
 //
-bool ifileOpen(void)
+static bool ifile_open(struct ifile_state *state)
 {
-    if (!ifile.filename) {
+    if (!state->filename) {
         fprintf(stderr, "SDR type 'ifile' requires an --ifile argument\n");
         return false;
     }
 
-    if (!strcmp(ifile.filename, "-")) {
-        ifile.fd = STDIN_FILENO;
-    } else if ((ifile.fd = open(ifile.filename, O_RDONLY)) < 0) {
+    if (!strcmp(state->filename, "-")) {
+        state->fd = STDIN_FILENO;
+    } else if ((state->fd = open(state->filename, O_RDONLY)) < 0) {
         fprintf(stderr, "ifile: could not open %s: %s\n",
-                ifile.filename, strerror(errno));
+                state->filename, strerror(errno));
         return false;
     }
 
-    switch (ifile.input_format) {
+    switch (state->input_format) {
     case INPUT_UC8:
-        ifile.bytes_per_sample = 2;
+        state->bytes_per_sample = 2;
         break;
     case INPUT_SC16:
     case INPUT_SC16Q11:
-        ifile.bytes_per_sample = 4;
+        state->bytes_per_sample = 4;
         break;
     default:
         fprintf(stderr, "ifile: unhandled input format\n");
-        ifileClose();
+        ifile_close(state);
         return false;
     }
 
-    ifile.bufsize = ifile.bytes_per_sample * MODES_MAG_BUF_SAMPLES; /* ~1M samples, about half a second's worth */
+    state->bufsize = state->bytes_per_sample * Modes.fifo_block_samples;
 
-    if (!(ifile.readbuf = malloc(ifile.bufsize))) {
+    if (!(state->readbuf = sample_memory_alloc(state->bufsize))) {
         fprintf(stderr, "ifile: failed to allocate read buffer\n");
-        ifileClose();
+        ifile_close(state);
         return false;
     }
 
-    ifile.converter = init_converter(ifile.input_format,
-                                     Modes.sample_rate,
-                                     Modes.dc_filter,
-                                     &ifile.converter_state);
-    if (!ifile.converter) {
+    state->converter = init_converter(state->input_format,
+                                      Modes.sample_rate,
+                                      Modes.dc_filter,
+                                      &state->converter_state);
+    if (!state->converter) {
         fprintf(stderr, "ifile: can't initialize sample converter\n");
-        ifileClose();
+        ifile_close(state);
         return false;
     }
 
     return true;
 }
 
-void ifileRun()
+bool ifileOpen(void)
+{
+    ifile.primary = true;
+    ifile.fifo = Modes.fifo;
+    return ifile_open(&ifile);
+}
+
+static void ifile_run(struct ifile_state *state)
 {
-    if (ifile.fd < 0)
+    if (state->fd < 0)
         return;
 
     struct timespec next_buffer_delivery;
@@ -186,11 +217,12 @@ void ifileRun()
     bool eof = false;
     uint64_t sampleCounter = 0;
 
-    while (!Modes.exit && !eof) {
-        sdrMonitor();
+    while (!Modes.exit && !atomic_load(&state->stop) && !eof) {
+        if (state->primary)
+            sdrMonitor();
 
         /* wait for up to 1000ms for a buffer */
-        struct mag_buf *outbuf = fifo_acquire(100 /* milliseconds */);
+        struct mag_buf *outbuf = fifo_acquire(state->fifo, 100 /* milliseconds */);
         if (!outbuf) {
             // maybe we're slow, maybe we halted
             continue;
@@ -200,13 +232,13 @@ void ifileRun()
         outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
         outbuf->sysTimestamp = mstime();
 
-        unsigned bytes_wanted = (outbuf->totalLength - outbuf->overlap) * ifile.bytes_per_sample;
-        if (bytes_wanted > ifile.bufsize)
-            bytes_wanted = ifile.bufsize;
+        unsigned bytes_wanted = (outbuf->totalLength - outbuf->overlap) * state->bytes_per_sample;
+        if (bytes_wanted > state->bufsize)
+            bytes_wanted = state->bufsize;
 
         unsigned bytes_read = 0;
         while (bytes_read < bytes_wanted) {
-            ssize_t nread = read(ifile.fd, ifile.readbuf + bytes_read, bytes_wanted - bytes_read);
+            ssize_t nread = read(state->fd, state->readbuf + bytes_read, bytes_wanted - bytes_read);
             if (nread <= 0) {
                 if (nread < 0) {
                     fprintf(stderr, "ifile: error reading input file: %s\n", strerror(errno));
@@ -218,14 +250,14 @@ void ifileRun()
             bytes_read += nread;
         }
 
-        unsigned samples_read = bytes_read / ifile.bytes_per_sample;
+        unsigned samples_read = bytes_read / state->bytes_per_sample;
 
         // Convert the new data
-        ifile.converter(ifile.readbuf, &outbuf->data[outbuf->overlap], samples_read, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+        state->converter(state->readbuf, &outbuf->data[outbuf->overlap], samples_read, state->converter_state, &outbuf->mean_level, &outbuf->mean_power);
         outbuf->validLength = outbuf->overlap + samples_read;
         outbuf->flags = 0;
 
-        if (ifile.throttle || Modes.interactive) {
+        if (state->throttle || Modes.interactive) {
             // Wait until we are allowed to release this buffer to the FIFO
             while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_buffer_delivery, NULL) == EINTR)
                 ;
@@ -235,30 +267,105 @@ void ifileRun()
             normalize_timespec(&next_buffer_delivery);
         }
 
-        // Push the new data to the FIFO
-        fifo_enqueue(outbuf);
+        // Push the new data to the FIFO; the block is delivered now, not
+        // when we started reading it
+        outbuf->deliveryTimestamp = monotonic_ns();
+        fifo_enqueue(state->fifo, outbuf);
         sampleCounter += samples_read;
     }
 
     // Wait for the FIFO to drain so we don't throw away trailing data
-    fifo_drain();
+    fifo_drain(state->fifo);
+}
+
+void ifileRun()
+{
+    ifile_run(&ifile);
+}
+
+static void ifile_close(struct ifile_state *state)
+{
+    if (state->converter) {
+        cleanup_converter(state->converter_state);
+        state->converter = NULL;
+        state->converter_state = NULL;
+    }
+
+    if (state->readbuf) {
+        sample_memory_free(state->readbuf, state->bufsize);
+        state->readbuf = NULL;
+    }
+
+    if (state->fd >= 0 && state->fd != STDIN_FILENO) {
+        close(state->fd);
+        state->fd = -1;
+    }
 }
 
 void ifileClose()
 {
-    if (ifile.converter) {
-        cleanup_converter(ifile.converter_state);
-        ifile.converter = NULL;
-        ifile.converter_state = NULL;
+    ifile_close(&ifile);
+}
+
+//
+// Additional receivers (--receiver ifile,file=...)
+//
+
+static bool ifile_instance_arg(void *ctx, const char *key, const char *value)
+{
+    struct ifile_state *state = ctx;
+
+    if (!strcmp(key, "file") && *value) {
+        free((char *) state->filename);
+        state->filename = strdup(value);
+    } else if (!strcmp(key, "format") && *value) {
+        return parse_input_format(value, &state->input_format);
+    } else if (!strcmp(key, "throttle") && !*value) {
+        state->throttle = true;
+    } else {
+        fprintf(stderr, "ifile: receiver argument '%s' not understood (supported: file=<path>, format=<type>, throttle)\n", key);
+        return false;
     }
 
-    if (ifile.readbuf) {
-        free(ifile.readbuf);
-        ifile.readbuf = NULL;
+    return true;
+}
+
+static void *ifileOpenInstance(const char *args, struct fifo *fifo)
+{
+    struct ifile_state *state = malloc(sizeof(*state));
+    if (!state) {
+        fprintf(stderr, "ifile: out of memory\n");
+        return NULL;
     }
 
-    if (ifile.fd >= 0 && ifile.fd != STDIN_FILENO) {
-        close(ifile.fd);
-        ifile.fd = -1;
+    ifile_init(state);
+    state->fifo = fifo;
+    if (!sdrParseInstanceArgs(args, ifile_instance_arg, state) || !ifile_open(state)) {
+        free((char *) state->filename);
+        free(state);
+        return NULL;
     }
+
+    return state;
+}
+
+static void ifileRunInstance(void *state)
+{
+    ifile_run(state);
 }
+
+static void ifileStopInstance(void *state)
+{
+    atomic_store(&((struct ifile_state *) state)->stop, true);
+}
+
+static void ifileCloseInstance(void *state)
+{
+    ifile_close(state);
+    free((char *) ((struct ifile_state *) state)->filename);
+    free(state);
+}
+
+const struct sdr_instance_ops ifileInstanceOps = {
+    ifileOpenInstance, ifileRunInstance, ifileStopInstance, ifileCloseInstance
+};
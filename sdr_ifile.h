@@ -30,4 +30,6 @@ bool ifileOpen();
 void ifileRun();
 void ifileClose();
 
+extern const struct sdr_instance_ops ifileInstanceOps;
+
 #endif
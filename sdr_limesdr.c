@@ -345,7 +345,7 @@ static void limesdrCallback(unsigned char *buf, uint32_t len, void *ctx)
 
     unsigned samples_read = len / LimeSDR.bytes_in_sample; // Drops any trailing odd sample, not much else we can do there
 
-    struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
+    struct mag_buf *outbuf = fifo_acquire(Modes.fifo, 0 /* don't wait */);
     if (!outbuf) {
         // FIFO is full. Drop this block.
         dropped += samples_read;
@@ -383,7 +383,7 @@ static void limesdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     outbuf->validLength = outbuf->overlap + to_convert;
 
     // Push to the demodulation thread
-    fifo_enqueue(outbuf);
+    fifo_enqueue(Modes.fifo, outbuf);
 }
 
 void limesdrRun()
@@ -392,7 +392,7 @@ void limesdrRun()
         return;
     }
 
-    int16_t *buffer = malloc(MODES_MAG_BUF_SAMPLES * LimeSDR.bytes_in_sample);
+    int16_t *buffer = sample_memory_alloc(Modes.fifo_block_samples * LimeSDR.bytes_in_sample);
     if (!buffer) {
         limesdrLogHandler(LMS_LOG_ERROR, "out of memory allocating sample buffer");
         return;
@@ -401,7 +401,7 @@ void limesdrRun()
     LMS_StartStream(&LimeSDR.stream);
 
     while (!Modes.exit) {
-        int sampleCnt = LMS_RecvStream(&LimeSDR.stream, buffer, MODES_MAG_BUF_SAMPLES, NULL, 1000);
+        int sampleCnt = LMS_RecvStream(&LimeSDR.stream, buffer, Modes.fifo_block_samples, NULL, 1000);
         if (sampleCnt < 0) {
             limesdrLogHandler(LMS_LOG_ERROR, "LMS_RecvStream failed");
             break;
@@ -412,7 +412,7 @@ void limesdrRun()
         }
     }
 
-    free(buffer);
+    sample_memory_free(buffer, Modes.fifo_block_samples * LimeSDR.bytes_in_sample);
     LMS_StopStream(&LimeSDR.stream);
 }
 
@@ -58,35 +58,57 @@
 #  define USE_BOUNCE_BUFFER
 #endif
 
-static struct {
+struct rtlsdr_state {
     rtlsdr_dev_t *dev;
+    const char *device;             // device index or serial number, or NULL for the first device
+    float gain;                     // requested gain in dB, or MODES_DEFAULT_GAIN / MODES_LEGACY_AUTO_GAIN
     bool digital_agc;
     int ppm_error;
     int direct_sampling;
+    bool primary;                   // false for an additional receiver (--receiver)
+    struct fifo *fifo;              // where samples go
+    atomic_bool stop;               // set by rtlsdrStopInstance
+    unsigned dropped;               // samples dropped since the last block delivered to the FIFO
+    uint64_t sampleCounter;         // samples received so far
     uint8_t *bounce_buffer;
     iq_convert_fn converter;
     struct converter_state *converter_state;
     int *gains;
     int gain_steps;
     int current_gain;
-} RTLSDR;
+};
+
+// The primary SDR, configured by the command-line options
+static struct rtlsdr_state RTLSDR;
 
 //
 // =============================== RTLSDR handling ==========================
 //
 
+static void rtlsdr_init(struct rtlsdr_state *state)
+{
+    state->dev = NULL;
+    state->device = NULL;
+    state->gain = MODES_DEFAULT_GAIN;
+    state->digital_agc = false;
+    state->ppm_error = 0;
+    state->direct_sampling = 0;
+    state->primary = false;
+    state->fifo = NULL;
+    atomic_init(&state->stop, false);
+    state->dropped = 0;
+    state->sampleCounter = 0;
+    state->bounce_buffer = NULL;
+    state->converter = NULL;
+    state->converter_state = NULL;
+    state->gains = NULL;
+    state->gain_steps = 0;
+    state->current_gain = 0;
+}
+
 void rtlsdrInitConfig()
 {
-    RTLSDR.dev = NULL;
-    RTLSDR.digital_agc = false;
-    RTLSDR.ppm_error = 0;
-    RTLSDR.direct_sampling = 0;
-    RTLSDR.bounce_buffer = NULL;
-    RTLSDR.converter = NULL;
-    RTLSDR.converter_state = NULL;
-    RTLSDR.gains = NULL;
-    RTLSDR.gain_steps = 0;
-    RTLSDR.current_gain = 0;
+    rtlsdr_init(&RTLSDR);
 }
 
 static void show_rtlsdr_devices()
@@ -158,6 +180,9 @@ void rtlsdrShowHelp()
     printf("--ppm <correction>       set oscillator frequency correction in PPM\n");
     printf("--direct <0|1|2>         set direct sampling mode\n");
     printf("\n");
+    printf("      as an additional receiver: --receiver rtlsdr[,device=<index|serial>][,gain=<db>]\n");
+    printf("                             [,ppm=<correction>][,agc][,direct=<0|1|2>]\n");
+    printf("\n");
 }
 
 bool rtlsdrHandleOption(int argc, char **argv, int *jptr)
@@ -187,7 +212,10 @@ static int sort_gains(const void *left, const void *right)
     return *left_int - *right_int;
 }
 
-bool rtlsdrOpen(void)
+static int rtlsdr_set_gain_step(struct rtlsdr_state *state, int step);
+static void rtlsdr_close_state(struct rtlsdr_state *state);
+
+static bool rtlsdr_open_state(struct rtlsdr_state *state)
 {
     if (!rtlsdr_get_device_count()) {
         fprintf(stderr, "rtlsdr: no supported devices found.\n");
@@ -195,9 +223,9 @@ bool rtlsdrOpen(void)
     }
 
     int dev_index = 0;
-    if (Modes.dev_name) {
-        if ((dev_index = find_device_index(Modes.dev_name)) < 0) {
-            fprintf(stderr, "rtlsdr: no device matching '%s' found.\n", Modes.dev_name);
+    if (state->device) {
+        if ((dev_index = find_device_index((char *) state->device)) < 0) {
+            fprintf(stderr, "rtlsdr: no device matching '%s' found.\n", state->device);
             show_rtlsdr_devices();
             return false;
         }
@@ -215,29 +243,29 @@ bool rtlsdrOpen(void)
             dev_index, rtlsdr_get_device_name(dev_index),
             manufacturer, product, serial);
 
-    if (rtlsdr_open(&RTLSDR.dev, dev_index) < 0) {
+    if (rtlsdr_open(&state->dev, dev_index) < 0) {
         fprintf(stderr, "rtlsdr: error opening the RTLSDR device: %s\n",
             strerror(errno));
         return false;
     }
 
     // Set gain, frequency, sample rate, and reset the device
-    if (RTLSDR.direct_sampling) {
-        fprintf(stderr, "rtlsdr: direct sampling from input %d\n", RTLSDR.direct_sampling);
-        rtlsdr_set_direct_sampling(RTLSDR.dev, RTLSDR.direct_sampling);
-        RTLSDR.gain_steps = 0;
+    if (state->direct_sampling) {
+        fprintf(stderr, "rtlsdr: direct sampling from input %d\n", state->direct_sampling);
+        rtlsdr_set_direct_sampling(state->dev, state->direct_sampling);
+        state->gain_steps = 0;
     } else {
         int *gains;
         int numgains;
 
-        numgains = rtlsdr_get_tuner_gains(RTLSDR.dev, NULL);
+        numgains = rtlsdr_get_tuner_gains(state->dev, NULL);
         if (numgains <= 0) {
             fprintf(stderr, "rtlsdr: error getting tuner gains\n");
             return false;
             }
 
         gains = malloc((numgains + 1) * sizeof(int));
-        if (rtlsdr_get_tuner_gains(RTLSDR.dev, gains) != numgains) {
+        if (rtlsdr_get_tuner_gains(state->dev, gains) != numgains) {
             fprintf(stderr, "rtlsdr: error getting tuner gains\n");
             free(gains);
             return false;
@@ -251,53 +279,66 @@ bool rtlsdrOpen(void)
         // max" gain. :/
         gains[numgains] = gains[numgains-1] + 90; // +9.0dB
 
-        RTLSDR.gain_steps = numgains + 1;
-        RTLSDR.gains = gains;
+        state->gain_steps = numgains + 1;
+        state->gains = gains;
 
         int selected = -1;
-        if (Modes.gain == MODES_LEGACY_AUTO_GAIN) {
+        if (state->gain == MODES_LEGACY_AUTO_GAIN) {
             selected = numgains;
-        } else if (Modes.gain == MODES_DEFAULT_GAIN) {
+        } else if (state->gain == MODES_DEFAULT_GAIN) {
             selected = numgains - 1;
         } else {
             for (int i = 0; i <= numgains; ++i) {
-                if (selected == -1 || fabs(gains[i]/10.0 - Modes.gain) < fabs(gains[selected]/10.0 - Modes.gain))
+                if (selected == -1 || fabs(gains[i]/10.0 - state->gain) < fabs(gains[selected]/10.0 - state->gain))
                     selected = i;
             }
         }
 
-        rtlsdrSetGain(selected);
+        rtlsdr_set_gain_step(state, selected);
     }
 
-    if (RTLSDR.digital_agc) {
+    if (state->digital_agc) {
         fprintf(stderr, "rtlsdr: enabling digital AGC\n");
-        rtlsdr_set_agc_mode(RTLSDR.dev, 1);
+        rtlsdr_set_agc_mode(state->dev, 1);
     }
 
-    rtlsdr_set_freq_correction(RTLSDR.dev, RTLSDR.ppm_error);
-    rtlsdr_set_center_freq(RTLSDR.dev, Modes.freq);
-    rtlsdr_set_sample_rate(RTLSDR.dev, (unsigned)Modes.sample_rate);
+    rtlsdr_set_freq_correction(state->dev, state->ppm_error);
+    rtlsdr_set_center_freq(state->dev, Modes.freq);
+    rtlsdr_set_sample_rate(state->dev, (unsigned)Modes.sample_rate);
 
-    rtlsdr_reset_buffer(RTLSDR.dev);
+    rtlsdr_reset_buffer(state->dev);
 
-    RTLSDR.converter = init_converter(INPUT_UC8,
+    state->converter = init_converter(INPUT_UC8,
                                       Modes.sample_rate,
                                       Modes.dc_filter,
-                                      &RTLSDR.converter_state);
-    if (!RTLSDR.converter) {
+                                      &state->converter_state);
+    if (!state->converter) {
         fprintf(stderr, "rtlsdr: can't initialize sample converter\n");
-        rtlsdrClose();
+        rtlsdr_close_state(state);
         return false;
     }
 
 #ifdef USE_BOUNCE_BUFFER
-    if (!(RTLSDR.bounce_buffer = malloc(MODES_RTL_BUF_SIZE))) {
+    if (!(state->bounce_buffer = sample_memory_alloc(Modes.fifo_block_samples * 2))) {
         fprintf(stderr, "rtlsdr: can't allocate bounce buffer\n");
-        rtlsdrClose();
+        rtlsdr_close_state(state);
         return false;
     }
 #endif
 
+    return true;
+}
+
+bool rtlsdrOpen(void)
+{
+    RTLSDR.device = Modes.dev_name;
+    RTLSDR.gain = Modes.gain;
+    RTLSDR.primary = true;
+    RTLSDR.fifo = Modes.fifo;
+
+    if (!rtlsdr_open_state(&RTLSDR))
+        return false;
+
     if (Modes.adaptive_range_target == 0)
         Modes.adaptive_range_target = 30.0;
     
@@ -306,15 +347,13 @@ bool rtlsdrOpen(void)
 
 static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
 {
-    static unsigned dropped = 0;
-    static uint64_t sampleCounter = 0;
+    struct rtlsdr_state *state = ctx;
 
-    MODES_NOTUSED(ctx);
+    if (state->primary)
+        sdrMonitor();
 
-    sdrMonitor();
-
-    if (Modes.exit) {
-        rtlsdr_cancel_async(RTLSDR.dev); // ask our caller to exit
+    if (Modes.exit || atomic_load(&state->stop)) {
+        rtlsdr_cancel_async(state->dev); // ask our caller to exit
         return;
     }
 
@@ -322,27 +361,27 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     if (!samples_read)
         return; // that wasn't useful
 
-    struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
+    struct mag_buf *outbuf = fifo_acquire(state->fifo, 0 /* don't wait */);
     if (!outbuf) {
         // FIFO is full. Drop this block.
-        dropped += samples_read;
-        sampleCounter += samples_read;
+        state->dropped += samples_read;
+        state->sampleCounter += samples_read;
         return;
     }
 
     outbuf->flags = 0;
 
-    if (dropped) {
+    if (state->dropped) {
         // We previously dropped some samples due to no buffers being available
         outbuf->flags |= MAGBUF_DISCONTINUOUS;
-        outbuf->dropped = dropped;
+        outbuf->dropped = state->dropped;
     }
 
-    dropped = 0;
+    state->dropped = 0;
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
-    sampleCounter += samples_read;
+    outbuf->sampleTimestamp = state->sampleCounter * 12e6 / Modes.sample_rate;
+    state->sampleCounter += samples_read;
 
     // Get the approx system time for the start of this block
     uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
@@ -353,63 +392,79 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     if (to_convert + outbuf->overlap > outbuf->totalLength) {
         // how did that happen?
         to_convert = outbuf->totalLength - outbuf->overlap;
-        dropped = samples_read - to_convert;
+        state->dropped = samples_read - to_convert;
     }
 
 #ifdef USE_BOUNCE_BUFFER
     // Work around zero-copy slowness on Pis with 5.x kernels
-    memcpy(RTLSDR.bounce_buffer, buf, to_convert * 2);
-    buf = RTLSDR.bounce_buffer;
+    memcpy(state->bounce_buffer, buf, to_convert * 2);
+    buf = state->bounce_buffer;
 #endif
 
-    RTLSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+    state->converter(buf, &outbuf->data[outbuf->overlap], to_convert, state->converter_state, &outbuf->mean_level, &outbuf->mean_power);
     outbuf->validLength = outbuf->overlap + to_convert;
 
     // Push to the demodulation thread
-    fifo_enqueue(outbuf);
+    fifo_enqueue(state->fifo, outbuf);
 }
 
-void rtlsdrRun()
+static void rtlsdr_run(struct rtlsdr_state *state)
 {
-    if (!RTLSDR.dev) {
+    if (!state->dev) {
         return;
     }
 
-    rtlsdr_read_async(RTLSDR.dev, rtlsdrCallback, NULL,
+    rtlsdr_read_async(state->dev, rtlsdrCallback, state,
                       /* MODES_RTL_BUFFERS */ 4,
-                      MODES_RTL_BUF_SIZE);
-    if (!Modes.exit) {
+                      Modes.fifo_block_samples * 2); // each sample is 2 bytes
+    if (!Modes.exit && !atomic_load(&state->stop)) {
         fprintf(stderr, "rtlsdr: rtlsdr_read_async returned unexpectedly, probably lost the USB device, bailing out\n");
     }
 }
 
-void rtlsdrStop()
+void rtlsdrRun()
+{
+    rtlsdr_run(&RTLSDR);
+}
+
+static void rtlsdr_stop(struct rtlsdr_state *state)
 {
-    if (!RTLSDR.dev) {
+    if (!state->dev) {
         return;
     }
 
-    rtlsdr_cancel_async(RTLSDR.dev);
+    atomic_store(&state->stop, true);
+    rtlsdr_cancel_async(state->dev);
 }
 
-void rtlsdrClose()
+void rtlsdrStop()
+{
+    rtlsdr_stop(&RTLSDR);
+}
+
+static void rtlsdr_close_state(struct rtlsdr_state *state)
 {
-    if (RTLSDR.dev) {
-        rtlsdr_close(RTLSDR.dev);
-        RTLSDR.dev = NULL;
+    if (state->dev) {
+        rtlsdr_close(state->dev);
+        state->dev = NULL;
     }
 
-    if (RTLSDR.converter) {
-        cleanup_converter(RTLSDR.converter_state);
-        RTLSDR.converter = NULL;
-        RTLSDR.converter_state = NULL;
+    if (state->converter) {
+        cleanup_converter(state->converter_state);
+        state->converter = NULL;
+        state->converter_state = NULL;
     }
 
-    free(RTLSDR.bounce_buffer);
-    RTLSDR.bounce_buffer = NULL;
+    sample_memory_free(state->bounce_buffer, Modes.fifo_block_samples * 2);
+    state->bounce_buffer = NULL;
+
+    free(state->gains);
+    state->gains = NULL;
+}
 
-    free(RTLSDR.gains);
-    RTLSDR.gains = NULL;
+void rtlsdrClose()
+{
+    rtlsdr_close_state(&RTLSDR);
 }
 
 int rtlsdrGetGain()
@@ -434,38 +489,110 @@ double rtlsdrGetGainDb(int step)
     return RTLSDR.gains[step] / 10.0;
 }
 
-int rtlsdrSetGain(int step)
+static int rtlsdr_set_gain_step(struct rtlsdr_state *state, int step)
 {
-    if (!RTLSDR.gains)
+    if (!state->gains)
         return -1;
 
     if (step < 0)
         step = 0;
-    if (step >= RTLSDR.gain_steps)
-        step = RTLSDR.gain_steps - 1;
+    if (step >= state->gain_steps)
+        step = state->gain_steps - 1;
 
-    if (step == RTLSDR.gain_steps - 1) {
-        if (rtlsdr_set_tuner_gain_mode(RTLSDR.dev, 0) < 0) {
+    if (step == state->gain_steps - 1) {
+        if (rtlsdr_set_tuner_gain_mode(state->dev, 0) < 0) {
             fprintf(stderr, "rtlsdr: failed to enable tuner AGC\n");
-            return RTLSDR.current_gain;
+            return state->current_gain;
         }            
 
-        fprintf(stderr, "rtlsdr: tuner gain set to about %.1f dB (gain step %d) (tuner AGC enabled)\n", RTLSDR.gains[step] / 10.0, step);
+        fprintf(stderr, "rtlsdr: tuner gain set to about %.1f dB (gain step %d) (tuner AGC enabled)\n", state->gains[step] / 10.0, step);
     } else {
-        if (rtlsdr_set_tuner_gain_mode(RTLSDR.dev, 1) < 0) {
+        if (rtlsdr_set_tuner_gain_mode(state->dev, 1) < 0) {
             fprintf(stderr, "rtlsdr: failed to disable tuner AGC\n");
-            return RTLSDR.current_gain;
+            return state->current_gain;
         }
 
-        if (rtlsdr_set_tuner_gain(RTLSDR.dev, RTLSDR.gains[step]) < 0) {
-            fprintf(stderr, "rtlsdr: failed to set tuner gain to %.1fdB\n", RTLSDR.gains[step] / 10.0);
-            return RTLSDR.current_gain;
+        if (rtlsdr_set_tuner_gain(state->dev, state->gains[step]) < 0) {
+            fprintf(stderr, "rtlsdr: failed to set tuner gain to %.1fdB\n", state->gains[step] / 10.0);
+            return state->current_gain;
         }
 
-        fprintf(stderr, "rtlsdr: tuner gain set to %.1f dB (gain step %d)\n", RTLSDR.gains[step] / 10.0, step);
+        fprintf(stderr, "rtlsdr: tuner gain set to %.1f dB (gain step %d)\n", state->gains[step] / 10.0, step);
     }
 
-    RTLSDR.current_gain = step;
+    state->current_gain = step;
     return step;
 }
 
+int rtlsdrSetGain(int step)
+{
+    return rtlsdr_set_gain_step(&RTLSDR, step);
+}
+
+//
+// Additional receivers (--receiver rtlsdr,...)
+//
+
+static bool rtlsdr_instance_arg(void *ctx, const char *key, const char *value)
+{
+    struct rtlsdr_state *state = ctx;
+
+    if (!strcmp(key, "device") && *value) {
+        free((char *) state->device);
+        state->device = strdup(value);
+    } else if (!strcmp(key, "gain") && *value) {
+        state->gain = atof(value);
+    } else if (!strcmp(key, "ppm") && *value) {
+        state->ppm_error = atoi(value);
+    } else if (!strcmp(key, "agc") && !*value) {
+        state->digital_agc = true;
+    } else if (!strcmp(key, "direct") && *value) {
+        state->direct_sampling = atoi(value);
+    } else {
+        fprintf(stderr, "rtlsdr: receiver argument '%s' not understood (supported: device=<index|serial>, gain=<db>, ppm=<correction>, agc, direct=<0|1|2>)\n", key);
+        return false;
+    }
+
+    return true;
+}
+
+static void *rtlsdrOpenInstance(const char *args, struct fifo *fifo)
+{
+    struct rtlsdr_state *state = malloc(sizeof(*state));
+    if (!state) {
+        fprintf(stderr, "rtlsdr: out of memory\n");
+        return NULL;
+    }
+
+    rtlsdr_init(state);
+    state->fifo = fifo;
+    if (!sdrParseInstanceArgs(args, rtlsdr_instance_arg, state) || !rtlsdr_open_state(state)) {
+        rtlsdr_close_state(state);
+        free((char *) state->device);
+        free(state);
+        return NULL;
+    }
+
+    return state;
+}
+
+static void rtlsdrRunInstance(void *state)
+{
+    rtlsdr_run(state);
+}
+
+static void rtlsdrStopInstance(void *state)
+{
+    rtlsdr_stop(state);
+}
+
+static void rtlsdrCloseInstance(void *state)
+{
+    rtlsdr_close_state(state);
+    free((char *) ((struct rtlsdr_state *) state)->device);
+    free(state);
+}
+
+const struct sdr_instance_ops rtlsdrInstanceOps = {
+    rtlsdrOpenInstance, rtlsdrRunInstance, rtlsdrStopInstance, rtlsdrCloseInstance
+};
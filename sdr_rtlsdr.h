@@ -33,4 +33,6 @@ int rtlsdrGetMaxGain();
 double rtlsdrGetGainDb(int step);
 int rtlsdrSetGain(int step);
 
+extern const struct sdr_instance_ops rtlsdrInstanceOps;
+
 #endif
@@ -434,8 +434,8 @@ void soapyRun()
     }
 
     uint8_t* buf;
-    const int buffer_elements = MODES_MAG_BUF_SAMPLES; // 131072
-    buf = malloc(buffer_elements * 4);
+    const int buffer_elements = Modes.fifo_block_samples;
+    buf = sample_memory_alloc(buffer_elements * 4);
 
     unsigned int dropped = 0;
     uint64_t sampleCounter = 0;
@@ -449,7 +449,7 @@ void soapyRun()
             return;
         }
 
-        struct mag_buf *outbuf = fifo_acquire(0 /* no wait */);
+        struct mag_buf *outbuf = fifo_acquire(Modes.fifo, 0 /* no wait */);
         if (!outbuf) {
             fprintf(stderr, "soapy: fifo is full, dropping samples\n");
             // FIFO is full. Drop this block.
@@ -488,10 +488,10 @@ void soapyRun()
         outbuf->validLength = outbuf->overlap + to_convert;
 
         // Push to the demodulation thread
-        fifo_enqueue(outbuf);
+        fifo_enqueue(Modes.fifo, outbuf);
     }
 
-    free(buf);
+    sample_memory_free(buf, buffer_elements * 4);
 }
 
 void soapyClose()
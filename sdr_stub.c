@@ -90,3 +90,9 @@ int sdrSetGain(int step)
 }
 
 
+
+const char *receiverName(unsigned id)
+{
+    MODES_NOTUSED(id);
+    return "primary";
+}
@@ -81,6 +81,24 @@ void display_stats(struct stats *st) {
         printf("Local receiver:\n");
         printf("  %12llu samples processed\n",                        (unsigned long long)st->samples_processed);
         printf("  %12llu samples dropped\n",                          (unsigned long long)st->samples_dropped);
+        printf("  %12u sample blocks dropped because the FIFO was full\n", st->fifo_overruns);
+        printf("  %12u sample blocks following dropped samples\n",   st->drop_events);
+        printf("  %12u of %u FIFO buffers used at most\n",           st->fifo_high_water, Modes.fifo_buffers);
+        if (st->block_latency_max > 0)
+            printf("  %.1f / %.1f / %.1f / %.1f ms block latency (50th / 90th / 99th percentile / max)\n",
+                   block_latency_percentile(st, 50),
+                   block_latency_percentile(st, 90),
+                   block_latency_percentile(st, 99),
+                   st->block_latency_max / 1000.0);
+        if (Modes.io_thread_enabled)
+            printf("  %12u decoded messages dropped by I/O thread\n",   st->messages_dropped);
+        for (unsigned r = 0; Modes.receiver_count && r <= Modes.receiver_count; ++r) {
+            printf("  receiver %u: %s\n", r, receiverName(r));
+            printf("    %12llu samples processed\n",                 (unsigned long long)st->receiver_samples_processed[r]);
+            printf("    %12llu samples dropped\n",                   (unsigned long long)st->receiver_samples_dropped[r]);
+            printf("    %12u messages accepted\n",                   st->receiver_accepted[r]);
+            printf("    %12u messages already heard by another receiver\n", st->receiver_duplicates[r]);
+        }
 
         printf("  %12u Mode A/C messages received\n",                 st->demod_modeac);
         printf("  %12u Mode-S message preambles received\n",          st->demod_preambles);
@@ -89,6 +107,9 @@ void display_stats(struct stats *st) {
         printf("    %12u accepted with correct CRC\n",                st->demod_accepted[0]);
         for (j = 1; j <= Modes.nfix_crc; ++j)
             printf("    %12u accepted with %d-bit error repaired\n", st->demod_accepted[j], j);
+        if (st->end > st->start)
+            printf("  %12u CRC computations saved by reusing scoring results (%.0f/s)\n",
+                   st->demod_crc_saved, st->demod_crc_saved * 1000.0 / (st->end - st->start));
 
         if (st->noise_power_sum > 0 && st->noise_power_count > 0) {
             printf("  %5.1f dBFS noise power\n",
@@ -178,6 +199,14 @@ void display_stats(struct stats *st) {
             printf("    %8u DF%u messages\n", st->messages_by_df[i], i);
     }
 
+    if (Modes.forward_only) {
+        printf("  Field decoding skipped (--forward-only), estimated CPU saved:\n");
+        for (unsigned i = 0; i < 32; ++i) {
+            if (st->messages_by_df[i])
+                printf("    %8.1f ms for DF%u messages\n", st->decode_cpu_saved_by_df[i] / 1e6, i);
+        }
+    }
+
     printf("  %8u surface position messages received\n"
            "  %8u airborne position messages received\n"
            "  %8u global CPR attempts with valid positions\n"
@@ -211,6 +240,8 @@ void display_stats(struct stats *st) {
     printf("  %8u unique aircraft tracks\n", st->unique_aircraft);
     printf("  %8u aircraft tracks where only one message was seen\n", st->single_message_aircraft);
     printf("  %8u aircraft tracks which were not marked reliable\n", st->unreliable_aircraft);
+    printf("  %8u messages from untracked aircraft because no aircraft records were available\n", st->aircraft_alloc_failures);
+    printf("  %8u of %u aircraft records in use\n", st->aircraft_slab_used, st->aircraft_slab_capacity);
 
     {
         uint64_t demod_cpu_millis = (uint64_t)st->demod_cpu.tv_sec*1000UL + st->demod_cpu.tv_nsec/1000000UL;
@@ -225,6 +256,30 @@ void display_stats(struct stats *st) {
                (unsigned long long) demod_cpu_millis,
                (unsigned long long) reader_cpu_millis,
                (unsigned long long) background_cpu_millis);
+
+        bool any_threads = false;
+        for (j = 0; j < STATS_THREAD_COUNT; ++j)
+            any_threads = any_threads || st->threads[j].valid;
+
+        if (any_threads) {
+            printf("Threads:         CPU ms  voluntary  involuntary  migrations\n");
+            for (j = 0; j < STATS_THREAD_COUNT; ++j) {
+                const struct thread_stats *t = &st->threads[j];
+                if (!t->valid)
+                    continue;
+
+                char migrations[32] = "-";
+                if (t->migrations_valid)
+                    snprintf(migrations, sizeof(migrations), "%llu", (unsigned long long) t->migrations);
+
+                printf("  %-13s %8llu %10llu %12llu %11s\n",
+                       stats_thread_name(j),
+                       (unsigned long long) t->cpu.tv_sec * 1000ULL + t->cpu.tv_nsec / 1000000,
+                       (unsigned long long) t->voluntary_switches,
+                       (unsigned long long) t->involuntary_switches,
+                       migrations);
+            }
+        }
     }
 
     if (Modes.stats_range_histo)
@@ -300,6 +355,130 @@ static void display_range_histogram(struct stats *st)
     printf("km\n");
 }
 
+// Threads registered for scheduling statistics, and their counters as of the
+// last update_thread_stats()
+#define MAX_STATS_THREADS 64
+static struct {
+    long tid;
+    stats_thread_t kind;
+    struct thread_usage last;
+} stats_threads[MAX_STATS_THREADS];
+static unsigned stats_thread_count;
+static pthread_mutex_t stats_threads_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void register_stats_thread(stats_thread_t kind)
+{
+    long tid = current_thread_id();
+    if (!tid)
+        return;
+
+    pthread_mutex_lock(&stats_threads_mutex);
+    if (stats_thread_count < MAX_STATS_THREADS) {
+        stats_threads[stats_thread_count].tid = tid;
+        stats_threads[stats_thread_count].kind = kind;
+        get_thread_usage(tid, &stats_threads[stats_thread_count].last);
+        ++stats_thread_count;
+    }
+    pthread_mutex_unlock(&stats_threads_mutex);
+}
+
+void update_thread_stats(struct stats *st)
+{
+    pthread_mutex_lock(&stats_threads_mutex);
+    for (unsigned i = 0; i < stats_thread_count; ++i) {
+        struct thread_usage now;
+        if (!get_thread_usage(stats_threads[i].tid, &now)) {
+            // thread has exited; forget it, and reuse its slot
+            stats_threads[i--] = stats_threads[--stats_thread_count];
+            continue;
+        }
+
+        struct thread_usage *last = &stats_threads[i].last;
+        struct thread_stats *t = &st->threads[stats_threads[i].kind];
+        struct timespec cpu = { now.cpu.tv_sec - last->cpu.tv_sec, now.cpu.tv_nsec - last->cpu.tv_nsec };
+        normalize_timespec(&cpu);
+
+        t->valid = true;
+        t->migrations_valid = t->migrations_valid || now.migrations_valid;
+        add_timespecs(&t->cpu, &cpu, &t->cpu);
+        t->voluntary_switches += now.voluntary_switches - last->voluntary_switches;
+        t->involuntary_switches += now.involuntary_switches - last->involuntary_switches;
+        t->migrations += now.migrations - last->migrations;
+
+        *last = now;
+    }
+    pthread_mutex_unlock(&stats_threads_mutex);
+}
+
+const char *stats_thread_name(stats_thread_t kind)
+{
+    switch (kind) {
+    case STATS_THREAD_READER: return "reader";
+    case STATS_THREAD_DEMOD: return "demod";
+    case STATS_THREAD_DEMOD_WORKERS: return "demod_workers";
+    case STATS_THREAD_IO: return "io";
+    default: return "unknown";
+    }
+}
+
+// Block latency histogram buckets, in microseconds: the first four buckets
+// are 0, 1, 2 and 3us, then each doubling of latency is split into four
+// equal buckets (4us, 5us, 6us, 7us, 8-9us, 10-11us, ...). The last bucket
+// also counts everything beyond it (about 2s).
+static unsigned block_latency_bucket(uint64_t us)
+{
+    if (us < 4)
+        return us;
+
+    unsigned msb = 63 - __builtin_clzll(us);
+    unsigned bucket = 4 * (msb - 1) + ((us >> (msb - 2)) & 3);
+    return bucket < STATS_LATENCY_BUCKETS ? bucket : STATS_LATENCY_BUCKETS - 1;
+}
+
+// The (exclusive) upper limit of a latency bucket, in microseconds
+static uint64_t block_latency_bucket_limit(unsigned bucket)
+{
+    if (bucket < 4)
+        return bucket + 1;
+
+    unsigned msb = bucket / 4 + 1;
+    return (uint64_t) (4 + bucket % 4 + 1) << (msb - 2);
+}
+
+void add_block_latency(struct stats *st, const struct mag_buf *buf)
+{
+    uint64_t us = (monotonic_ns() - buf->deliveryTimestamp) / 1000;
+
+    ++st->block_latency[block_latency_bucket(us)];
+    if (us > st->block_latency_max)
+        st->block_latency_max = us > UINT32_MAX ? UINT32_MAX : us;
+}
+
+double block_latency_percentile(const struct stats *st, unsigned percentile)
+{
+    uint64_t total = 0;
+    for (unsigned i = 0; i < STATS_LATENCY_BUCKETS; ++i)
+        total += st->block_latency[i];
+    if (!total)
+        return 0;
+
+    // Report the upper limit of the bucket holding the percentile, but
+    // never more than the largest latency actually seen
+    uint64_t rank = (total * percentile + 99) / 100;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < STATS_LATENCY_BUCKETS; ++i) {
+        seen += st->block_latency[i];
+        if (seen >= rank && seen > 0) {
+            uint64_t limit = block_latency_bucket_limit(i);
+            if (i == STATS_LATENCY_BUCKETS - 1 || limit > st->block_latency_max)
+                limit = st->block_latency_max;
+            return limit / 1000.0;
+        }
+    }
+
+    return st->block_latency_max / 1000.0;
+}
+
 void reset_stats(struct stats *st) {
     static struct stats st_zero;
     *st = st_zero;
@@ -332,16 +511,42 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->demod_rejected_unknown_icao = st1->demod_rejected_unknown_icao + st2->demod_rejected_unknown_icao;
     for (i = 0; i < MODES_MAX_BITERRORS+1; ++i)
         target->demod_accepted[i]  = st1->demod_accepted[i] + st2->demod_accepted[i];
+    target->demod_crc_saved = st1->demod_crc_saved + st2->demod_crc_saved;
     target->demod_modeac = st1->demod_modeac + st2->demod_modeac;
 
     target->samples_processed = st1->samples_processed + st2->samples_processed;
     target->samples_dropped = st1->samples_dropped + st2->samples_dropped;
+    target->messages_dropped = st1->messages_dropped + st2->messages_dropped;
+
+    // FIFO
+    target->fifo_high_water = (st1->fifo_high_water > st2->fifo_high_water) ? st1->fifo_high_water : st2->fifo_high_water;
+    target->fifo_overruns = st1->fifo_overruns + st2->fifo_overruns;
+    target->drop_events = st1->drop_events + st2->drop_events;
+    for (i = 0; i < MODES_MAX_RECEIVERS; ++i) {
+        target->receiver_samples_processed[i] = st1->receiver_samples_processed[i] + st2->receiver_samples_processed[i];
+        target->receiver_samples_dropped[i] = st1->receiver_samples_dropped[i] + st2->receiver_samples_dropped[i];
+        target->receiver_accepted[i] = st1->receiver_accepted[i] + st2->receiver_accepted[i];
+        target->receiver_duplicates[i] = st1->receiver_duplicates[i] + st2->receiver_duplicates[i];
+    }
+    for (i = 0; i < STATS_LATENCY_BUCKETS; ++i)
+        target->block_latency[i] = st1->block_latency[i] + st2->block_latency[i];
+    target->block_latency_max = (st1->block_latency_max > st2->block_latency_max) ? st1->block_latency_max : st2->block_latency_max;
 
     target->sdr_gain = newer->sdr_gain;
 
     add_timespecs(&st1->demod_cpu, &st2->demod_cpu, &target->demod_cpu);
     add_timespecs(&st1->reader_cpu, &st2->reader_cpu, &target->reader_cpu);
     add_timespecs(&st1->background_cpu, &st2->background_cpu, &target->background_cpu);
+    for (i = 0; i < STATS_THREAD_COUNT; ++i) {
+        const struct thread_stats *t1 = &st1->threads[i], *t2 = &st2->threads[i];
+        struct thread_stats *t = &target->threads[i];
+        t->valid = t1->valid || t2->valid;
+        t->migrations_valid = t1->migrations_valid || t2->migrations_valid;
+        add_timespecs(&t1->cpu, &t2->cpu, &t->cpu);
+        t->voluntary_switches = t1->voluntary_switches + t2->voluntary_switches;
+        t->involuntary_switches = t1->involuntary_switches + t2->involuntary_switches;
+        t->migrations = t1->migrations + t2->migrations;
+    }
 
     // noise power:
     target->noise_power_sum = st1->noise_power_sum + st2->noise_power_sum;
@@ -370,8 +575,10 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
 
     // total messages:
     target->messages_total = st1->messages_total + st2->messages_total;
-    for (i = 0; i < 32; ++i)
+    for (i = 0; i < 32; ++i) {
         target->messages_by_df[i] = st1->messages_by_df[i] + st2->messages_by_df[i];
+        target->decode_cpu_saved_by_df[i] = st1->decode_cpu_saved_by_df[i] + st2->decode_cpu_saved_by_df[i];
+    }
 
     // CPR decoding:
     target->cpr_surface = st1->cpr_surface + st2->cpr_surface;
@@ -395,6 +602,9 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->unique_aircraft = st1->unique_aircraft + st2->unique_aircraft;
     target->single_message_aircraft = st1->single_message_aircraft + st2->single_message_aircraft;
     target->unreliable_aircraft = st1->unreliable_aircraft + st2->unreliable_aircraft;
+    target->aircraft_alloc_failures = st1->aircraft_alloc_failures + st2->aircraft_alloc_failures;
+    target->aircraft_slab_capacity = newer->aircraft_slab_capacity;
+    target->aircraft_slab_used = newer->aircraft_slab_used;
 
     // range histogram
     for (i = 0; i < RANGE_BUCKET_COUNT; ++i)
@@ -51,6 +51,25 @@
 #ifndef DUMP1090_STATS_H
 #define DUMP1090_STATS_H
 
+// Threads whose scheduling is measured, see register_stats_thread()
+typedef enum {
+    STATS_THREAD_READER,        // SDR reader threads, combined
+    STATS_THREAD_DEMOD,         // main thread: demodulation, and background tasks without --io-thread
+    STATS_THREAD_DEMOD_WORKERS, // --demod-threads workers and --receiver demodulator threads, combined
+    STATS_THREAD_IO,            // --io-thread
+    STATS_THREAD_COUNT
+} stats_thread_t;
+
+// Scheduler counters for one kind of thread
+struct thread_stats {
+    bool valid;                     // true if a thread of this kind was measured
+    bool migrations_valid;          // true if the kernel reported migrations
+    struct timespec cpu;            // CPU time used
+    uint64_t voluntary_switches;    // context switches while waiting for something
+    uint64_t involuntary_switches;  // context switches because the thread was preempted
+    uint64_t migrations;            // moves from one CPU to another
+};
+
 struct stats {
     uint64_t start;
     uint64_t end;
@@ -60,6 +79,7 @@ struct stats {
     uint32_t demod_rejected_bad;
     uint32_t demod_rejected_unknown_icao;
     uint32_t demod_accepted[MODES_MAX_BITERRORS+1];
+    uint32_t demod_crc_saved;   // CRC computations avoided by decoding from the scoring results
 
     // Mode A/C demodulator counts:
     uint32_t demod_modeac;
@@ -67,6 +87,27 @@ struct stats {
     uint64_t samples_processed;
     uint64_t samples_dropped;
 
+    // decoded messages dropped because the I/O thread fell behind (--io-thread)
+    uint32_t messages_dropped;
+
+    // SDR to demodulator FIFO:
+    uint32_t fifo_high_water;   // most sample blocks queued at once
+    uint32_t fifo_overruns;     // sample blocks dropped by the SDR because the FIFO was full
+    uint32_t drop_events;       // blocks that followed dropped samples, for any reason
+
+    // per-receiver counts, indexed by receiver (0 = the primary SDR, N = the Nth --receiver);
+    // the totals above include every receiver
+    uint64_t receiver_samples_processed[MODES_MAX_RECEIVERS];
+    uint64_t receiver_samples_dropped[MODES_MAX_RECEIVERS];
+    uint32_t receiver_accepted[MODES_MAX_RECEIVERS];   // messages passed on for decoding
+    uint32_t receiver_duplicates[MODES_MAX_RECEIVERS]; // messages discarded as another receiver had already passed them on
+
+    // latency from the SDR delivering a block to its demodulation starting,
+    // as a histogram with four buckets per doubling of latency (see stats.c)
+#define STATS_LATENCY_BUCKETS 80
+    uint32_t block_latency[STATS_LATENCY_BUCKETS];
+    uint32_t block_latency_max;  // us
+
     // SDR settings:
     int sdr_gain;  // current gain step in use
 
@@ -74,6 +115,7 @@ struct stats {
     struct timespec demod_cpu;
     struct timespec reader_cpu;
     struct timespec background_cpu;
+    struct thread_stats threads[STATS_THREAD_COUNT];
 
     // noise floor:
     double noise_power_sum;
@@ -100,6 +142,8 @@ struct stats {
     uint32_t messages_total;
     // .. divided by DF
     uint32_t messages_by_df[32];
+    // estimated CPU time (ns) saved by not decoding message fields (--forward-only), by DF
+    uint64_t decode_cpu_saved_by_df[32];
 
     // CPR decoding:
     unsigned int cpr_surface;
@@ -128,6 +172,11 @@ struct stats {
     unsigned int single_message_aircraft;
     // we never considered the track reliable
     unsigned int unreliable_aircraft;
+    // messages from new aircraft we couldn't track because of --track-max or lack of memory
+    unsigned int aircraft_alloc_failures;
+    // aircraft record slab occupancy, as of the end of this period
+    unsigned int aircraft_slab_capacity;
+    unsigned int aircraft_slab_used;
 
     // range histogram
 #define RANGE_BUCKET_COUNT 76
@@ -148,6 +197,24 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
 void display_stats(struct stats *st);
 void reset_stats(struct stats *st);
 
+// Register the calling thread for scheduling statistics
+void register_stats_thread(stats_thread_t kind);
+
+// Add the scheduler counters of all registered threads, accumulated since
+// the last call, to st
+void update_thread_stats(struct stats *st);
+
+// Short name of a kind of thread, for display and json
+const char *stats_thread_name(stats_thread_t kind);
+
+// Record the latency of a sample block that is about to be demodulated
+struct mag_buf;
+void add_block_latency(struct stats *st, const struct mag_buf *buf);
+
+// Return the given percentile of block latency, in milliseconds, or 0 if no
+// blocks were recorded. The result is accurate to within 25%.
+double block_latency_percentile(const struct stats *st, unsigned percentile);
+
 void add_timespecs(const struct timespec *x, const struct timespec *y, struct timespec *z);
 
 #endif
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+
+# Generate gillham_tables.c: lookup tables for the 13-bit Mode S identity
+# (ID13) and altitude (AC13 / AC12) fields, and for Mode A <-> Mode C.
+#
+# usage: tools/gillham-tables.py > gillham_tables.c
+#
+# gillhamtests checks the generated tables against the original
+# bit-by-bit decoders.
+
+INVALID_ALTITUDE = -9999
+
+# ID13 / AC13 with the X/M bit (0x0040) removed, as a 12-bit index
+def index_to_field13(index):
+    return ((index & 0x0FC0) << 1) | (index & 0x003F)
+
+# Mode A (hex-encoded, 0xABCD) from a 12-bit octal index, as indexToModeA() in track.h
+def index_to_mode_a(index):
+    return (index & 0o007) | ((index & 0o070) << 1) | ((index & 0o700) << 2) | ((index & 0o7000) << 3)
+
+# ID13 field bits C1-A1-C2-A2-C4-A4-X-B1-D1-B2-D2-B4-D4 to hex-encoded Mode A
+def decode_id13(field):
+    bits = [
+        (0x1000, 0x0010),   # C1
+        (0x0800, 0x1000),   # A1
+        (0x0400, 0x0020),   # C2
+        (0x0200, 0x2000),   # A2
+        (0x0100, 0x0040),   # C4
+        (0x0080, 0x4000),   # A4
+        (0x0020, 0x0100),   # B1
+        (0x0010, 0x0001),   # D1
+        (0x0008, 0x0200),   # B2
+        (0x0004, 0x0002),   # D2
+        (0x0002, 0x0400),   # B4
+        (0x0001, 0x0004),   # D4
+    ]
+    result = 0
+    for field_bit, mode_a_bit in bits:
+        if field & field_bit:
+            result |= mode_a_bit
+    return result
+
+# Gillham-coded Mode A to Mode C (signed multiple of 100 ft), or INVALID_ALTITUDE
+def mode_a_to_mode_c(mode_a):
+    if (mode_a & 0xFFFF8889) != 0 or (mode_a & 0x00F0) == 0:
+        return INVALID_ALTITUDE  # zero bits must be zero, D1 set is illegal, C1..C4 cannot be zero
+
+    one_hundreds = 0
+    if mode_a & 0x0010: one_hundreds ^= 0x007  # C1
+    if mode_a & 0x0020: one_hundreds ^= 0x003  # C2
+    if mode_a & 0x0040: one_hundreds ^= 0x001  # C4
+
+    # Remove 7s from OneHundreds (make 7->5, and 5->7)
+    if (one_hundreds & 5) == 5:
+        one_hundreds ^= 2
+
+    # only 1 to 5 are valid
+    if one_hundreds > 5:
+        return INVALID_ALTITUDE
+
+    five_hundreds = 0
+    if mode_a & 0x0002: five_hundreds ^= 0x0FF  # D2
+    if mode_a & 0x0004: five_hundreds ^= 0x07F  # D4
+    if mode_a & 0x1000: five_hundreds ^= 0x03F  # A1
+    if mode_a & 0x2000: five_hundreds ^= 0x01F  # A2
+    if mode_a & 0x4000: five_hundreds ^= 0x00F  # A4
+    if mode_a & 0x0100: five_hundreds ^= 0x007  # B1
+    if mode_a & 0x0200: five_hundreds ^= 0x003  # B2
+    if mode_a & 0x0400: five_hundreds ^= 0x001  # B4
+
+    # correct order of OneHundreds
+    if five_hundreds & 1:
+        one_hundreds = 6 - one_hundreds
+
+    return five_hundreds * 5 + one_hundreds - 13
+
+# AC13 with M=0, as a 12-bit index, to altitude in feet (or INVALID_ALTITUDE)
+def decode_ac12(index):
+    field = index_to_field13(index)
+    if field & 0x0010:
+        # Q=1: 25ft encoding of the 11 bits left after removing Q (and M)
+        n = ((field & 0x1F80) >> 2) | ((field & 0x0020) >> 1) | (field & 0x000F)
+        return n * 25 - 1000
+
+    n = mode_a_to_mode_c(decode_id13(field))
+    if n < -12:
+        return INVALID_ALTITUDE
+    return n * 100
+
+def emit(ctype, name, comment, values, width):
+    print(f'// {comment}')
+    print(f'const {ctype} {name}[{len(values)}] = {{')
+    for i in range(0, len(values), 16):
+        print('    ' + ', '.join(f'{v:{width}}' for v in values[i:i+16]) + ',')
+    print('};')
+    print()
+
+squawk = [decode_id13(index_to_field13(i)) for i in range(4096)]
+altitude = [decode_ac12(i) for i in range(4096)]
+mode_c = [mode_a_to_mode_c(index_to_mode_a(i)) for i in range(4096)]
+
+mode_a = [0] * 4096
+for i in range(4096):
+    if mode_c[i] != INVALID_ALTITUDE:
+        assert mode_a[mode_c[i] + 13] == 0
+        mode_a[mode_c[i] + 13] = index_to_mode_a(i)
+
+print('// Part of dump1090, a Mode S message decoder for RTLSDR devices.')
+print('//')
+print('// gillham_tables.c: Gillham / identity decoding lookup tables')
+print('//')
+print('// Generated by tools/gillham-tables.py - do not edit.')
+print()
+print('#include "dump1090.h"')
+print()
+emit('uint16_t', 'gillham_squawk', 'ID13 field without the X bit (see gillhamIndex) -> hex-encoded squawk',
+     [f'0x{v:04x}' for v in squawk], 6)
+emit('int32_t', 'gillham_altitude', 'AC13 field without the M bit (see gillhamIndex), or AC12 field -> altitude in feet, or INVALID_ALTITUDE',
+     altitude, 6)
+emit('int16_t', 'gillham_mode_a_to_c', 'modeAToIndex(Mode A) -> Mode C (signed multiple of 100 ft), or INVALID_ALTITUDE',
+     mode_c, 6)
+emit('uint16_t', 'gillham_mode_c_to_a', 'Mode C + 13 -> Mode A, or 0 if not a valid Mode C value',
+     [f'0x{v:04x}' for v in mode_a], 6)
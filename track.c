@@ -57,17 +57,281 @@ uint32_t modeAC_lastcount[4096];
 uint32_t modeAC_match[4096];
 uint32_t modeAC_age[4096];
 
+// Aircraft records are allocated in slabs and recycled through a freelist,
+// never returned to the system, so memory use stays at the high-water mark
+// rather than churning as (mostly noise) addresses come and go.
+//
+// Each slab also carries the rarely-used side records (FATSV shadow state,
+// MRAR data, Comm-B history) for its aircraft in separate arrays, so the
+// aircraft records themselves stay packed together for the periodic scans.
+
+#define AIRCRAFT_SLAB_RECORDS 256      // records per slab when growing beyond the preallocation
+
+struct aircraft_slab {
+    struct aircraft_slab *next;        // next slab in aircraft_slabs
+    struct aircraft_mrar *mrar;        // side records, parallel to records[]
+    struct commb_history *commb;       // side records, parallel to records[]
+    struct aircraft_fatsv *fatsv;      // side records, parallel to records[]
+    struct aircraft records[];
+};
+
+static struct aircraft_slab *aircraft_slabs;  // all allocated slabs
+static struct aircraft *aircraft_freelist;    // free records, linked via 'next'
+static unsigned aircraft_slab_capacity;       // total records in all slabs
+static unsigned aircraft_slab_used;           // records currently in use
+
+// Allocate a new slab of 'count' records and add them to the freelist
+static bool aircraftSlabGrow(unsigned count)
+{
+    // one allocation: header, aircraft records, then the side records
+    // (struct aircraft, struct aircraft_mrar and struct commb_history are all
+    // multiples of 8 bytes in size, so everything stays aligned)
+    struct aircraft_slab *slab = malloc(sizeof(*slab) +
+                                        count * (sizeof(struct aircraft) + sizeof(struct aircraft_mrar) + sizeof(struct commb_history) + sizeof(struct aircraft_fatsv)));
+    if (!slab)
+        return false;
+
+    slab->next = aircraft_slabs;
+    slab->mrar = (struct aircraft_mrar *) &slab->records[count];
+    slab->commb = (struct commb_history *) &slab->mrar[count];
+    slab->fatsv = (struct aircraft_fatsv *) &slab->commb[count];
+    aircraft_slabs = slab;
+
+    for (unsigned i = count; i > 0; --i) {
+        struct aircraft *a = &slab->records[i - 1];
+        a->mrar = &slab->mrar[i - 1];
+        a->fatsv = &slab->fatsv[i - 1];
+        a->commb = &slab->commb[i - 1];
+        a->next = aircraft_freelist;
+        aircraft_freelist = a;
+    }
+
+    aircraft_slab_capacity += count;
+    return true;
+}
+
+// Take an (uninitialized) record from the freelist, growing it if allowed.
+// Returns NULL if we're at --track-max or out of memory.
+static struct aircraft *aircraftAlloc(void)
+{
+    if (!aircraft_freelist) {
+        unsigned count = AIRCRAFT_SLAB_RECORDS;
+        if (Modes.track_max) {
+            if (aircraft_slab_capacity >= Modes.track_max)
+                return NULL;
+            if (count > Modes.track_max - aircraft_slab_capacity)
+                count = Modes.track_max - aircraft_slab_capacity;
+        }
+
+        if (!aircraftSlabGrow(count))
+            return NULL;
+    }
+
+    struct aircraft *a = aircraft_freelist;
+    aircraft_freelist = a->next;
+    ++aircraft_slab_used;
+    return a;
+}
+
+// Return a record to the freelist
+static void aircraftFree(struct aircraft *a)
+{
+    a->next = aircraft_freelist;
+    aircraft_freelist = a;
+    --aircraft_slab_used;
+}
+
+void trackInit(void)
+{
+    unsigned count = Modes.track_prealloc;
+    if (Modes.track_max && count > Modes.track_max)
+        count = Modes.track_max;
+
+    if (count && !aircraftSlabGrow(count)) {
+        fprintf(stderr, "Out of memory preallocating %u aircraft records\n", count);
+        exit(1);
+    }
+}
+
+void trackUpdateStats(struct stats *st)
+{
+    st->aircraft_slab_capacity = aircraft_slab_capacity;
+    st->aircraft_slab_used = aircraft_slab_used;
+}
+
+// Open-addressed hash index over Modes.aircrafts, keyed on address, with
+// linear probing. The linked list remains the iteration order; the index
+// only speeds up trackFindAircraft(). Entries are removed by shifting later
+// entries of the same probe run back, so no tombstones are needed.
+
+#define AIRCRAFT_INDEX_MIN_SIZE 1024   // initial index size, must be a power of two
+
+static struct aircraft **aircraft_index;      // index slots, NULL if empty
+static unsigned aircraft_index_size;          // number of slots (power of two)
+static unsigned aircraft_index_count;         // number of occupied slots
+
+static uint32_t aircraftHash(uint32_t addr)
+{
+    // Jenkins one-at-a-time hash, as in icao_filter.c, but covering the
+    // non-ICAO address flag in the top byte too
+    uint32_t hash = 0;
+
+    for (unsigned i = 0; i < 4; ++i) {
+        hash += (addr >> (i * 8)) & 0xff;
+        hash += (hash << 10);
+        hash ^= (hash >> 6);
+    }
+
+    hash += (hash << 3);
+    hash ^= (hash >> 11);
+    hash += (hash << 15);
+
+    return hash;
+}
+
+// Insert 'a' into 'index' (which must have a free slot)
+static void aircraftIndexInsertInto(struct aircraft **index, unsigned size, struct aircraft *a)
+{
+    unsigned h = aircraftHash(a->addr) & (size - 1);
+    while (index[h])
+        h = (h + 1) & (size - 1);
+    index[h] = a;
+}
+
+// Resize the index to 'size' slots. Returns false (leaving the index
+// unchanged) if we run out of memory.
+static bool aircraftIndexResize(unsigned size)
+{
+    struct aircraft **index = calloc(size, sizeof(*index));
+    if (!index)
+        return false;
+
+    for (unsigned i = 0; i < aircraft_index_size; ++i) {
+        if (aircraft_index[i])
+            aircraftIndexInsertInto(index, size, aircraft_index[i]);
+    }
+
+    free(aircraft_index);
+    aircraft_index = index;
+    aircraft_index_size = size;
+    return true;
+}
+
+// Add an aircraft to the index. Returns false if there was no room.
+static bool aircraftIndexAdd(struct aircraft *a)
+{
+    // keep the load factor at or below 1/2
+    if ((aircraft_index_count + 1) * 2 > aircraft_index_size) {
+        unsigned newsize = aircraft_index_size ? aircraft_index_size * 2 : AIRCRAFT_INDEX_MIN_SIZE;
+        if (!aircraftIndexResize(newsize)) {
+            fprintf(stderr, "out of memory growing aircraft index to %u entries\n", newsize);
+            if (aircraft_index_count + 1 >= aircraft_index_size)
+                return false; // full, we can't track this one
+        }
+    }
+
+    aircraftIndexInsertInto(aircraft_index, aircraft_index_size, a);
+    ++aircraft_index_count;
+    return true;
+}
+
+// Remove an aircraft from the index
+static void aircraftIndexRemove(struct aircraft *a)
+{
+    unsigned mask = aircraft_index_size - 1;
+    unsigned h = aircraftHash(a->addr) & mask;
+    while (aircraft_index[h] != a) {
+        if (!aircraft_index[h])
+            return; // not present
+        h = (h + 1) & mask;
+    }
+
+    // Backward-shift deletion: move up any later entry in this probe run
+    // whose home slot is not in the (cyclic) range (hole, entry]
+    unsigned hole = h;
+    for (unsigned i = (hole + 1) & mask; aircraft_index[i]; i = (i + 1) & mask) {
+        unsigned home = aircraftHash(aircraft_index[i]->addr) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            aircraft_index[hole] = aircraft_index[i];
+            hole = i;
+        }
+    }
+
+    aircraft_index[hole] = NULL;
+    --aircraft_index_count;
+}
+
+// Expiry scheduling. Each aircraft sits in a hashed timer wheel of
+// one-second slots, keyed on the next time anything about it needs
+// attention: one of its data_validity fields expiring, or the aircraft
+// itself timing out (TRACK_AIRCRAFT_TTL / TRACK_AIRCRAFT_UNRELIABLE_TTL).
+// The periodic update only visits slots that have come due, so its cost
+// follows the number of expiries rather than the number of aircraft.
+//
+// An aircraft in the slot for second N is due at or before N*1000. The
+// wheel spans more than TRACK_AIRCRAFT_TTL, so entries should not wrap,
+// but one that does is just put back until its time comes round again.
+
+#define EXPIRY_WHEEL_SLOTS 512   // number of one-second slots, must be a power of two
+
+static struct aircraft *expiry_wheel[EXPIRY_WHEEL_SLOTS];   // heads of per-slot lists, linked via expiry_next
+static uint64_t expiry_wheel_tick;                         // last second processed
+
+static void expiryUnschedule(struct aircraft *a)
+{
+    if (!a->expiry_pprev)
+        return;
+
+    *a->expiry_pprev = a->expiry_next;
+    if (a->expiry_next)
+        a->expiry_next->expiry_pprev = a->expiry_pprev;
+    a->expiry_next = NULL;
+    a->expiry_pprev = NULL;
+}
+
+// (Re)schedule an aircraft to be looked at by the periodic update at or after 'when'
+static void expirySchedule(struct aircraft *a, uint64_t when)
+{
+    expiryUnschedule(a);
+
+    uint64_t tick = (when + 999) / 1000;
+    if (tick <= expiry_wheel_tick)
+        tick = expiry_wheel_tick + 1;
+
+    struct aircraft **slot = &expiry_wheel[tick & (EXPIRY_WHEEL_SLOTS - 1)];
+    a->expiry_when = when;
+    a->expiry_next = *slot;
+    if (a->expiry_next)
+        a->expiry_next->expiry_pprev = &a->expiry_next;
+    a->expiry_pprev = slot;
+    *slot = a;
+}
+
 //
 // Return a new aircraft structure for the linked list of tracked
-// aircraft
+// aircraft, or NULL if no more aircraft can be tracked
 //
 static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
     static struct aircraft zeroAircraft;
-    struct aircraft *a = (struct aircraft *) malloc(sizeof(*a));
+    static struct aircraft_mrar zeroMrar;
+    static struct aircraft_fatsv zeroFatsv;
+    static struct commb_history zeroCommb;
+    struct aircraft *a = aircraftAlloc();
     int i;
 
-    // Default everything to zero/NULL
+    if (!a) {
+        Modes.stats_current.aircraft_alloc_failures++;
+        return NULL;
+    }
+
+    // Default everything to zero/NULL, keeping the side records that belong to this slot
+    struct aircraft_mrar *mrar = a->mrar;
+    struct aircraft_fatsv *fatsv = a->fatsv;
+    struct commb_history *commb = a->commb;
     *a = zeroAircraft;
+    *(a->mrar = mrar) = zeroMrar;
+    *(a->fatsv = fatsv) = zeroFatsv;
+    *(a->commb = commb) = zeroCommb;
 
     // Now initialise things that should not be 0/NULL to their defaults
     a->addr = mm->addr;
@@ -85,16 +349,17 @@ static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
 
     // start off with the "last emitted" ACAS RA being blank (just the BDS 3,0
     // or ES type code)
-    a->fatsv_emitted_bds_30[0] = 0x30;
-    a->fatsv_emitted_es_acas_ra[0] = 0xE2;
-    a->fatsv_emitted_adsb_version = -1;
-    a->fatsv_emitted_addrtype = ADDR_UNKNOWN;
+    a->fatsv->emitted_bds_30[0] = 0x30;
+    a->fatsv->emitted_es_acas_ra[0] = 0xE2;
+    a->fatsv->emitted_adsb_version = -1;
+    a->fatsv->emitted_addrtype = ADDR_UNKNOWN;
 
     // don't immediately emit, let some data build up
     a->fatsv_last_emitted = a->fatsv_last_force_emit = messageNow();
 
     // initialize data validity ages
 #define F(f,s,e) do { a->f##_valid.stale_interval = (s) * 1000; a->f##_valid.expire_interval = (e) * 1000; } while (0)
+#define F_MRAR(f,s,e) do { a->mrar->f##_valid.stale_interval = (s) * 1000; a->mrar->f##_valid.expire_interval = (e) * 1000; } while (0)
     F(callsign,        60, 70);  // ADS-B or Comm-B
     F(altitude_baro,   15, 70);  // ADS-B or Mode S
     F(altitude_geom,   60, 70);  // ADS-B only
@@ -130,13 +395,14 @@ static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
     F(sil,             60, 70);  // ADS-B only
     F(gva,             60, 70);  // ADS-B only
     F(sda,             60, 70);  // ADS-B only
-    F(mrar_source,     60, 70);  // Comm-B only
-    F(wind,            60, 70);  // Comm-B only
-    F(temperature,     60, 70);  // Comm-B only
-    F(pressure,        60, 70);  // Comm-B only
-    F(turbulence,      60, 70);  // Comm-B only
-    F(humidity,        60, 70);  // Comm-B only
+    F_MRAR(mrar_source, 60, 70);  // Comm-B only
+    F_MRAR(wind,        60, 70);  // Comm-B only
+    F_MRAR(temperature, 60, 70);  // Comm-B only
+    F_MRAR(pressure,    60, 70);  // Comm-B only
+    F_MRAR(turbulence,  60, 70);  // Comm-B only
+    F_MRAR(humidity,    60, 70);  // Comm-B only
 #undef F
+#undef F_MRAR
 
     Modes.stats_current.unique_aircraft++;
 
@@ -150,18 +416,21 @@ static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
 // exists with this address.
 //
 static struct aircraft *trackFindAircraft(uint32_t addr) {
-    struct aircraft *a = Modes.aircrafts;
+    if (!aircraft_index)
+        return NULL;
 
-    while(a) {
-        if (a->addr == addr) return (a);
-        a = a->next;
+    unsigned mask = aircraft_index_size - 1;
+    struct aircraft *a;
+    for (unsigned h = aircraftHash(addr) & mask; (a = aircraft_index[h]); h = (h + 1) & mask) {
+        if (a->addr == addr)
+            return a;
     }
-    return (NULL);
+    return NULL;
 }
 
 // Should we accept some new data from the given source?
-// If so, update the validity and return 1
-static int accept_data(data_validity *d, datasource_t source)
+// If so, update the validity (which belongs to aircraft 'a') and return 1
+static int accept_data(struct aircraft *a, data_validity *d, datasource_t source)
 {
     if (messageNow() < d->updated)
         return 0;
@@ -173,9 +442,20 @@ static int accept_data(data_validity *d, datasource_t source)
     d->updated = messageNow();
     d->stale = messageNow() + (d->stale_interval ? d->stale_interval : 60000);
     d->expires = messageNow() + (d->expire_interval ? d->expire_interval : 70000);
+    if (d->expires < a->expiry_when)
+        expirySchedule(a, d->expires);
     return 1;
 }
 
+// Note that some MRAR data was updated; a->mrar_expires tracks when the
+// last of it expires, so the periodic scan can skip the MRAR side record
+// for aircraft that have none (the usual case).
+static void mrarUpdated(struct aircraft *a, const data_validity *d)
+{
+    if (d->expires > a->mrar_expires)
+        a->mrar_expires = d->expires;
+}
+
 // Given two datasources, produce a third datasource for data combined from them.
 static void combine_validity(data_validity *to, const data_validity *from1, const data_validity *from2) {
     if (from1->source == SOURCE_INVALID) {
@@ -566,7 +846,7 @@ static void updatePosition(struct aircraft *a, struct modesMessage *mm)
             // Nonfatal, try again later.
             Modes.stats_current.cpr_global_skipped++;
         } else {
-            if (accept_data(&a->position_valid, mm->source)) {
+            if (accept_data(a, &a->position_valid, mm->source)) {
                 Modes.stats_current.cpr_global_ok++;
             } else {
                 Modes.stats_current.cpr_global_skipped++;
@@ -579,7 +859,7 @@ static void updatePosition(struct aircraft *a, struct modesMessage *mm)
     if (location_result == -1) {
         location_result = doLocalCPR(a, mm, &new_lat, &new_lon, &new_nic, &new_rc);
 
-        if (location_result == 0 && accept_data(&a->position_valid, mm->source)) {
+        if (location_result == 0 && accept_data(a, &a->position_valid, mm->source)) {
             Modes.stats_current.cpr_local_ok++;
             mm->cpr_relative = 1;
         } else {
@@ -938,10 +1218,28 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
 
     // Lookup our aircraft or create a new one
     a = trackFindAircraft(mm->addr);
+
+    // Comm-B replies are classified here rather than in decodeModesMessage(),
+    // so that the classifier can use what this aircraft has replied before
+    if (mm->msgtype == 20 || mm->msgtype == 21)
+        decodeCommB(mm, a ? a->commb : NULL);
+
     if (!a) {                              // If it's a currently unknown aircraft....
         a = trackCreateAircraft(mm);       // ., create a new record for it,
+        if (!a)
+            return NULL;
+        if (!aircraftIndexAdd(a)) {        // .. index it (if there's room),
+            aircraftFree(a);
+            Modes.stats_current.aircraft_alloc_failures++;
+            return NULL;
+        }
         a->next = Modes.aircrafts;         // .. and put it at the head of the list
+        if (a->next)
+            a->next->pprev = &a->next;
+        a->pprev = &Modes.aircrafts;
         Modes.aircrafts = a;
+
+        expirySchedule(a, messageNow() + TRACK_AIRCRAFT_UNRELIABLE_TTL + 1);
     }
 
     if (mm->signalLevel > 0) {
@@ -1033,7 +1331,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         }
     }
 
-    if (mm->altitude_baro_valid && accept_data(&a->altitude_baro_valid, mm->source)) {
+    if (mm->altitude_baro_valid && accept_data(a, &a->altitude_baro_valid, mm->source)) {
         int alt = altitude_to_feet(mm->altitude_baro, mm->altitude_baro_unit);
         if (a->modeC_hit) {
             int new_modeC = (a->altitude_baro + 49) / 100;
@@ -1046,7 +1344,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         a->altitude_baro = alt;
     }
 
-    if (mm->squawk_valid && accept_data(&a->squawk_valid, mm->source)) {
+    if (mm->squawk_valid && accept_data(a, &a->squawk_valid, mm->source)) {
         if (mm->squawk != a->squawk) {
             a->modeA_hit = 0;
         }
@@ -1071,22 +1369,22 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
                 break;
             }
 
-            if (squawk_emergency != EMERGENCY_NONE && accept_data(&a->emergency_valid, mm->source)) {
+            if (squawk_emergency != EMERGENCY_NONE && accept_data(a, &a->emergency_valid, mm->source)) {
                 a->emergency = squawk_emergency;
             }
         }
 #endif
     }
 
-    if (mm->emergency_valid && accept_data(&a->emergency_valid, mm->source)) {
+    if (mm->emergency_valid && accept_data(a, &a->emergency_valid, mm->source)) {
         a->emergency = mm->emergency;
     }
 
-    if (mm->altitude_geom_valid && accept_data(&a->altitude_geom_valid, mm->source)) {
+    if (mm->altitude_geom_valid && accept_data(a, &a->altitude_geom_valid, mm->source)) {
         a->altitude_geom = altitude_to_feet(mm->altitude_geom, mm->altitude_geom_unit);
     }
 
-    if (mm->geom_delta_valid && accept_data(&a->geom_delta_valid, mm->source)) {
+    if (mm->geom_delta_valid && accept_data(a, &a->geom_delta_valid, mm->source)) {
         a->geom_delta = mm->geom_delta;
     }
 
@@ -1098,47 +1396,47 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
             htype = a->adsb_tah;
         }
 
-        if (htype == HEADING_GROUND_TRACK && accept_data(&a->track_valid, mm->source)) {
+        if (htype == HEADING_GROUND_TRACK && accept_data(a, &a->track_valid, mm->source)) {
             a->track = mm->heading;
-        } else if (htype == HEADING_MAGNETIC && accept_data(&a->mag_heading_valid, mm->source)) {
+        } else if (htype == HEADING_MAGNETIC && accept_data(a, &a->mag_heading_valid, mm->source)) {
             a->mag_heading = mm->heading;
-        } else if (htype == HEADING_TRUE && accept_data(&a->true_heading_valid, mm->source)) {
+        } else if (htype == HEADING_TRUE && accept_data(a, &a->true_heading_valid, mm->source)) {
             a->true_heading = mm->heading;
         }
     }
 
-    if (mm->track_rate_valid && accept_data(&a->track_rate_valid, mm->source)) {
+    if (mm->track_rate_valid && accept_data(a, &a->track_rate_valid, mm->source)) {
         a->track_rate = mm->track_rate;
     }
 
-    if (mm->roll_valid && accept_data(&a->roll_valid, mm->source)) {
+    if (mm->roll_valid && accept_data(a, &a->roll_valid, mm->source)) {
         a->roll = mm->roll;
     }
 
     if (mm->gs_valid) {
         mm->gs.selected = (*message_version == 2 ? mm->gs.v2 : mm->gs.v0);
-        if (accept_data(&a->gs_valid, mm->source)) {
+        if (accept_data(a, &a->gs_valid, mm->source)) {
             a->gs = mm->gs.selected;
         }
     }
 
-    if (mm->ias_valid && accept_data(&a->ias_valid, mm->source)) {
+    if (mm->ias_valid && accept_data(a, &a->ias_valid, mm->source)) {
         a->ias = mm->ias;
     }
 
-    if (mm->tas_valid && accept_data(&a->tas_valid, mm->source)) {
+    if (mm->tas_valid && accept_data(a, &a->tas_valid, mm->source)) {
         a->tas = mm->tas;
     }
 
-    if (mm->mach_valid && accept_data(&a->mach_valid, mm->source)) {
+    if (mm->mach_valid && accept_data(a, &a->mach_valid, mm->source)) {
         a->mach = mm->mach;
     }
 
-    if (mm->baro_rate_valid && accept_data(&a->baro_rate_valid, mm->source)) {
+    if (mm->baro_rate_valid && accept_data(a, &a->baro_rate_valid, mm->source)) {
         a->baro_rate = mm->baro_rate;
     }
 
-    if (mm->geom_rate_valid && accept_data(&a->geom_rate_valid, mm->source)) {
+    if (mm->geom_rate_valid && accept_data(a, &a->geom_rate_valid, mm->source)) {
         a->geom_rate = mm->geom_rate;
     }
 
@@ -1147,13 +1445,13 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         // If our current state is certain but new data is not, only accept the uncertain state if the certain data has gone stale
         if (mm->airground != AG_UNCERTAIN ||
             (mm->airground == AG_UNCERTAIN && !trackDataFresh(&a->airground_valid))) {
-            if (accept_data(&a->airground_valid, mm->source)) {
+            if (accept_data(a, &a->airground_valid, mm->source)) {
                 a->airground = mm->airground;
             }
         }
     }
 
-    if (mm->callsign_valid && accept_data(&a->callsign_valid, mm->source)) {
+    if (mm->callsign_valid && accept_data(a, &a->callsign_valid, mm->source)) {
         if (strcmp(a->callsign, mm->callsign) != 0) {
             // The callsign changed so tell interactive to
             // re-evaluate its callsign filter regex if it has one
@@ -1162,32 +1460,32 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         memcpy(a->callsign, mm->callsign, sizeof(a->callsign));
     }
 
-    if (mm->nav.mcp_altitude_valid && accept_data(&a->nav_altitude_mcp_valid, mm->source)) {
+    if (mm->nav.mcp_altitude_valid && accept_data(a, &a->nav_altitude_mcp_valid, mm->source)) {
         a->nav_altitude_mcp = mm->nav.mcp_altitude;
     }
 
-    if (mm->nav.fms_altitude_valid && accept_data(&a->nav_altitude_fms_valid, mm->source)) {
+    if (mm->nav.fms_altitude_valid && accept_data(a, &a->nav_altitude_fms_valid, mm->source)) {
         a->nav_altitude_fms = mm->nav.fms_altitude;
     }
 
-    if (mm->nav.altitude_source != NAV_ALT_INVALID && accept_data(&a->nav_altitude_src_valid, mm->source)) {
+    if (mm->nav.altitude_source != NAV_ALT_INVALID && accept_data(a, &a->nav_altitude_src_valid, mm->source)) {
         a->nav_altitude_src = mm->nav.altitude_source;
     }
 
-    if (mm->nav.heading_valid && accept_data(&a->nav_heading_valid, mm->source)) {
+    if (mm->nav.heading_valid && accept_data(a, &a->nav_heading_valid, mm->source)) {
         a->nav_heading = mm->nav.heading;
     }
 
-    if (mm->nav.modes_valid && accept_data(&a->nav_modes_valid, mm->source)) {
+    if (mm->nav.modes_valid && accept_data(a, &a->nav_modes_valid, mm->source)) {
         a->nav_modes = mm->nav.modes;
     }
 
-    if (mm->nav.qnh_valid && accept_data(&a->nav_qnh_valid, mm->source)) {
+    if (mm->nav.qnh_valid && accept_data(a, &a->nav_qnh_valid, mm->source)) {
         a->nav_qnh = mm->nav.qnh;
     }
 
     // CPR, even
-    if (mm->cpr_valid && !mm->cpr_odd && accept_data(&a->cpr_even_valid, mm->source)) {
+    if (mm->cpr_valid && !mm->cpr_odd && accept_data(a, &a->cpr_even_valid, mm->source)) {
         a->cpr_even_type = mm->cpr_type;
         a->cpr_even_lat = mm->cpr_lat;
         a->cpr_even_lon = mm->cpr_lon;
@@ -1196,7 +1494,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
     }
 
     // CPR, odd
-    if (mm->cpr_valid && mm->cpr_odd && accept_data(&a->cpr_odd_valid, mm->source)) {
+    if (mm->cpr_valid && mm->cpr_odd && accept_data(a, &a->cpr_odd_valid, mm->source)) {
         a->cpr_odd_type = mm->cpr_type;
         a->cpr_odd_lat = mm->cpr_lat;
         a->cpr_odd_lon = mm->cpr_lon;
@@ -1204,68 +1502,74 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         cpr_new = 1;
     }
 
-    if (mm->accuracy.sda_valid && accept_data(&a->sda_valid, mm->source)) {
+    if (mm->accuracy.sda_valid && accept_data(a, &a->sda_valid, mm->source)) {
         a->sda = mm->accuracy.sda;
     }
 
-    if (mm->accuracy.nic_a_valid && accept_data(&a->nic_a_valid, mm->source)) {
+    if (mm->accuracy.nic_a_valid && accept_data(a, &a->nic_a_valid, mm->source)) {
         a->nic_a = mm->accuracy.nic_a;
     }
 
-    if (mm->accuracy.nic_c_valid && accept_data(&a->nic_c_valid, mm->source)) {
+    if (mm->accuracy.nic_c_valid && accept_data(a, &a->nic_c_valid, mm->source)) {
         a->nic_c = mm->accuracy.nic_c;
     }
 
-    if (mm->accuracy.nic_baro_valid && accept_data(&a->nic_baro_valid, mm->source)) {
+    if (mm->accuracy.nic_baro_valid && accept_data(a, &a->nic_baro_valid, mm->source)) {
         a->nic_baro = mm->accuracy.nic_baro;
     }
 
-    if (mm->accuracy.nac_p_valid && accept_data(&a->nac_p_valid, mm->source)) {
+    if (mm->accuracy.nac_p_valid && accept_data(a, &a->nac_p_valid, mm->source)) {
         a->nac_p = mm->accuracy.nac_p;
     }
 
-    if (mm->accuracy.nac_v_valid && accept_data(&a->nac_v_valid, mm->source)) {
+    if (mm->accuracy.nac_v_valid && accept_data(a, &a->nac_v_valid, mm->source)) {
         a->nac_v = mm->accuracy.nac_v;
     }
 
-    if (mm->accuracy.sil_type != SIL_INVALID && accept_data(&a->sil_valid, mm->source)) {
+    if (mm->accuracy.sil_type != SIL_INVALID && accept_data(a, &a->sil_valid, mm->source)) {
         a->sil = mm->accuracy.sil;
         if (a->sil_type == SIL_INVALID || mm->accuracy.sil_type != SIL_UNKNOWN) {
             a->sil_type = mm->accuracy.sil_type;
         }
     }
 
-    if (mm->accuracy.gva_valid && accept_data(&a->gva_valid, mm->source)) {
+    if (mm->accuracy.gva_valid && accept_data(a, &a->gva_valid, mm->source)) {
         a->gva = mm->accuracy.gva;
     }
 
-    if (mm->accuracy.sda_valid && accept_data(&a->sda_valid, mm->source)) {
+    if (mm->accuracy.sda_valid && accept_data(a, &a->sda_valid, mm->source)) {
         a->sda = mm->accuracy.sda;
     }
 
-    if (mm->mrar_source_valid && accept_data(&a->mrar_source_valid, mm->source)) {
-        a->mrar_source = mm->mrar_source;
+    if (mm->mrar_source_valid && accept_data(a, &a->mrar->mrar_source_valid, mm->source)) {
+        a->mrar->mrar_source = mm->mrar_source;
+        mrarUpdated(a, &a->mrar->mrar_source_valid);
     }
 
-    if (mm->wind_valid && accept_data(&a->wind_valid, mm->source)) {
-        a->wind_speed = mm->wind_speed;
-        a->wind_dir = mm->wind_dir;
+    if (mm->wind_valid && accept_data(a, &a->mrar->wind_valid, mm->source)) {
+        a->mrar->wind_speed = mm->wind_speed;
+        a->mrar->wind_dir = mm->wind_dir;
+        mrarUpdated(a, &a->mrar->wind_valid);
     }
 
-    if (mm->temperature_valid && accept_data(&a->temperature_valid, mm->source)) {
-        a->temperature = mm->temperature;
+    if (mm->temperature_valid && accept_data(a, &a->mrar->temperature_valid, mm->source)) {
+        a->mrar->temperature = mm->temperature;
+        mrarUpdated(a, &a->mrar->temperature_valid);
     }
 
-    if (mm->pressure_valid && accept_data(&a->pressure_valid, mm->source)) {
-        a->pressure = mm->pressure;
+    if (mm->pressure_valid && accept_data(a, &a->mrar->pressure_valid, mm->source)) {
+        a->mrar->pressure = mm->pressure;
+        mrarUpdated(a, &a->mrar->pressure_valid);
     }
 
-    if (mm->turbulence_valid && accept_data(&a->turbulence_valid, mm->source)) {
-        a->turbulence = mm->turbulence;
+    if (mm->turbulence_valid && accept_data(a, &a->mrar->turbulence_valid, mm->source)) {
+        a->mrar->turbulence = mm->turbulence;
+        mrarUpdated(a, &a->mrar->turbulence_valid);
     }
 
-    if (mm->humidity_valid && accept_data(&a->humidity_valid, mm->source)) {
-        a->humidity = mm->humidity;
+    if (mm->humidity_valid && accept_data(a, &a->mrar->humidity_valid, mm->source)) {
+        a->mrar->humidity = mm->humidity;
+        mrarUpdated(a, &a->mrar->humidity_valid);
     }
 
     // Now handle derived data
@@ -1369,76 +1673,120 @@ static void trackMatchAC(uint64_t now)
 //
 //=========================================================================
 //
-// If we don't receive new nessages within TRACK_AIRCRAFT_TTL
-// we remove the aircraft from the list.
+// Expire old data from an aircraft that has come due in the expiry wheel,
+// or remove it entirely if we haven't received new messages within
+// TRACK_AIRCRAFT_TTL. Otherwise, reschedule it for the next expiry.
 //
-static void trackRemoveStaleAircraft(uint64_t now)
+static void trackExpireAircraft(struct aircraft *a, uint64_t now)
 {
-    struct aircraft *a = Modes.aircrafts;
-    struct aircraft *prev = NULL;
-
-    while(a) {
-        if ((now - a->seen) > TRACK_AIRCRAFT_TTL || (!a->reliable && (now - a->seen) > TRACK_AIRCRAFT_UNRELIABLE_TTL)) {
-            // Count aircraft where we saw only one message before reaping them.
-            // These are likely to be due to messages with bad addresses.
-            if (a->messages == 1)
-                Modes.stats_current.single_message_aircraft++;
-            if (!a->reliable)
-                Modes.stats_current.unreliable_aircraft++;
-
-            // Remove the element from the linked list, with care
-            // if we are removing the first element
-            if (!prev) {
-                Modes.aircrafts = a->next; free(a); a = Modes.aircrafts;
-            } else {
-                prev->next = a->next; free(a); a = prev->next;
-            }
-        } else {
+    if ((now - a->seen) > TRACK_AIRCRAFT_TTL || (!a->reliable && (now - a->seen) > TRACK_AIRCRAFT_UNRELIABLE_TTL)) {
+        // Count aircraft where we saw only one message before reaping them.
+        // These are likely to be due to messages with bad addresses.
+        if (a->messages == 1)
+            Modes.stats_current.single_message_aircraft++;
+        if (!a->reliable)
+            Modes.stats_current.unreliable_aircraft++;
+
+        aircraftIndexRemove(a);
+
+        // Remove the element from the linked list
+        *a->pprev = a->next;
+        if (a->next)
+            a->next->pprev = a->pprev;
+
+        aircraftFree(a);
+        return;
+    }
 
-#define EXPIRE(_f) do { if (a->_f##_valid.source != SOURCE_INVALID && now >= a->_f##_valid.expires) { a->_f##_valid.source = SOURCE_INVALID; } } while (0)
-            EXPIRE(callsign);
-            EXPIRE(altitude_baro);
-            EXPIRE(altitude_geom);
-            EXPIRE(geom_delta);
-            EXPIRE(gs);
-            EXPIRE(ias);
-            EXPIRE(tas);
-            EXPIRE(mach);
-            EXPIRE(track);
-            EXPIRE(track_rate);
-            EXPIRE(roll);
-            EXPIRE(mag_heading);
-            EXPIRE(true_heading);
-            EXPIRE(baro_rate);
-            EXPIRE(geom_rate);
-            EXPIRE(squawk);
-            EXPIRE(emergency);
-            EXPIRE(airground);
-            EXPIRE(nav_qnh);
-            EXPIRE(nav_altitude_mcp);
-            EXPIRE(nav_altitude_fms);
-            EXPIRE(nav_altitude_src);
-            EXPIRE(nav_heading);
-            EXPIRE(nav_modes);
-            EXPIRE(cpr_odd);
-            EXPIRE(cpr_even);
-            EXPIRE(position);
-            EXPIRE(nic_a);
-            EXPIRE(nic_c);
-            EXPIRE(nic_baro);
-            EXPIRE(nac_p);
-            EXPIRE(nac_v);
-            EXPIRE(sil);
-            EXPIRE(gva);
-            EXPIRE(sda);
-            EXPIRE(mrar_source);
-            EXPIRE(wind);
-            EXPIRE(temperature);
-            EXPIRE(pressure);
-            EXPIRE(turbulence);
-            EXPIRE(humidity);
+    // Expire anything that is due; find the next thing that will be
+    uint64_t next = a->seen + (a->reliable ? TRACK_AIRCRAFT_TTL : TRACK_AIRCRAFT_UNRELIABLE_TTL) + 1;
+
+#define EXPIRE(_v) do {                                                 \
+        if ((_v).source != SOURCE_INVALID) {                            \
+            if (now >= (_v).expires)                                    \
+                (_v).source = SOURCE_INVALID;                           \
+            else if ((_v).expires < next)                               \
+                next = (_v).expires;                                    \
+        }                                                               \
+    } while (0)
+    EXPIRE(a->callsign_valid);
+    EXPIRE(a->altitude_baro_valid);
+    EXPIRE(a->altitude_geom_valid);
+    EXPIRE(a->geom_delta_valid);
+    EXPIRE(a->gs_valid);
+    EXPIRE(a->ias_valid);
+    EXPIRE(a->tas_valid);
+    EXPIRE(a->mach_valid);
+    EXPIRE(a->track_valid);
+    EXPIRE(a->track_rate_valid);
+    EXPIRE(a->roll_valid);
+    EXPIRE(a->mag_heading_valid);
+    EXPIRE(a->true_heading_valid);
+    EXPIRE(a->baro_rate_valid);
+    EXPIRE(a->geom_rate_valid);
+    EXPIRE(a->squawk_valid);
+    EXPIRE(a->emergency_valid);
+    EXPIRE(a->airground_valid);
+    EXPIRE(a->nav_qnh_valid);
+    EXPIRE(a->nav_altitude_mcp_valid);
+    EXPIRE(a->nav_altitude_fms_valid);
+    EXPIRE(a->nav_altitude_src_valid);
+    EXPIRE(a->nav_heading_valid);
+    EXPIRE(a->nav_modes_valid);
+    EXPIRE(a->cpr_odd_valid);
+    EXPIRE(a->cpr_even_valid);
+    EXPIRE(a->position_valid);
+    EXPIRE(a->nic_a_valid);
+    EXPIRE(a->nic_c_valid);
+    EXPIRE(a->nic_baro_valid);
+    EXPIRE(a->nac_p_valid);
+    EXPIRE(a->nac_v_valid);
+    EXPIRE(a->sil_valid);
+    EXPIRE(a->gva_valid);
+    EXPIRE(a->sda_valid);
+
+    if (a->mrar_expires) {
+        EXPIRE(a->mrar->mrar_source_valid);
+        EXPIRE(a->mrar->wind_valid);
+        EXPIRE(a->mrar->temperature_valid);
+        EXPIRE(a->mrar->pressure_valid);
+        EXPIRE(a->mrar->turbulence_valid);
+        EXPIRE(a->mrar->humidity_valid);
+        if (now >= a->mrar_expires)
+            a->mrar_expires = 0;
+    }
 #undef EXPIRE
-            prev = a; a = a->next;
+
+    expirySchedule(a, next);
+}
+
+// Process every expiry wheel slot that has come due by 'now'
+static void trackRemoveStaleAircraft(uint64_t now)
+{
+    uint64_t now_tick = now / 1000;
+
+    // after a long gap (or on the first call) one pass over the whole wheel is enough
+    if (now_tick > expiry_wheel_tick + EXPIRY_WHEEL_SLOTS)
+        expiry_wheel_tick = now_tick - EXPIRY_WHEEL_SLOTS;
+
+    while (expiry_wheel_tick < now_tick) {
+        ++expiry_wheel_tick;
+
+        // Detach the slot's list before walking it, as rescheduling may put
+        // aircraft (that have wrapped) back into this same slot
+        struct aircraft **slot = &expiry_wheel[expiry_wheel_tick & (EXPIRY_WHEEL_SLOTS - 1)];
+        struct aircraft *due = *slot;
+        *slot = NULL;
+        if (due)
+            due->expiry_pprev = &due;
+
+        struct aircraft *a;
+        while ((a = due)) {
+            expiryUnschedule(a);
+            if (now < a->expiry_when)
+                expirySchedule(a, a->expiry_when); // wrapped, not due yet
+            else
+                trackExpireAircraft(a, now);
         }
     }
 }
@@ -1456,7 +1804,12 @@ void trackPeriodicUpdate()
     // Only do updates once per second
     if (now >= next_update) {
         next_update = now + 1000;
-        trackRemoveStaleAircraft(now);
-        trackMatchAC(now);
+        trackPeriodicWork(now);
     }
 }
+
+void trackPeriodicWork(uint64_t now)
+{
+    trackRemoveStaleAircraft(now);
+    trackMatchAC(now);
+}
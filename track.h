@@ -81,8 +81,8 @@
 //  stale: data is valid. Updates from a less reliable source are accepted.
 //  expired: data is not valid.
 typedef struct {
-    uint64_t stale_interval;  /* how long after an update until the data is stale */
-    uint64_t expire_interval; /* how long after an update until the data expires */
+    uint32_t stale_interval;  /* how long after an update until the data is stale */
+    uint32_t expire_interval; /* how long after an update until the data expires */
 
     datasource_t source;     /* where the data came from */
     uint64_t updated;        /* when it arrived */
@@ -90,8 +90,82 @@ typedef struct {
     uint64_t expires;        /* when it expires */
 } data_validity;
 
-/* Structure used to describe the state of one tracked aircraft */
+/* Shadow state for FATSV output: the values we last emitted, so that
+ * writeFATSV() can emit only-on-change data. Only touched by writeFATSV().
+ */
+struct aircraft_fatsv {
+    int           emitted_altitude_baro;          // last FA emitted altitude
+    int           emitted_altitude_geom;          //      -"-         GNSS altitude
+    int           emitted_baro_rate;              //      -"-         barometric rate
+    int           emitted_geom_rate;              //      -"-         geometric rate
+    float         emitted_track;                  //      -"-         true track
+    float         emitted_track_rate;             //      -"-         track rate of change
+    float         emitted_mag_heading;            //      -"-         magnetic heading
+    float         emitted_true_heading;           //      -"-         true heading
+    float         emitted_roll;                   //      -"-         roll angle
+    float         emitted_gs;                     //      -"-         groundspeed
+    unsigned      emitted_ias;                    //      -"-         IAS
+    unsigned      emitted_tas;                    //      -"-         TAS
+    float         emitted_mach;                   //      -"-         Mach number
+    airground_t   emitted_airground;              //      -"-         air/ground state
+    int           emitted_nav_altitude_mcp;       //      -"-         MCP altitude
+    int           emitted_nav_altitude_fms;       //      -"-         FMS altitude
+    nav_altitude_source_t emitted_nav_altitude_src; // -"-      automation altitude source
+    float         emitted_nav_heading;            //      -"-         target heading
+    nav_modes_t   emitted_nav_modes;              //      -"-         enabled navigation modes
+    float         emitted_nav_qnh;                //      -"-         altimeter setting
+    unsigned char emitted_bds_10[7];              //      -"-         BDS 1,0 message
+    unsigned char emitted_bds_17[7];              //      -"-         BDS 1,7 message
+    unsigned char emitted_bds_30[7];              //      -"-         BDS 3,0 message
+    unsigned char emitted_unknown_commb[7];       //      -"-         unrecognized Comm-B message
+    unsigned char emitted_es_status[7];           //      -"-         ES operational status message
+    unsigned char emitted_es_acas_ra[7];          //      -"-         ES ACAS RA report message
+    char          emitted_callsign[9];            //      -"-         callsign
+    addrtype_t    emitted_addrtype;               //      -"-         address type (assumed ADSB_ICAO initially)
+    int           emitted_adsb_version;           //      -"-         ADS-B version (assumed non-ADS-B initially)
+    unsigned      emitted_category;               //      -"-         ADS-B emitter category (assumed A0 initially)
+    unsigned      emitted_squawk;                 //      -"-         squawk
+    unsigned      emitted_nac_p;                  //      -"-         NACp
+    unsigned      emitted_nac_v;                  //      -"-         NACv
+    unsigned      emitted_sil;                    //      -"-         SIL
+    sil_type_t    emitted_sil_type;               //      -"-         SIL supplement
+    unsigned      emitted_nic_baro;               //      -"-         NICbaro
+    emergency_t   emitted_emergency;              //      -"-         emergency/priority status
+};
+
+/* Meteorological data extracted from MRAR (BDS 4,4) */
+struct aircraft_mrar {
+    data_validity mrar_source_valid;
+    data_validity wind_valid; // speed and direction
+    data_validity pressure_valid;
+    data_validity temperature_valid;
+    data_validity turbulence_valid;
+    data_validity humidity_valid;
+
+    mrar_source_t mrar_source;
+    float         wind_speed;
+    float         wind_dir;
+    float         pressure;
+    float         temperature;
+    hazard_t      turbulence;
+    float         humidity;
+};
+
+/* Structure used to describe the state of one tracked aircraft.
+ *
+ * The fields read by the periodic scans over every aircraft (trackRemoveStaleAircraft,
+ * trackMatchAC, writeFATSV, generateAircraftJson) come first, so that skipping an
+ * aircraft touches only the first few cache lines. Rarely used state lives in
+ * side records allocated alongside the aircraft (see track.c).
+ */
 struct aircraft {
+    struct aircraft *next;        // Next aircraft in our linked list
+    struct aircraft **pprev;      // The 'next' pointer (or Modes.aircrafts) that points to this aircraft
+
+    struct aircraft *expiry_next;   // Next aircraft in the same expiry wheel slot
+    struct aircraft **expiry_pprev; // The pointer that points to this aircraft in its expiry wheel slot, NULL if not scheduled
+    uint64_t      expiry_when;    // Time (millis) at which something about this aircraft next expires
+
     uint32_t      addr;           // ICAO address
     addrtype_t    addrtype;       // highest priority address type seen for this aircraft
 
@@ -99,6 +173,28 @@ struct aircraft {
     long          messages;       // Number of Mode S messages received
 
     int           reliable;       // Do we think this is a real aircraft, not noise?
+    int           modeA_hit;   // did our squawk match a possible mode A reply in the last check period?
+    int           modeC_hit;   // did our altitude match a possible mode C reply in the last check period?
+
+    uint64_t      fatsv_last_emitted;             // time (millis) aircraft was last FA emitted
+    uint64_t      fatsv_last_force_emit;          // time (millis) we last emitted only-on-change data
+
+    data_validity squawk_valid;
+    unsigned      squawk;         // Squawk
+
+    data_validity altitude_baro_valid;
+    int           altitude_baro;   // Altitude (Baro)
+
+    data_validity position_valid;
+    double        lat, lon;       // Coordinates obtained from CPR encoded data
+    unsigned      pos_nic;        // NIC of last computed position
+    unsigned      pos_rc;         // Rc of last computed position
+
+    struct aircraft_fatsv *fatsv; // FATSV shadow state
+    struct aircraft_mrar *mrar;   // data extracted from MRAR
+    struct commb_history *commb;  // what recent Comm-B replies were, for decodeCommB()
+    uint64_t      mrar_expires;   // time (millis) the last valid MRAR data expires; 0 if there is none
+
     long          reliableDF11;   // Number of "reliable" DF11s (no CRC errors corrected, IID = 0) received
     long          reliableDF17;   // Number of "reliable" DF17s (no CRC errors corrected) received
     long          discarded;      // Number of messages discarded as possibly-noise
@@ -110,9 +206,6 @@ struct aircraft {
     char          callsign[9];     // Flight number
     int           callsign_matched;   // Interactive callsign filter matched
 
-    data_validity altitude_baro_valid;
-    int           altitude_baro;   // Altitude (Baro)
-
     data_validity altitude_geom_valid;
     int           altitude_geom;   // Altitude (Geometric)
 
@@ -152,9 +245,6 @@ struct aircraft {
     data_validity geom_rate_valid;
     int           geom_rate;      // Vertical rate (geometric)
 
-    data_validity squawk_valid;
-    unsigned      squawk;         // Squawk
-
     data_validity emergency_valid;
     emergency_t   emergency;      // Emergency/priority status
 
@@ -195,11 +285,6 @@ struct aircraft {
     unsigned      cpr_even_nic;
     unsigned      cpr_even_rc;
 
-    data_validity position_valid;
-    double        lat, lon;       // Coordinates obtained from CPR encoded data
-    unsigned      pos_nic;        // NIC of last computed position
-    unsigned      pos_rc;         // Rc of last computed position
-
     // data extracted from opstatus etc
     int           adsb_version;   // ADS-B version (from ADS-B operational status); -1 means no ADS-B messages seen
     int           adsr_version;   // As above, for ADS-R messages
@@ -225,68 +310,6 @@ struct aircraft {
     sil_type_t    sil_type;      // SIL supplement from TSS or opstatus
     unsigned      gva;           // GVA from opstatus
     unsigned      sda;           // SDA from opstatus
-
-    // data extracted from MRAR
-    data_validity mrar_source_valid;
-    data_validity wind_valid; // speed and direction
-    data_validity pressure_valid;
-    data_validity temperature_valid;
-    data_validity turbulence_valid;
-    data_validity humidity_valid;
-
-    mrar_source_t mrar_source;
-    float         wind_speed;
-    float         wind_dir;
-    float         pressure;
-    float         temperature;
-    hazard_t      turbulence;
-    float         humidity;
-
-    int           modeA_hit;   // did our squawk match a possible mode A reply in the last check period?
-    int           modeC_hit;   // did our altitude match a possible mode C reply in the last check period?
-
-    int           fatsv_emitted_altitude_baro;    // last FA emitted altitude
-    int           fatsv_emitted_altitude_geom;    //      -"-         GNSS altitude
-    int           fatsv_emitted_baro_rate;        //      -"-         barometric rate
-    int           fatsv_emitted_geom_rate;        //      -"-         geometric rate
-    float         fatsv_emitted_track;            //      -"-         true track
-    float         fatsv_emitted_track_rate;       //      -"-         track rate of change
-    float         fatsv_emitted_mag_heading;      //      -"-         magnetic heading
-    float         fatsv_emitted_true_heading;     //      -"-         true heading
-    float         fatsv_emitted_roll;             //      -"-         roll angle
-    float         fatsv_emitted_gs;               //      -"-         groundspeed
-    unsigned      fatsv_emitted_ias;              //      -"-         IAS
-    unsigned      fatsv_emitted_tas;              //      -"-         TAS
-    float         fatsv_emitted_mach;             //      -"-         Mach number
-    airground_t   fatsv_emitted_airground;        //      -"-         air/ground state
-    int           fatsv_emitted_nav_altitude_mcp; //      -"-         MCP altitude
-    int           fatsv_emitted_nav_altitude_fms; //      -"-         FMS altitude
-    nav_altitude_source_t fatsv_emitted_nav_altitude_src; // -"-      automation altitude source
-    float         fatsv_emitted_nav_heading;      //      -"-         target heading
-    nav_modes_t   fatsv_emitted_nav_modes;        //      -"-         enabled navigation modes
-    float         fatsv_emitted_nav_qnh;          //      -"-         altimeter setting
-    unsigned char fatsv_emitted_bds_10[7];        //      -"-         BDS 1,0 message
-    unsigned char fatsv_emitted_bds_17[7];        //      -"-         BDS 1,7 message
-    unsigned char fatsv_emitted_bds_30[7];        //      -"-         BDS 3,0 message
-    unsigned char fatsv_emitted_unknown_commb[7]; //      -"-         unrecognized Comm-B message
-    unsigned char fatsv_emitted_es_status[7];     //      -"-         ES operational status message
-    unsigned char fatsv_emitted_es_acas_ra[7];    //      -"-         ES ACAS RA report message
-    char          fatsv_emitted_callsign[9];      //      -"-         callsign
-    addrtype_t    fatsv_emitted_addrtype;         //      -"-         address type (assumed ADSB_ICAO initially)
-    int           fatsv_emitted_adsb_version;     //      -"-         ADS-B version (assumed non-ADS-B initially)
-    unsigned      fatsv_emitted_category;         //      -"-         ADS-B emitter category (assumed A0 initially)
-    unsigned      fatsv_emitted_squawk;           //      -"-         squawk
-    unsigned      fatsv_emitted_nac_p;            //      -"-         NACp
-    unsigned      fatsv_emitted_nac_v;            //      -"-         NACv
-    unsigned      fatsv_emitted_sil;              //      -"-         SIL
-    sil_type_t    fatsv_emitted_sil_type;         //      -"-         SIL supplement
-    unsigned      fatsv_emitted_nic_baro;         //      -"-         NICbaro
-    emergency_t   fatsv_emitted_emergency;        //      -"-         emergency/priority status
-
-    uint64_t      fatsv_last_emitted;             // time (millis) aircraft was last FA emitted
-    uint64_t      fatsv_last_force_emit;          // time (millis) we last emitted only-on-change data
-
-    struct aircraft *next;        // Next aircraft in our linked list
 };
 
 /* Mode A/C tracking is done separately, not via the aircraft list,
@@ -328,6 +351,16 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm);
 /* Call periodically */
 void trackPeriodicUpdate();
 
+/* The work done by trackPeriodicUpdate() once a second, as of time 'now' */
+void trackPeriodicWork(uint64_t now);
+
+/* Preallocate aircraft records (--track-prealloc); call once at startup */
+void trackInit(void);
+
+/* Fill in aircraft record occupancy stats */
+struct stats;
+void trackUpdateStats(struct stats *st);
+
 /* Convert from a (hex) mode A value to a 0-4095 index */
 static inline unsigned modeAToIndex(unsigned modeA)
 {
@@ -54,6 +54,11 @@
 
 #include <stdlib.h>
 #include <sys/time.h>
+#include <sched.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 uint64_t _messageNow = 0;
 
@@ -68,6 +73,14 @@ uint64_t mstime(void)
     return mst;
 }
 
+uint64_t monotonic_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
 int64_t receiveclock_ns_elapsed(uint64_t t1, uint64_t t2)
 {
     return (t2 - t1) * 1000U / 12U;
@@ -134,6 +147,156 @@ void set_thread_name(const char *name)
 #endif
 }
 
+// Parse a CPU list such as "0-1,4", calling fn for each CPU; returns false if it is malformed
+static bool parse_cpu_list(const char *cpus, void (*fn)(int cpu, void *arg), void *arg)
+{
+    const char *p = cpus;
+
+    do {
+        char *end;
+        long first = strtol(p, &end, 10);
+        if (end == p || first < 0)
+            return false;
+
+        long last = first;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+            if (end == p || last < first)
+                return false;
+        }
+
+        if (last >= 1024)
+            return false;
+
+        if (fn) {
+            for (long cpu = first; cpu <= last; ++cpu)
+                fn(cpu, arg);
+        }
+
+        p = end;
+    } while (*p++ == ',');
+
+    return (p[-1] == 0);
+}
+
+bool valid_cpu_list(const char *cpus)
+{
+    return parse_cpu_list(cpus, NULL, NULL);
+}
+
+static void note_first_cpu(int cpu, void *arg)
+{
+    int *first = arg;
+    if (*first < 0)
+        *first = cpu;
+}
+
+int first_cpu_in_list(const char *cpus)
+{
+    int first = -1;
+    if (!cpus || !parse_cpu_list(cpus, note_first_cpu, &first))
+        return -1;
+    return first;
+}
+
+#ifdef __linux__
+static void add_to_cpu_set(int cpu, void *arg)
+{
+    if (cpu < CPU_SETSIZE)
+        CPU_SET(cpu, (cpu_set_t *) arg);
+}
+#endif
+
+void set_thread_scheduling(const char *name, const char *cpus, int priority)
+{
+    if (cpus) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        parse_cpu_list(cpus, add_to_cpu_set, &set);
+
+        int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (err)
+            fprintf(stderr, "%s: could not set CPU affinity to %s: %s\n", name, cpus, strerror(err));
+#else
+        fprintf(stderr, "%s: setting CPU affinity is not supported on this platform\n", name);
+#endif
+    }
+
+    if (priority) {
+        struct sched_param param = { .sched_priority = priority };
+        int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (err)
+            fprintf(stderr, "%s: could not set SCHED_FIFO priority %d: %s\n", name, priority, strerror(err));
+    }
+}
+
+long current_thread_id(void)
+{
+#if defined(__linux__) && defined(SYS_gettid)
+    return syscall(SYS_gettid);
+#else
+    return 0;
+#endif
+}
+
+// Open /proc/self/task/<tid>/<file> for reading
+static FILE *open_thread_file(long tid, const char *file)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%ld/%s", tid, file);
+    return fopen(path, "r");
+}
+
+bool get_thread_usage(long tid, struct thread_usage *usage)
+{
+    FILE *f;
+    char line[256];
+    unsigned long long value;
+    bool found = false;
+
+    memset(usage, 0, sizeof(*usage));
+    if (!tid)
+        return false;
+
+    // context switches: always available on Linux
+    if (!(f = open_thread_file(tid, "status")))
+        return false;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "voluntary_ctxt_switches: %llu", &value) == 1) {
+            usage->voluntary_switches = value;
+            found = true;
+        } else if (sscanf(line, "nonvoluntary_ctxt_switches: %llu", &value) == 1) {
+            usage->involuntary_switches = value;
+        }
+    }
+    fclose(f);
+
+    // CPU time, in ns
+    if ((f = open_thread_file(tid, "schedstat"))) {
+        if (fscanf(f, "%llu", &value) == 1) {
+            usage->cpu.tv_sec = value / 1000000000ULL;
+            usage->cpu.tv_nsec = value % 1000000000ULL;
+        }
+        fclose(f);
+    }
+
+    // migrations: only with CONFIG_SCHED_DEBUG
+    if ((f = open_thread_file(tid, "sched"))) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "se.nr_migrations : %llu", &value) == 1) {
+                usage->migrations = value;
+                usage->migrations_valid = true;
+                break;
+            }
+        }
+        fclose(f);
+    }
+
+    return found;
+}
+
 int join_thread(pthread_t thread, void **retval, uint32_t timeout_ms)
 {
 #if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 3)
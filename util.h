@@ -21,11 +21,15 @@
 #define DUMP1090_UTIL_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <pthread.h>
 
 /* Returns system time in milliseconds */
 uint64_t mstime(void);
 
+/* Returns monotonic time in nanoseconds, for measuring intervals */
+uint64_t monotonic_ns(void);
+
 /* Returns the time for the current message we're dealing with */
 extern uint64_t _messageNow;
 static inline uint64_t messageNow() {
@@ -61,6 +65,37 @@ void update_cpu_timing(struct timespec *start_time, struct timespec *add_to);
 /* set current thread name, if supported */
 void set_thread_name(const char *name);
 
+/* Returns true if `cpus` is a valid CPU list for set_thread_scheduling:
+ * comma-separated CPU numbers or ranges, e.g. "2" or "0-1,4"
+ */
+bool valid_cpu_list(const char *cpus);
+
+/* Returns the first CPU in the CPU list `cpus`, or -1 if `cpus` is NULL or malformed */
+int first_cpu_in_list(const char *cpus);
+
+/* Restrict the current thread to the CPUs in the list `cpus` (if not NULL)
+ * and, if `priority` is nonzero, run it with SCHED_FIFO real-time scheduling
+ * at that priority (1-99). Failures are reported using `name`, but are not fatal.
+ */
+void set_thread_scheduling(const char *name, const char *cpus, int priority);
+
+/* Cumulative scheduler counters for one thread */
+struct thread_usage {
+    struct timespec cpu;            /* CPU time used */
+    uint64_t voluntary_switches;     /* context switches while waiting for something */
+    uint64_t involuntary_switches;   /* context switches because the thread was preempted */
+    uint64_t migrations;             /* moves from one CPU to another */
+    bool migrations_valid;           /* false if the kernel doesn't report migrations */
+};
+
+/* Return the kernel thread ID of the current thread, for get_thread_usage; 0 if not supported */
+long current_thread_id(void);
+
+/* Read the scheduler counters for thread `tid` (see current_thread_id) of
+ * this process. Returns false if they are not available.
+ */
+bool get_thread_usage(long tid, struct thread_usage *usage);
+
 /* wait for the given thread to terminate, like pthread_join. If supported,
  * if the thread has not terminated within `timeout_ms` milliseconds, return ETIMEDOUT.
  */
@@ -98,9 +98,8 @@ static void view1090Init(void) {
     }
 
     // Prepare error correction tables
-    modesChecksumInit(Modes.nfix_crc);
+    modesChecksumInit(Modes.nfix_crc, NULL);
     icaoFilterInit();
-    modeACInit();
 }
 
 //